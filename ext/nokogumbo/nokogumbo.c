@@ -282,6 +282,8 @@ static VALUE new_html_doc(const char *dtd_name, const char *system, const char *
 static VALUE parse(VALUE self, VALUE string, VALUE url, VALUE max_errors) {
   GumboOptions options = kGumboDefaultOptions;
   options.max_errors = NUM2INT(max_errors);
+  // Only the positions of errors are reported, and those are always resolved.
+  options.lazy_positions = true;
 
   const char *input = RSTRING_PTR(string);
   size_t input_len = RSTRING_LEN(string);
@@ -0,0 +1,117 @@
+// Measures how gumbo_parse_batch scales with the number of threads, from 1 up
+// to one per online CPU, by parsing the same set of documents with each.
+//
+// Usage: build/benchmark/batch [-r ROUNDS] FILE...
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "gumbo.h"
+
+static char* read_file(const char* filename, size_t* length) {
+  FILE* file = fopen(filename, "rb");
+  if (!file) {
+    perror(filename);
+    exit(1);
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char* buffer = malloc(size + 1);
+  if (!buffer || fread(buffer, 1, size, file) != (size_t) size) {
+    perror(filename);
+    exit(1);
+  }
+  fclose(file);
+  buffer[size] = '\0';
+  *length = size;
+  return buffer;
+}
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+  int rounds = 5;
+  int first = 1;
+  if (argc > 2 && !strcmp(argv[1], "-r")) {
+    rounds = atoi(argv[2]);
+    first = 3;
+  }
+  if (first >= argc || rounds < 1) {
+    fprintf(stderr, "Usage: %s [-r ROUNDS] FILE...\n", argv[0]);
+    return 1;
+  }
+
+  size_t count = argc - first;
+  char** buffers = malloc(count * sizeof(char*));
+  size_t* lengths = malloc(count * sizeof(size_t));
+  GumboOutput** outputs = malloc(count * sizeof(GumboOutput*));
+  size_t total_input = 0;
+  for (size_t i = 0; i < count; ++i) {
+    buffers[i] = read_file(argv[first + i], &lengths[i]);
+    total_input += lengths[i];
+  }
+
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  if (cpus < 1) {
+    cpus = 1;
+  }
+  printf (
+    "%zu documents, %zu bytes, %d rounds, %ld CPUs\n",
+    count,
+    total_input,
+    rounds,
+    cpus
+  );
+
+  double single = 0;
+  for (unsigned int threads = 1; threads <= (unsigned long) cpus; ++threads) {
+    // The best of several rounds, since the outputs are released in between.
+    double best = 0;
+    for (int round = 0; round < rounds; ++round) {
+      double start = now();
+      gumbo_parse_batch (
+        &kGumboDefaultOptions,
+        (const char* const*) buffers,
+        lengths,
+        count,
+        threads,
+        outputs
+      );
+      double elapsed = now() - start;
+      if (round == 0 || elapsed < best) {
+        best = elapsed;
+      }
+      for (size_t i = 0; i < count; ++i) {
+        gumbo_destroy_output(outputs[i]);
+      }
+    }
+    if (threads == 1) {
+      single = best;
+    }
+    printf (
+      "%u threads: %.3f s, %.1f MB/s, %.0f documents/s, %.2fx\n",
+      threads,
+      best,
+      total_input / best / 1e6,
+      count / best,
+      single / best
+    );
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    free(buffers[i]);
+  }
+  free(outputs);
+  free(lengths);
+  free(buffers);
+  return 0;
+}
@@ -0,0 +1,538 @@
+// Parses a fixed corpus of generated documents, each standing for one kind of
+// page that stresses a different part of the tokenizer or tree construction,
+// and reports throughput, peak memory and allocation counts for each as JSON.
+// The documents are generated from fixed seeds, so every run (and every
+// version of the parser) sees the same input, and the output can be diffed or
+// tracked over time. Files given on the command line are measured too.
+//
+// Usage: build/benchmark/bench [-r ROUNDS] [-a] [FILE...]
+//
+//   -r ROUNDS  keep the best of this many timed rounds (default 5)
+//   -a         parse with GumboOptions.use_arena
+//
+// Each document is measured in a child process of its own, so that its peak
+// RSS isn't hidden by the documents before it. Allocations are counted by
+// wrapping malloc(3), calloc(3) and realloc(3) at link time (see the Makefile).
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "gumbo.h"
+
+static size_t num_allocations;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+  ++num_allocations;
+  return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+  ++num_allocations;
+  return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  ++num_allocations;
+  return __real_realloc(ptr, size);
+}
+
+typedef struct {
+  char* data;
+  size_t length;
+  size_t capacity;
+} Buffer;
+
+static void append(Buffer* buffer, const char* format, ...) {
+  for (;;) {
+    va_list args;
+    va_start(args, format);
+    size_t room = buffer->capacity - buffer->length;
+    int n = vsnprintf(buffer->data + buffer->length, room, format, args);
+    va_end(args);
+    if (n < 0) {
+      perror("vsnprintf");
+      exit(1);
+    }
+    if ((size_t) n < room) {
+      buffer->length += n;
+      return;
+    }
+    buffer->capacity = 2 * buffer->capacity + n + 1;
+    buffer->data = realloc(buffer->data, buffer->capacity);
+    if (!buffer->data) {
+      perror("realloc");
+      exit(1);
+    }
+  }
+}
+
+// A small linear congruential generator, so the corpus doesn't depend on the
+// C library's rand(3).
+static unsigned int next_random(unsigned long* state) {
+  *state = *state * 6364136223846793005UL + 1442695040888963407UL;
+  return *state >> 33;
+}
+
+static const char* const kWords[] = {
+  "the", "parser", "of", "tree", "and", "a", "document", "to", "element",
+  "in", "text", "is", "node", "for", "token", "attribute", "with", "state",
+  "that", "insertion", "mode", "on", "html", "character", "reference",
+};
+
+static const char* random_word(unsigned long* state) {
+  return kWords[next_random(state) % (sizeof(kWords) / sizeof(kWords[0]))];
+}
+
+static void append_sentence(Buffer* buffer, unsigned long* state) {
+  unsigned int length = 5 + next_random(state) % 15;
+  for (unsigned int i = 0; i < length; ++i) {
+    append(buffer, i ? " %s" : "%s", random_word(state));
+  }
+  append(buffer, ". ");
+}
+
+static void open_page(Buffer* buffer, const char* title) {
+  append (
+    buffer,
+    "<!DOCTYPE html>\n<html lang=en>\n<head>\n<meta charset=utf-8>\n"
+    "<title>%s</title>\n<link rel=stylesheet href=/style.css>\n</head>\n"
+    "<body>\n",
+    title
+  );
+}
+
+static void close_page(Buffer* buffer) {
+  append(buffer, "</body>\n</html>\n");
+}
+
+// A typical small article page, with navigation, headings, links and lists.
+static void generate_small(Buffer* buffer, unsigned long* state) {
+  open_page(buffer, "Small page");
+  append(buffer, "<nav><ul>\n");
+  for (int i = 0; i < 8; ++i) {
+    append(buffer, "<li><a href=\"/section/%d\" class=nav-link>", i);
+    append(buffer, "%s</a></li>\n", random_word(state));
+  }
+  append(buffer, "</ul></nav>\n<main>\n<article>\n<h1>Small page</h1>\n");
+  for (int i = 0; i < 6; ++i) {
+    append(buffer, "<h2 id=s%d>%s</h2>\n<p>", i, random_word(state));
+    for (int j = 0; j < 3; ++j) {
+      append_sentence(buffer, state);
+    }
+    append(buffer, "<a href=\"https://example.com/%d\">more</a></p>\n", i);
+  }
+  append(buffer, "</article>\n</main>\n<footer>&copy; 2024</footer>\n");
+  close_page(buffer);
+}
+
+// Megabytes of plain paragraphs, which is mostly character tokens.
+static void generate_huge_text(Buffer* buffer, unsigned long* state) {
+  open_page(buffer, "Huge text page");
+  while (buffer->length < 4 * 1024 * 1024) {
+    append(buffer, "<p>");
+    for (int i = 0; i < 8; ++i) {
+      append_sentence(buffer, state);
+    }
+    append(buffer, "</p>\n");
+  }
+  close_page(buffer);
+}
+
+// A data table of a few thousand rows, with implied end tags throughout.
+static void generate_tables(Buffer* buffer, unsigned long* state) {
+  open_page(buffer, "Table page");
+  append(buffer, "<table class=data>\n<thead><tr>");
+  for (int i = 0; i < 8; ++i) {
+    append(buffer, "<th scope=col>%s", random_word(state));
+  }
+  append(buffer, "\n<tbody>\n");
+  for (int row = 0; row < 6000; ++row) {
+    append(buffer, "<tr class=%s>", row % 2 ? "odd" : "even");
+    for (int i = 0; i < 8; ++i) {
+      if (i == 0) {
+        append(buffer, "<td><a href=\"/row/%d\">%d</a>", row, row);
+      } else {
+        append(buffer, "<td>%u", next_random(state) % 100000);
+      }
+    }
+    append(buffer, "\n");
+  }
+  append(buffer, "</table>\n");
+  close_page(buffer);
+}
+
+// Pages that are mostly inline scripts, including the escaping rules around
+// "<!--" and "</script" inside them.
+static void generate_scripts(Buffer* buffer, unsigned long* state) {
+  open_page(buffer, "Script page");
+  for (int i = 0; i < 3000; ++i) {
+    append (
+      buffer,
+      "<script type=text/javascript>\n"
+      "var data%d = {name: \"%s\", count: %u};\n"
+      "if (data%d.count < 100 && data%d.count > 10) {\n"
+      "  document.write(\"<div class='x'>\" + data%d.name + \"</div>\");\n"
+      "}\n"
+      "<!-- var legacy = \"<script>nested</script>\"; -->\n"
+      "</script>\n<p>%s</p>\n",
+      i,
+      random_word(state),
+      next_random(state) % 1000,
+      i,
+      i,
+      i,
+      random_word(state)
+    );
+  }
+  close_page(buffer);
+}
+
+// Repeated deep nesting, just under the parser's depth limit, which stresses
+// the stack of open elements and scope checks.
+static void generate_nested(Buffer* buffer, unsigned long* state) {
+  static const char* const kTags[] = {"div", "span", "section", "em", "b"};
+  open_page(buffer, "Nested page");
+  for (int block = 0; block < 150; ++block) {
+    int depth = 300 + next_random(state) % 80;
+    for (int i = 0; i < depth; ++i) {
+      append(buffer, "<%s class=l%d>", kTags[(block + i) % 5], i);
+    }
+    append(buffer, "%s", random_word(state));
+    for (int i = depth - 1; i >= 0; --i) {
+      append(buffer, "</%s>", kTags[(block + i) % 5]);
+    }
+    append(buffer, "\n");
+  }
+  close_page(buffer);
+}
+
+// Text and attribute values dense with named and numeric character
+// references.
+static void generate_entities(Buffer* buffer, unsigned long* state) {
+  static const char* const kReferences[] = {
+    "&amp;", "&lt;", "&gt;", "&quot;", "&nbsp;", "&copy;", "&eacute;",
+    "&hellip;", "&mdash;", "&notin;", "&CounterClockwiseContourIntegral;",
+    "&#x20AC;", "&#8212;", "&#128512;", "&amp", "&notit;",
+  };
+  size_t num_references = sizeof(kReferences) / sizeof(kReferences[0]);
+  open_page(buffer, "Entity page");
+  while (buffer->length < 2 * 1024 * 1024) {
+    append (
+      buffer,
+      "<p title=\"%s%s\">",
+      random_word(state),
+      kReferences[next_random(state) % num_references]
+    );
+    for (int i = 0; i < 40; ++i) {
+      append (
+        buffer,
+        "%s%s",
+        random_word(state),
+        kReferences[next_random(state) % num_references]
+      );
+    }
+    append(buffer, "</p>\n");
+  }
+  close_page(buffer);
+}
+
+// Tag soup: misnested formatting elements, stray end tags, unclosed elements,
+// broken attributes and comments, and invalid UTF-8.
+static void generate_malformed(Buffer* buffer, unsigned long* state) {
+  static const char* const kFragments[] = {
+    "<b><i>bold italic</b> italic</i>",
+    "<a href=x><div>block in link</a> after</div>",
+    "</p></div></span>",
+    "<p>unclosed <li>item <li>item",
+    "<table><tr>text in table<td>cell</table>",
+    "<div id=\"unterminated>text</div>",
+    "<font color=red size=3 color=blue>dup</font>",
+    "<!-- bad -- comment --!>",
+    "<p =x a=\"1\"b='2'>attrs</p>",
+    "\xFF\xC3(\xE2\x82 invalid",
+    "<select><option>a<option>b</select>",
+    "<form><form>nested</form></form>",
+    "<b>bold<p>adoption</b>agency</p>",
+    "</br><image src=x>",
+  };
+  size_t num_fragments = sizeof(kFragments) / sizeof(kFragments[0]);
+  append(buffer, "<html><title>Malformed page</title><body>\n");
+  // Each line is wrapped in a section, so that what's left open doesn't pile
+  // up past the depth limit.
+  while (buffer->length < 1024 * 1024) {
+    append(buffer, "<section>");
+    for (int i = 0; i < 4; ++i) {
+      append(buffer, "%s ", kFragments[next_random(state) % num_fragments]);
+    }
+    append(buffer, "%s</section>\n", random_word(state));
+  }
+}
+
+// Many small blocks at the bottom of a stack of open elements just under the
+// depth limit. Every block start tag checks for an open <p> in button scope,
+// which is pathological for scope checks that walk the whole stack.
+static void generate_deep_blocks(Buffer* buffer, unsigned long* state) {
+  static const char* const kTags[] = {"div", "section", "article", "aside"};
+  open_page(buffer, "Deep page");
+  for (int i = 0; i < 380; ++i) {
+    append(buffer, "<%s class=d%d>", kTags[i % 4], i);
+  }
+  while (buffer->length < 1024 * 1024) {
+    append (
+      buffer,
+      "<div>%s</div><p>%s</p><section>%s</section>\n",
+      random_word(state),
+      random_word(state),
+      random_word(state)
+    );
+  }
+  close_page(buffer);
+}
+
+// A long, cleanly nested page of the sort a site generator produces: cards of
+// divs, headings, paragraphs with inline formatting and links, and lists,
+// every element closed in order.
+static void generate_well_formed(Buffer* buffer, unsigned long* state) {
+  open_page(buffer, "Well-formed page");
+  append(buffer, "<div class=page>\n<main>\n");
+  for (int card = 0; buffer->length < 2 * 1024 * 1024; ++card) {
+    append (
+      buffer,
+      "<section class=card id=c%d>\n<header><h2>%s</h2></header>\n"
+      "<div class=body>\n",
+      card,
+      random_word(state)
+    );
+    for (int i = 0; i < 3; ++i) {
+      append (
+        buffer,
+        "<p><span class=lead>%s</span> <em>%s</em> <strong>%s</strong> ",
+        random_word(state),
+        random_word(state),
+        random_word(state)
+      );
+      append_sentence(buffer, state);
+      append (
+        buffer,
+        "<a href=\"/c/%d/%d\"><code>%s</code></a></p>\n",
+        card,
+        i,
+        random_word(state)
+      );
+    }
+    append(buffer, "<ul>");
+    for (int i = 0; i < 4; ++i) {
+      append(buffer, "<li><span>%s</span></li>", random_word(state));
+    }
+    append(buffer, "</ul>\n</div>\n</section>\n");
+  }
+  append(buffer, "</main>\n</div>\n");
+  close_page(buffer);
+}
+
+typedef struct {
+  const char* name;
+  void (*generate)(Buffer* buffer, unsigned long* state);
+} CorpusDocument;
+
+static const CorpusDocument kCorpus[] = {
+  {"small", generate_small},
+  {"huge_text", generate_huge_text},
+  {"tables", generate_tables},
+  {"scripts", generate_scripts},
+  {"nested", generate_nested},
+  {"entities", generate_entities},
+  {"malformed", generate_malformed},
+  {"deep_blocks", generate_deep_blocks},
+  {"well_formed", generate_well_formed},
+};
+
+static const size_t kCorpusSize = sizeof(kCorpus) / sizeof(kCorpus[0]);
+
+static void read_file(const char* filename, Buffer* buffer) {
+  FILE* file = fopen(filename, "rb");
+  if (!file) {
+    perror(filename);
+    exit(1);
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  buffer->data = malloc(size + 1);
+  if (!buffer->data || fread(buffer->data, 1, size, file) != (size_t) size) {
+    perror(filename);
+    exit(1);
+  }
+  fclose(file);
+  buffer->data[size] = '\0';
+  buffer->length = size;
+  buffer->capacity = size + 1;
+}
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t count_nodes(const GumboNode* node) {
+  const GumboVector* children;
+  switch (node->type) {
+    case GUMBO_NODE_DOCUMENT:
+      children = &node->v.document.children;
+      break;
+    case GUMBO_NODE_ELEMENT:
+    case GUMBO_NODE_TEMPLATE:
+      children = &node->v.element.children;
+      break;
+    default:
+      return 1;
+  }
+  size_t count = 1;
+  for (unsigned int i = 0; i < children->length; ++i) {
+    count += count_nodes(children->data[i]);
+  }
+  return count;
+}
+
+// Writes the name as a JSON string. Only file names need escaping.
+static void print_name(const char* name) {
+  putchar('"');
+  for (const char* c = name; *c; ++c) {
+    if (*c == '"' || *c == '\\') {
+      printf("\\%c", *c);
+    } else if ((unsigned char) *c < 0x20) {
+      printf("\\u%04x", *c);
+    } else {
+      putchar(*c);
+    }
+  }
+  putchar('"');
+}
+
+// Measures one document and prints its JSON object. Runs in a child process.
+static void measure (
+  const char* name,
+  const Buffer* input,
+  const GumboOptions* options,
+  int rounds
+) {
+  // Small documents are parsed several times per round, so that each round
+  // takes long enough to time.
+  size_t repeat = 1;
+  if (input->length > 0 && input->length < 1024 * 1024) {
+    repeat = 1024 * 1024 / input->length;
+  }
+
+  num_allocations = 0;
+  GumboOutput* output =
+    gumbo_parse_with_options(options, input->data, input->length);
+  size_t allocations = num_allocations;
+  size_t nodes = count_nodes(output->document);
+  unsigned int errors = output->errors.length;
+  GumboOutputStatus status = output->status;
+  gumbo_destroy_output(output);
+
+  double best = 0;
+  for (int round = 0; round < rounds; ++round) {
+    double start = now();
+    for (size_t i = 0; i < repeat; ++i) {
+      output = gumbo_parse_with_options(options, input->data, input->length);
+      gumbo_destroy_output(output);
+    }
+    double elapsed = (now() - start) / repeat;
+    if (round == 0 || elapsed < best) {
+      best = elapsed;
+    }
+  }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  printf("    {\"name\": ");
+  print_name(name);
+  printf (
+    ", \"status\": \"%s\", \"bytes\": %zu, \"nodes\": %zu, \"errors\": %u, "
+    "\"seconds\": %.6f, \"mb_per_s\": %.2f, \"nodes_per_s\": %.0f, "
+    "\"peak_rss_kb\": %ld, \"allocations\": %zu}",
+    gumbo_status_to_string(status),
+    input->length,
+    nodes,
+    errors,
+    best,
+    input->length / best / 1e6,
+    nodes / best,
+    usage.ru_maxrss,
+    allocations
+  );
+}
+
+int main(int argc, char** argv) {
+  int rounds = 5;
+  GumboOptions options = kGumboDefaultOptions;
+  int first = 1;
+  for (; first < argc && argv[first][0] == '-'; ++first) {
+    if (!strcmp(argv[first], "-r") && first + 1 < argc) {
+      rounds = atoi(argv[++first]);
+    } else if (!strcmp(argv[first], "-a")) {
+      options.use_arena = true;
+    } else {
+      break;
+    }
+  }
+  if (rounds < 1 || (first < argc && argv[first][0] == '-')) {
+    fprintf(stderr, "Usage: %s [-r ROUNDS] [-a] [FILE...]\n", argv[0]);
+    return 1;
+  }
+
+  printf (
+    "{\n  \"rounds\": %d,\n  \"use_arena\": %s,\n  \"documents\": [\n",
+    rounds,
+    options.use_arena ? "true" : "false"
+  );
+  size_t count = kCorpusSize + (argc - first);
+  for (size_t i = 0; i < count; ++i) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+      perror("fork");
+      return 1;
+    }
+    if (pid == 0) {
+      // The document is only built in the child, which keeps it out of the
+      // other documents' peak RSS.
+      Buffer input = {NULL, 0, 0};
+      const char* name;
+      if (i < kCorpusSize) {
+        unsigned long state = i + 1;
+        name = kCorpus[i].name;
+        kCorpus[i].generate(&input, &state);
+      } else {
+        name = argv[first + i - kCorpusSize];
+        read_file(name, &input);
+      }
+      measure(name, &input, &options, rounds);
+      printf(i + 1 < count ? ",\n" : "\n");
+      fflush(stdout);
+      _exit(0);
+    }
+    int status;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status)
+        || WEXITSTATUS(status) != 0) {
+      fprintf(stderr, "Measuring document %zu failed\n", i);
+      return 1;
+    }
+  }
+  printf("  ]\n}\n");
+  return 0;
+}
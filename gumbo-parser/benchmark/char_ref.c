@@ -0,0 +1,114 @@
+// Compares the named character reference matcher with the Ragel state machine
+// it replaced (see GUMBO_RAGEL_CHAR_REFS in char_ref.h), on the text following
+// the '&' of a mix of common, long, unterminated and invalid references. Both
+// must give the same result for every input.
+//
+// Usage: build/benchmark/char_ref [-r ROUNDS]
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "char_ref.h"
+
+typedef size_t (*Matcher) (
+  const char* data,
+  size_t length,
+  OneOrTwoCodepoints* output
+);
+
+// Each input is followed by the text after it, since the matchers are given
+// everything up to the end of the buffer.
+static const char* const kInputs[] = {
+  "amp; and", "lt;/p>", "gt; ", "nbsp;</td>", "quot;>", "copy; 2018",
+  "mdash; ", "hellip;</p>", "rsquo;s", "ldquo;Hi", "eacute;e", "times;2",
+  "amp&lt;", "nbsp ", "copy2018", "ampx=1", "notin;", "notit;", "not ",
+  "CounterClockwiseContourIntegral;", "NotNestedGreaterGreater;",
+  "DoubleLongLeftRightArrow;", "bne;", "nvlt;", "ThickSpace;", "fjlig;",
+  "foo;", "bogus ", "Zz;", "q=1&", "x", "AElig", "frac12;", "supseteq;",
+};
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Returns the best time of `rounds` runs over all of the inputs, `repeat`
+// times each, and adds up the matched lengths in `total` so that the work
+// can't be optimized away.
+static double time_matcher (
+  Matcher match,
+  int rounds,
+  int repeat,
+  size_t* total
+) {
+  size_t num_inputs = sizeof(kInputs) / sizeof(kInputs[0]);
+  double best = 0;
+  for (int round = 0; round < rounds; ++round) {
+    double start = now();
+    for (int i = 0; i < repeat; ++i) {
+      for (size_t j = 0; j < num_inputs; ++j) {
+        OneOrTwoCodepoints output = {-1, -1};
+        *total += match(kInputs[j], strlen(kInputs[j]), &output);
+      }
+    }
+    double elapsed = now() - start;
+    if (round == 0 || elapsed < best) {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  int rounds = 5;
+  if (argc == 3 && !strcmp(argv[1], "-r")) {
+    rounds = atoi(argv[2]);
+  } else if (argc != 1) {
+    rounds = 0;
+  }
+  if (rounds < 1) {
+    fprintf(stderr, "Usage: %s [-r ROUNDS]\n", argv[0]);
+    return 1;
+  }
+
+  size_t num_inputs = sizeof(kInputs) / sizeof(kInputs[0]);
+  int mismatches = 0;
+  for (size_t i = 0; i < num_inputs; ++i) {
+    const char* input = kInputs[i];
+    OneOrTwoCodepoints a = {-1, -1};
+    OneOrTwoCodepoints b = {-1, -1};
+    size_t x = gumbo_match_named_char_ref(input, strlen(input), &a);
+    size_t y = gumbo_match_named_char_ref_ragel(input, strlen(input), &b);
+    if (x != y || a.first != b.first || a.second != b.second) {
+      fprintf(stderr, "mismatch on \"%s\": %zu vs %zu\n", input, x, y);
+      ++mismatches;
+    }
+  }
+  if (mismatches) {
+    return 1;
+  }
+
+  const int repeat = 20000;
+  size_t total = 0;
+  double table = time_matcher (
+    gumbo_match_named_char_ref,
+    rounds,
+    repeat,
+    &total
+  );
+  double ragel = time_matcher (
+    gumbo_match_named_char_ref_ragel,
+    rounds,
+    repeat,
+    &total
+  );
+  double lookups = (double) repeat * num_inputs;
+  printf("table: %6.1f ns per lookup\n", table / lookups * 1e9);
+  printf("ragel: %6.1f ns per lookup\n", ragel / lookups * 1e9);
+  printf("(checksum %zu)\n", total);
+  return 0;
+}
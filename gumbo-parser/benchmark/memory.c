@@ -0,0 +1,121 @@
+// Reports how much heap memory the parse tree of each document uses, per
+// node, as measured by the C library's allocator. This includes allocator
+// overhead, but not the source buffer itself.
+//
+// Usage: build/benchmark/memory FILE...
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "gumbo.h"
+
+#if !defined(__GLIBC__) || __GLIBC__ < 2 \
+    || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 33)
+# error "This benchmark needs mallinfo2(3) from glibc 2.33 or later"
+#endif
+
+typedef struct {
+  size_t nodes;
+  size_t elements;
+  size_t texts;
+  size_t attributes;
+} NodeCounts;
+
+static void count_nodes(const GumboNode* node, NodeCounts* counts) {
+  ++counts->nodes;
+  const GumboVector* children;
+  switch (node->type) {
+    case GUMBO_NODE_DOCUMENT:
+      children = &node->v.document.children;
+      break;
+    case GUMBO_NODE_ELEMENT:
+    case GUMBO_NODE_TEMPLATE:
+      ++counts->elements;
+      counts->attributes += node->v.element.attributes.length;
+      children = &node->v.element.children;
+      break;
+    default:
+      ++counts->texts;
+      return;
+  }
+  for (unsigned int i = 0; i < children->length; ++i) {
+    count_nodes(children->data[i], counts);
+  }
+}
+
+static char* read_file(const char* filename, size_t* length) {
+  FILE* file = fopen(filename, "rb");
+  if (!file) {
+    perror(filename);
+    exit(1);
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char* buffer = malloc(size + 1);
+  if (!buffer || fread(buffer, 1, size, file) != (size_t) size) {
+    perror(filename);
+    exit(1);
+  }
+  fclose(file);
+  buffer[size] = '\0';
+  *length = size;
+  return buffer;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s FILE...\n", argv[0]);
+    return 1;
+  }
+
+  size_t total_bytes = 0;
+  size_t total_input = 0;
+  NodeCounts total = {0, 0, 0, 0};
+  for (int i = 1; i < argc; ++i) {
+    size_t length;
+    char* input = read_file(argv[i], &length);
+    size_t before = mallinfo2().uordblks;
+    GumboOutput* output =
+      gumbo_parse_with_options(&kGumboDefaultOptions, input, length);
+    size_t bytes = mallinfo2().uordblks - before;
+
+    NodeCounts counts = {0, 0, 0, 0};
+    count_nodes(output->document, &counts);
+    printf (
+      "%s: %zu bytes of input, %zu nodes (%zu elements, %zu text, "
+      "%zu attributes), %zu bytes, %.1f bytes/node\n",
+      argv[i],
+      length,
+      counts.nodes,
+      counts.elements,
+      counts.texts,
+      counts.attributes,
+      bytes,
+      (double) bytes / counts.nodes
+    );
+
+    total_bytes += bytes;
+    total_input += length;
+    total.nodes += counts.nodes;
+    total.elements += counts.elements;
+    total.texts += counts.texts;
+    total.attributes += counts.attributes;
+    gumbo_destroy_output(output);
+    free(input);
+  }
+
+  printf (
+    "total: %zu bytes of input, %zu nodes (%zu elements, %zu text, "
+    "%zu attributes), %zu bytes, %.1f bytes/node, %.2f bytes/input byte\n",
+    total_input,
+    total.nodes,
+    total.elements,
+    total.texts,
+    total.attributes,
+    total_bytes,
+    (double) total_bytes / total.nodes,
+    (double) total_bytes / total_input
+  );
+  return 0;
+}
@@ -0,0 +1,153 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+// Every allocation is rounded up to a multiple of this, which is at least the
+// strictest alignment required by any of the types stored in the parse tree.
+typedef union {
+  void* p;
+  long long ll;
+  long double ld;
+  size_t sz;
+} ArenaAlign;
+
+#define ARENA_ALIGNMENT sizeof(ArenaAlign)
+#define ARENA_ROUND_UP(size) \
+  (((size) + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1))
+
+// Chunks start small, so that tiny documents and fragments don't pay for a
+// large up-front allocation, and double in size up to this limit.
+static const size_t kInitialChunkSize = 16 * 1024;
+static const size_t kMaxChunkSize = 1024 * 1024;
+
+typedef struct ArenaChunk {
+  struct ArenaChunk* next;
+  size_t size;
+} ArenaChunk;
+
+#define CHUNK_HEADER_SIZE ARENA_ROUND_UP(sizeof(ArenaChunk))
+#define CHUNK_DATA(chunk) ((char*) (chunk) + CHUNK_HEADER_SIZE)
+
+struct GumboInternalArena {
+  // Most recently allocated chunk first.
+  ArenaChunk* chunks;
+  // Free space remaining in the current chunk.
+  char* cursor;
+  char* limit;
+  // The most recent allocation, which can be grown or released in place.
+  char* last;
+  size_t next_chunk_size;
+};
+
+static void* XMALLOC checked_malloc(size_t size) {
+  void* ptr = malloc(size);
+  if (unlikely(ptr == NULL)) {
+    perror(__func__);
+    abort();
+  }
+  return ptr;
+}
+
+GumboArena* gumbo_arena_new(void) {
+  GumboArena* arena = checked_malloc(sizeof(GumboArena));
+  arena->chunks = NULL;
+  arena->cursor = NULL;
+  arena->limit = NULL;
+  arena->last = NULL;
+  arena->next_chunk_size = kInitialChunkSize;
+  return arena;
+}
+
+void gumbo_arena_destroy(GumboArena* arena) {
+  ArenaChunk* chunk = arena->chunks;
+  while (chunk) {
+    ArenaChunk* next = chunk->next;
+    free(chunk);
+    chunk = next;
+  }
+  free(arena);
+}
+
+static void add_chunk(GumboArena* arena, size_t min_size) {
+  size_t size = arena->next_chunk_size;
+  while (size < min_size) {
+    size *= 2;
+  }
+  if (arena->next_chunk_size < kMaxChunkSize) {
+    arena->next_chunk_size *= 2;
+  }
+  ArenaChunk* chunk = checked_malloc(CHUNK_HEADER_SIZE + size);
+  chunk->next = arena->chunks;
+  chunk->size = size;
+  arena->chunks = chunk;
+  arena->cursor = CHUNK_DATA(chunk);
+  arena->limit = arena->cursor + size;
+}
+
+void* gumbo_arena_alloc(GumboArena* arena, size_t size) {
+  size = size ? ARENA_ROUND_UP(size) : ARENA_ALIGNMENT;
+  if (unlikely((size_t) (arena->limit - arena->cursor) < size)) {
+    add_chunk(arena, size);
+  }
+  arena->last = arena->cursor;
+  arena->cursor += size;
+  return arena->last;
+}
+
+void* gumbo_arena_realloc (
+  GumboArena* arena,
+  void* ptr,
+  size_t old_size,
+  size_t new_size
+) {
+  if (ptr == arena->last) {
+    size_t available = arena->limit - arena->last;
+    if (ARENA_ROUND_UP(new_size) <= available) {
+      arena->cursor = arena->last + ARENA_ROUND_UP(new_size);
+      return ptr;
+    }
+  }
+  void* new_ptr = gumbo_arena_alloc(arena, new_size);
+  memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+  return new_ptr;
+}
+
+void gumbo_arena_free(GumboArena* arena, void* ptr) {
+  if (ptr == arena->last) {
+    arena->cursor = arena->last;
+    arena->last = NULL;
+  }
+}
+
+void gumbo_arena_adopt(GumboArena* arena, GumboArena* other) {
+  ArenaChunk* chunks = other->chunks;
+  free(other);
+  if (!chunks) {
+    return;
+  }
+  ArenaChunk* last = chunks;
+  while (last->next) {
+    last = last->next;
+  }
+  if (arena->chunks) {
+    last->next = arena->chunks->next;
+    arena->chunks->next = chunks;
+  } else {
+    // The cursor stays empty, so the next allocation starts a chunk of its own
+    // rather than using what's left of the adopted ones.
+    arena->chunks = chunks;
+  }
+}
+
+bool gumbo_arena_owns(const GumboArena* arena, const void* ptr) {
+  const char* p = ptr;
+  for (const ArenaChunk* chunk = arena->chunks; chunk; chunk = chunk->next) {
+    const char* data = CHUNK_DATA(chunk);
+    if (p >= data && p < data + chunk->size) {
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,49 @@
+#ifndef GUMBO_ARENA_H_
+#define GUMBO_ARENA_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "gumbo.h"
+#include "macros.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A region ("bump") allocator. Memory is carved sequentially out of large
+// chunks and is only returned to the system when the whole arena is
+// destroyed. Freeing or resizing the most recent allocation is done in place;
+// any other free is a no-op.
+typedef struct GumboInternalArena GumboArena;
+
+// Creates a new, empty arena. The first chunk is allocated lazily.
+GumboArena* gumbo_arena_new(void) XMALLOC;
+
+// Releases every chunk owned by the arena, and the arena itself.
+void gumbo_arena_destroy(GumboArena* arena);
+
+void* gumbo_arena_alloc(GumboArena* arena, size_t size) XMALLOC NONNULL_ARGS;
+
+// Resizes an allocation previously returned by this arena. `old_size` must be
+// the size it was allocated (or last resized) with.
+void* gumbo_arena_realloc (
+  GumboArena* arena,
+  void* ptr,
+  size_t old_size,
+  size_t new_size
+) RETURNS_NONNULL NONNULL_ARGS;
+
+void gumbo_arena_free(GumboArena* arena, void* ptr) NONNULL_ARGS;
+
+// Hands every chunk owned by `other` over to `arena`, which keeps allocating
+// from its current chunk, and destroys `other`.
+void gumbo_arena_adopt(GumboArena* arena, GumboArena* other) NONNULL_ARGS;
+
+// Returns true if `ptr` points into one of the arena's chunks.
+bool gumbo_arena_owns(const GumboArena* arena, const void* ptr) PURE;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUMBO_ARENA_H_
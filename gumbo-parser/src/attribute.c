@@ -16,6 +16,7 @@
 */
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include "attribute.h"
@@ -28,15 +29,119 @@ GumboAttribute* gumbo_get_attribute (
 ) {
   for (unsigned int i = 0; i < attributes->length; ++i) {
     GumboAttribute* attr = attributes->data[i];
-    if (!gumbo_ascii_strcasecmp(attr->name, name)) {
+    if (attr->name == name || !gumbo_ascii_strcasecmp(attr->name, name)) {
       return attr;
     }
   }
   return NULL;
 }
 
+GumboAttribute* gumbo_get_interned_attribute (
+  const GumboVector* attributes,
+  const char* name
+) {
+  for (unsigned int i = 0; name && i < attributes->length; ++i) {
+    GumboAttribute* attr = attributes->data[i];
+    if (attr->name == name) {
+      return attr;
+    }
+  }
+  return NULL;
+}
+
+// An open-addressing hash table, which is never more than half full. Each
+// slot holds one more than the index of an attribute in the element's
+// attributes, or 0 if it's empty.
+struct GumboInternalAttributeIndex {
+  // The number of attributes indexed, which is checked before the index is
+  // used.
+  unsigned int length;
+  unsigned int mask;
+  unsigned int slots[];
+};
+
+// Searching fewer attributes than this is about as quick as hashing the name.
+static const unsigned int kMinIndexedAttributes = 8;
+
+// FNV-1a, ignoring ASCII case.
+static uint32_t hash_attribute_name(const char* name) {
+  uint32_t hash = 2166136261u;
+  for (const char* c = name; *c; ++c) {
+    hash = (hash ^ (unsigned char) gumbo_ascii_tolower(*c)) * 16777619u;
+  }
+  return hash;
+}
+
+// Returns the position of the slot for `name`: either the one holding the first
+// attribute with that name or the empty slot where it belongs.
+static unsigned int find_index_slot (
+  const GumboAttributeIndex* index,
+  const GumboVector* attributes,
+  const char* name
+) {
+  unsigned int i = hash_attribute_name(name) & index->mask;
+  for (; index->slots[i]; i = (i + 1) & index->mask) {
+    const GumboAttribute* attr = attributes->data[index->slots[i] - 1];
+    if (attr->name == name || !gumbo_ascii_strcasecmp(attr->name, name)) {
+      break;
+    }
+  }
+  return i;
+}
+
+void gumbo_index_attributes(GumboElement* element) {
+  gumbo_free(element->attribute_index);
+  element->attribute_index = NULL;
+  const GumboVector* attributes = &element->attributes;
+  if (attributes->length < kMinIndexedAttributes) {
+    return;
+  }
+  unsigned int capacity = 2 * kMinIndexedAttributes;
+  while (capacity < 2 * attributes->length) {
+    capacity *= 2;
+  }
+  GumboAttributeIndex* index = gumbo_alloc (
+    sizeof(GumboAttributeIndex) + capacity * sizeof(unsigned int)
+  );
+  index->length = attributes->length;
+  index->mask = capacity - 1;
+  memset(index->slots, 0, capacity * sizeof(unsigned int));
+  for (unsigned int i = 0; i < attributes->length; ++i) {
+    const GumboAttribute* attr = attributes->data[i];
+    unsigned int slot = find_index_slot(index, attributes, attr->name);
+    // Any earlier attribute with the same name is the one that's found.
+    if (index->slots[slot] == 0) {
+      index->slots[slot] = i + 1;
+    }
+  }
+  element->attribute_index = index;
+}
+
+GumboAttribute* gumbo_element_get_attribute (
+  const GumboElement* element,
+  const char* name
+) {
+  const GumboAttributeIndex* index = element->attribute_index;
+  if (!index || index->length != element->attributes.length) {
+    return gumbo_get_attribute(&element->attributes, name);
+  }
+  const GumboVector* attributes = &element->attributes;
+  unsigned int i = index->slots[find_index_slot(index, attributes, name)];
+  return i ? attributes->data[i - 1] : NULL;
+}
+
+bool gumbo_attribute_owns_value(const GumboAttribute* attribute) {
+  // Shared values lie within the original value, after any opening quote.
+  const char* original = attribute->original_value.data;
+  return
+    attribute->value < original
+    || attribute->value > original + attribute->original_value.length;
+}
+
 void gumbo_destroy_attribute(GumboAttribute* attribute) {
-  gumbo_free((void*) attribute->name);
-  gumbo_free((void*) attribute->value);
+  // The name is interned, and owned by the GumboOutput.
+  if (gumbo_attribute_owns_value(attribute)) {
+    gumbo_free((void*) attribute->value);
+  }
   gumbo_free((void*) attribute);
 }
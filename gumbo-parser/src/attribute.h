@@ -1,12 +1,23 @@
 #ifndef GUMBO_ATTRIBUTE_H_
 #define GUMBO_ATTRIBUTE_H_
 
+#include <stdbool.h>
 #include "gumbo.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+typedef struct GumboInternalAttributeIndex GumboAttributeIndex;
+
+// Replaces the element's attribute_index with one for its current attributes,
+// or with NULL if it has too few to be worth indexing.
+void gumbo_index_attributes(GumboElement* element);
+
+// Returns false if the attribute's value is shared with the source buffer (see
+// GumboOptions.zero_copy_text) rather than allocated.
+bool gumbo_attribute_owns_value(const GumboAttribute* attribute);
+
 // Release the memory used for a GumboAttribute, including the attribute itself
 void gumbo_destroy_attribute(GumboAttribute* attribute);
 
@@ -0,0 +1,214 @@
+// sysconf(3) and POSIX threads aren't part of C99.
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include "gumbo.h"
+#include "macros.h"
+#include "util.h"
+
+#if HAVE_PTHREADS
+# include <pthread.h>
+# include <unistd.h>
+#endif
+
+// Each worker has a queue of document indices. The documents are dealt out to
+// the queues largest first, so every worker starts with a large document and
+// the small ones are left for the end, where they even out the finishing
+// times. A worker that empties its own queue steals from the back of the
+// others, so one very large document only ties up the worker parsing it.
+typedef struct {
+#if HAVE_PTHREADS
+  pthread_mutex_t lock;
+#endif
+  size_t* items;
+  size_t head;
+  size_t tail;
+} WorkQueue;
+
+typedef struct {
+  const GumboOptions* options;
+  const char* const* buffers;
+  const size_t* lengths;
+  GumboOutput** outputs;
+  WorkQueue* queues;
+  unsigned int num_workers;
+} Batch;
+
+typedef struct {
+  Batch* batch;
+  unsigned int id;
+} Worker;
+
+typedef struct {
+  size_t length;
+  size_t index;
+} DocumentSize;
+
+static void lock_queue(WorkQueue* queue) {
+#if HAVE_PTHREADS
+  pthread_mutex_lock(&queue->lock);
+#else
+  (void) queue;
+#endif
+}
+
+static void unlock_queue(WorkQueue* queue) {
+#if HAVE_PTHREADS
+  pthread_mutex_unlock(&queue->lock);
+#else
+  (void) queue;
+#endif
+}
+
+static int compare_sizes(const void* a, const void* b) {
+  const DocumentSize* x = a;
+  const DocumentSize* y = b;
+  if (x->length != y->length) {
+    return x->length > y->length ? -1 : 1;
+  }
+  // Keeps the order of equal-sized documents stable.
+  return x->index < y->index ? -1 : x->index > y->index;
+}
+
+// Takes the next document from the front of the worker's own queue or, once
+// that's empty, from the back of another worker's. Returns false when there's
+// nothing left anywhere.
+static bool next_document(Batch* batch, unsigned int id, size_t* document) {
+  for (unsigned int i = 0; i < batch->num_workers; ++i) {
+    WorkQueue* queue = &batch->queues[(id + i) % batch->num_workers];
+    bool found = false;
+    lock_queue(queue);
+    if (queue->head < queue->tail) {
+      *document = i == 0 ? queue->items[queue->head++]
+                         : queue->items[--queue->tail];
+      found = true;
+    }
+    unlock_queue(queue);
+    if (found) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void* run_worker(void* arg) {
+  Worker* worker = arg;
+  Batch* batch = worker->batch;
+  // Every worker reuses one parser for all of its documents (see
+  // gumbo_parser_parse).
+  GumboParser* parser = gumbo_parser_new(batch->options);
+  size_t document;
+  while (next_document(batch, worker->id, &document)) {
+    batch->outputs[document] = gumbo_parser_parse (
+      parser,
+      batch->buffers[document],
+      batch->lengths[document]
+    );
+  }
+  gumbo_parser_destroy(parser);
+  return NULL;
+}
+
+static unsigned int default_num_threads(void) {
+#if HAVE_PTHREADS && defined(_SC_NPROCESSORS_ONLN)
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  if (cpus > 0) {
+    return cpus;
+  }
+#endif
+  return 1;
+}
+
+void gumbo_parse_batch (
+  const GumboOptions* options,
+  const char* const* buffers,
+  const size_t* lengths,
+  size_t count,
+  unsigned int num_threads,
+  GumboOutput** outputs
+) {
+  if (count == 0) {
+    return;
+  }
+  if (num_threads == 0) {
+    num_threads = default_num_threads();
+  }
+  if (num_threads > count) {
+    num_threads = count;
+  }
+#if !HAVE_PTHREADS
+  num_threads = 1;
+#endif
+
+  GumboArena* previous_arena = gumbo_set_arena(NULL);
+  DocumentSize* sizes = gumbo_alloc(count * sizeof(DocumentSize));
+  for (size_t i = 0; i < count; ++i) {
+    sizes[i].length = lengths[i];
+    sizes[i].index = i;
+  }
+  qsort(sizes, count, sizeof(DocumentSize), compare_sizes);
+
+  // All the queues share one array of indices, worker i's being every
+  // num_threads'th document starting at the i'th largest.
+  size_t* items = gumbo_alloc(count * sizeof(size_t));
+  WorkQueue* queues = gumbo_alloc(num_threads * sizeof(WorkQueue));
+  size_t next_item = 0;
+  for (unsigned int i = 0; i < num_threads; ++i) {
+    WorkQueue* queue = &queues[i];
+#if HAVE_PTHREADS
+    pthread_mutex_init(&queue->lock, NULL);
+#endif
+    queue->items = items + next_item;
+    queue->head = 0;
+    for (size_t j = i; j < count; j += num_threads) {
+      items[next_item++] = sizes[j].index;
+    }
+    queue->tail = items + next_item - queue->items;
+  }
+  gumbo_free(sizes);
+
+  // One set of stats can't be shared by several parses at once.
+  GumboOptions batch_options = *options;
+  batch_options.stats = NULL;
+  Batch batch = {
+    .options = &batch_options,
+    .buffers = buffers,
+    .lengths = lengths,
+    .outputs = outputs,
+    .queues = queues,
+    .num_workers = num_threads
+  };
+  Worker* workers = gumbo_alloc(num_threads * sizeof(Worker));
+  for (unsigned int i = 0; i < num_threads; ++i) {
+    workers[i].batch = &batch;
+    workers[i].id = i;
+  }
+
+  // The calling thread is worker 0. If a thread can't be started, its queue
+  // is simply left for the others to steal from.
+#if HAVE_PTHREADS
+  pthread_t* threads = gumbo_alloc(num_threads * sizeof(pthread_t));
+  bool* started = gumbo_alloc(num_threads * sizeof(bool));
+  for (unsigned int i = 1; i < num_threads; ++i) {
+    started[i] = !pthread_create(&threads[i], NULL, run_worker, &workers[i]);
+  }
+#endif
+  run_worker(&workers[0]);
+#if HAVE_PTHREADS
+  for (unsigned int i = 1; i < num_threads; ++i) {
+    if (started[i]) {
+      pthread_join(threads[i], NULL);
+    }
+  }
+  for (unsigned int i = 0; i < num_threads; ++i) {
+    pthread_mutex_destroy(&queues[i].lock);
+  }
+  gumbo_free(started);
+  gumbo_free(threads);
+#endif
+
+  gumbo_free(workers);
+  gumbo_free(queues);
+  gumbo_free(items);
+  gumbo_set_arena(previous_arena);
+}
@@ -211,6 +211,7 @@ static bool maybe_add_invalid_named_reference (
 
 
 
+#ifdef GUMBO_RAGEL_CHAR_REFS
 static const short _char_ref_actions[] = {
 	0, 1, 0, 1, 1, 1, 2, 1, 
 	3, 1, 4, 1, 5, 1, 6, 1, 
@@ -13942,34 +13943,16 @@ static const int char_ref_en_valid_named_ref = 7623;
 
 
 
-static const unsigned char ascii_alnum_table[256] = {
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //   0.. 15
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //  16.. 31
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //  32.. 47
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, //  48.. 63
-  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //  64.. 79
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, //  80.. 95
-  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //  96..111
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, // 112..127
-  // 128..255: implicitly zero
-};
-
-static inline bool PURE ascii_isalnum(unsigned char ch) {
-  return ascii_alnum_table[ch];
-}
-
-static bool consume_named_ref (
-  struct GumboInternalParser* parser,
-  Utf8Iterator* input,
-  bool is_in_attribute,
+size_t gumbo_match_named_char_ref_ragel (
+  const char* data,
+  size_t length,
   OneOrTwoCodepoints* output
 ) {
-  assert(output->first == kGumboNoChar);
-  const char* p = utf8iterator_get_char_pointer(input);
-  const char* pe = utf8iterator_get_end_pointer(input);
+  const char* p = data;
+  const char* pe = data + length;
   const char* eof = pe;
   const char* te = 0;
-  const char *ts, *start;
+  const char* ts;
   int cs, act;
 
   
@@ -13985,7 +13968,6 @@ static bool consume_named_ref (
   (void) ts;
   (void) char_ref_en_valid_named_ref;
 
-  start = p;
   
 	{
 	int _slen;
@@ -20779,24 +20761,58 @@ _again:
 	_out: {}
 	}
 
+  return cs >= 7623 && te ? te - data : 0;
+}
+#endif
+
+static const unsigned char ascii_alnum_table[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //   0.. 15
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //  16.. 31
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //  32.. 47
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, //  48.. 63
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //  64.. 79
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, //  80.. 95
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //  96..111
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, // 112..127
+  // 128..255: implicitly zero
+};
+
+static inline bool PURE ascii_isalnum(unsigned char ch) {
+  return ascii_alnum_table[ch];
+}
+
+static bool consume_named_ref (
+  struct GumboInternalParser* parser,
+  Utf8Iterator* input,
+  bool is_in_attribute,
+  OneOrTwoCodepoints* output
+) {
+  assert(output->first == kGumboNoChar);
+  const char* start = utf8iterator_get_char_pointer(input);
+  const char* end = utf8iterator_get_end_pointer(input);
+  size_t len = gumbo_match_named_char_ref(start, end - start, output);
 
-  if (cs >= 7623) {
+  if (len) {
     assert(output->first != kGumboNoChar);
-    char last_char = *(te - 1);
-    size_t len = te - start;
+    const char* next = start + len;
+    char last_char = *(next - 1);
     if (last_char == ';') {
       bool matched = utf8iterator_maybe_consume_match(input, start, len, true);
       assert(matched);
       UNUSED_IF_NDEBUG(matched);
       return true;
-    } else if (is_in_attribute && (*te == '=' || ascii_isalnum(*te))) {
+    } else if (
+      is_in_attribute
+      && next < end
+      && (*next == '=' || ascii_isalnum(*next))
+    ) {
       output->first = kGumboNoChar;
       output->second = kGumboNoChar;
       utf8iterator_reset(input);
       return true;
     } else {
       GumboStringPiece bad_ref;
-      bad_ref.length = te - start;
+      bad_ref.length = len;
       bad_ref.data = start;
       add_named_reference_error (
         parser,
@@ -2,6 +2,7 @@
 #define GUMBO_CHAR_REF_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,6 +38,26 @@ bool gumbo_consume_char_ref (
   OneOrTwoCodepoints* output
 );
 
+// Looks up the longest named character reference (without the leading '&')
+// that is a prefix of the `length` bytes at `data`. Returns its length and
+// fills in `output`, or returns 0 and leaves `output` alone if there is none.
+size_t gumbo_match_named_char_ref (
+  const char* data,
+  size_t length,
+  OneOrTwoCodepoints* output
+);
+
+#ifdef GUMBO_RAGEL_CHAR_REFS
+// The same, using the state machine generated by Ragel from char_ref.rl. Only
+// built for comparison with gumbo_match_named_char_ref (see
+// benchmark/char_ref.c).
+size_t gumbo_match_named_char_ref_ragel (
+  const char* data,
+  size_t length,
+  OneOrTwoCodepoints* output
+);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -207,6 +207,7 @@ static bool maybe_add_invalid_named_reference (
   return true;
 }
 
+#ifdef GUMBO_RAGEL_CHAR_REFS
 %%{
 machine char_ref;
 
@@ -2447,6 +2448,30 @@ valid_named_ref := |*
 
 %% write data noerror nofinal;
 
+size_t gumbo_match_named_char_ref_ragel (
+  const char* data,
+  size_t length,
+  OneOrTwoCodepoints* output
+) {
+  const char* p = data;
+  const char* pe = data + length;
+  const char* eof = pe;
+  const char* te = 0;
+  const char* ts;
+  int cs, act;
+
+  %% write init;
+  // Avoid unused variable warnings.
+  (void) act;
+  (void) ts;
+  (void) char_ref_en_valid_named_ref;
+
+  %% write exec;
+
+  return cs >= %%{ write first_final; }%% && te ? te - data : 0;
+}
+#endif
+
 static const unsigned char ascii_alnum_table[256] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //   0.. 15
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //  16.. 31
@@ -2470,39 +2495,31 @@ static bool consume_named_ref (
   OneOrTwoCodepoints* output
 ) {
   assert(output->first == kGumboNoChar);
-  const char* p = utf8iterator_get_char_pointer(input);
-  const char* pe = utf8iterator_get_end_pointer(input);
-  const char* eof = pe;
-  const char* te = 0;
-  const char *ts, *start;
-  int cs, act;
-
-  %% write init;
-  // Avoid unused variable warnings.
-  (void) act;
-  (void) ts;
-  (void) char_ref_en_valid_named_ref;
-
-  start = p;
-  %% write exec;
+  const char* start = utf8iterator_get_char_pointer(input);
+  const char* end = utf8iterator_get_end_pointer(input);
+  size_t len = gumbo_match_named_char_ref(start, end - start, output);
 
-  if (cs >= %%{ write first_final; }%%) {
+  if (len) {
     assert(output->first != kGumboNoChar);
-    char last_char = *(te - 1);
-    size_t len = te - start;
+    const char* next = start + len;
+    char last_char = *(next - 1);
     if (last_char == ';') {
       bool matched = utf8iterator_maybe_consume_match(input, start, len, true);
       assert(matched);
       UNUSED_IF_NDEBUG(matched);
       return true;
-    } else if (is_in_attribute && (*te == '=' || ascii_isalnum(*te))) {
+    } else if (
+      is_in_attribute
+      && next < end
+      && (*next == '=' || ascii_isalnum(*next))
+    ) {
       output->first = kGumboNoChar;
       output->second = kGumboNoChar;
       utf8iterator_reset(input);
       return true;
     } else {
       GumboStringPiece bad_ref;
-      bad_ref.length = te - start;
+      bad_ref.length = len;
       bad_ref.data = start;
       add_named_reference_error (
         parser,
@@ -19,6 +19,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include "arena.h"
 #include "error.h"
 #include "gumbo.h"
 #include "macros.h"
@@ -86,17 +87,26 @@ static int PRINTF(2) print_message (
   return bytes_written;
 }
 
+// Prints the tags from the bottom of the stack up to `entry`. The stack is
+// no deeper than the parser's depth limit.
+static void print_tag_stack_entries (
+  const GumboTagStack* entry,
+  GumboStringBuffer* output
+) {
+  if (entry->below) {
+    print_tag_stack_entries(entry->below, output);
+    print_message(output, ", ");
+  }
+  print_message(output, "%s", gumbo_normalized_tagname(entry->tag));
+}
+
 static void print_tag_stack (
   const GumboParserError* error,
   GumboStringBuffer* output
 ) {
   print_message(output, "  Currently open tags: ");
-  for (unsigned int i = 0; i < error->tag_stack.length; ++i) {
-    if (i) {
-      print_message(output, ", ");
-    }
-    GumboTag tag = (GumboTag) error->tag_stack.data[i];
-    print_message(output, "%s", gumbo_normalized_tagname(tag));
+  if (error->tag_stack) {
+    print_tag_stack_entries(error->tag_stack, output);
   }
   gumbo_string_buffer_append_codepoint('.', output);
 }
@@ -181,23 +191,45 @@ static const char* find_next_newline(
   return c;
 }
 
+static GumboArena* error_arena(GumboOutput* output) {
+  if (!output->error_arena) {
+    output->error_arena = gumbo_arena_new();
+  }
+  return output->error_arena;
+}
+
 GumboError* gumbo_add_error(GumboParser* parser) {
   int max_errors = parser->_options->max_errors;
-  if (max_errors >= 0 && parser->_output->errors.length >= (unsigned int) max_errors) {
+  GumboOutput* output = parser->_output;
+  if (max_errors >= 0 && output->errors.length >= (unsigned int) max_errors) {
     return NULL;
   }
-  GumboError* error = gumbo_alloc(sizeof(GumboError));
-  gumbo_vector_add(error, &parser->_output->errors);
+  GumboError* error =
+    gumbo_arena_alloc(error_arena(output), sizeof(GumboError));
+  gumbo_vector_add(error, &output->errors);
   return error;
 }
 
+GumboTagStack* gumbo_add_error_tag_stack(GumboParser* parser) {
+  return gumbo_arena_alloc(error_arena(parser->_output), sizeof(GumboTagStack));
+}
+
+void gumbo_remove_last_error(GumboParser* parser) {
+  GumboOutput* output = parser->_output;
+  GumboError* error = gumbo_vector_pop(&output->errors);
+  gumbo_error_destroy(error);
+  // Only reclaimed if nothing has been allocated after it, which is the usual
+  // case for the UTF-8 errors this is used for.
+  gumbo_arena_free(output->error_arena, error);
+}
+
 void gumbo_error_to_string (
   const GumboError* error,
   GumboStringBuffer* output
 ) {
   print_message (
     output,
-    "@%zu:%zu: ",
+    "@%u:%u: ",
     error->position.line,
     error->position.column
   );
@@ -337,25 +369,24 @@ void gumbo_print_caret_diagnostic (
 }
 
 void gumbo_error_destroy(GumboError* error) {
-  if (
-    error->type == GUMBO_ERR_PARSER
-    || error->type == GUMBO_ERR_UNACKNOWLEDGED_SELF_CLOSING_TAG
-    || error->type == GUMBO_ERR_SELF_CLOSING_END_TAG
-  ) {
-    gumbo_vector_destroy(&error->v.parser.tag_stack);
-  } else if (error->type == GUMBO_ERR_DUPLICATE_ATTR) {
+  if (error->type == GUMBO_ERR_DUPLICATE_ATTR) {
     gumbo_free((void*) error->v.duplicate_attr.name);
   }
-  gumbo_free(error);
 }
 
 void gumbo_init_errors(GumboParser* parser) {
+  parser->_output->error_arena = NULL;
   gumbo_vector_init(5, &parser->_output->errors);
 }
 
 void gumbo_destroy_errors(GumboParser* parser) {
-  for (unsigned int i = 0; i < parser->_output->errors.length; ++i) {
-    gumbo_error_destroy(parser->_output->errors.data[i]);
+  GumboOutput* output = parser->_output;
+  for (unsigned int i = 0; i < output->errors.length; ++i) {
+    gumbo_error_destroy(output->errors.data[i]);
+  }
+  gumbo_vector_destroy(&output->errors);
+  if (output->error_arena) {
+    gumbo_arena_destroy(output->error_arena);
+    output->error_arena = NULL;
   }
-  gumbo_vector_destroy(&parser->_output->errors);
 }
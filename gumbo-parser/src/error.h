@@ -105,6 +105,16 @@ typedef struct GumboInternalTokenizerError {
   GumboTokenizerErrorState state;
 } GumboTokenizerError;
 
+// A snapshot of the tags on the stack of open elements, as a list from the
+// current node down. Snapshots are never changed once made, so the errors
+// raised while the bottom of the stack stays the same share that part of it.
+typedef struct GumboInternalTagStack {
+  // The rest of the stack, below this tag. NULL at the bottom.
+  const struct GumboInternalTagStack* below;
+
+  GumboTag tag;
+} GumboTagStack;
+
 // Additional data for parse errors.
 typedef struct GumboInternalParserError {
   // The type of input token that resulted in this error.
@@ -116,10 +126,9 @@ typedef struct GumboInternalParserError {
   // The insertion mode that the parser was in at the time.
   GumboInsertionMode parser_state;
 
-  // The tag stack at the point of the error. Note that this is an GumboVector
-  // of GumboTag's *stored by value* - cast the void* to an GumboTag directly to
-  // get at the tag.
-  GumboVector /* GumboTag */ tag_stack;
+  // The tag stack at the point of the error, from the current node down, or
+  // NULL if no elements were open. It belongs to the output's error arena.
+  const GumboTagStack* tag_stack;
 } GumboParserError;
 
 // The overall error struct representing an error in decoding/tokenizing/parsing
@@ -165,16 +174,26 @@ typedef struct GumboInternalError {
 
 // Adds a new error to the parser's error list, and returns a pointer to it so
 // that clients can fill out the rest of its fields. May return NULL if we're
-// already over the max_errors field specified in GumboOptions.
+// already over the max_errors field specified in GumboOptions. Errors are
+// allocated one after another in the output's error arena.
 GumboError* gumbo_add_error(struct GumboInternalParser* parser);
 
+// Allocates a tag stack entry in the output's error arena.
+GumboTagStack* gumbo_add_error_tag_stack(struct GumboInternalParser* parser);
+
+// Removes the most recently added error from the parser's error list and
+// frees it.
+void gumbo_remove_last_error(struct GumboInternalParser* parser);
+
 // Initializes the errors vector in the parser.
 void gumbo_init_errors(struct GumboInternalParser* errors);
 
-// Frees all the errors in the 'errors_' field of the parser.
+// Frees all the errors in the 'errors_' field of the parser, and the arena
+// they're in. Only for outputs without an arena of their own.
 void gumbo_destroy_errors(struct GumboInternalParser* errors);
 
-// Frees the memory used for a single GumboError.
+// Frees the memory owned by a single GumboError. The error itself is part of
+// its output's error arena, and is released with it.
 void gumbo_error_destroy(GumboError* error);
 
 // Prints an error to a string. This fills an empty GumboStringBuffer with a
@@ -39,12 +39,14 @@ extern "C" {
 /**
  * A struct representing a character position within the original text
  * buffer. Line and column numbers are 1-based and offsets are 0-based,
- * which matches how most editors and command-line tools work.
+ * which matches how most editors and command-line tools work. The fields
+ * are 32 bits wide to keep nodes small, so positions past the first
+ * 4 GiB of input wrap around.
  */
 typedef struct {
-  size_t line;
-  size_t column;
-  size_t offset;
+  unsigned int line;
+  unsigned int column;
+  unsigned int offset;
 } GumboSourcePosition;
 
 /**
@@ -354,8 +356,10 @@ typedef struct {
   GumboAttributeNamespaceEnum attr_namespace;
 
   /**
-   * The name of the attribute. This is in a freshly-allocated buffer to
-   * deal with case-normalization and is null-terminated.
+   * The name of the attribute. This is case-normalized and
+   * null-terminated. Names are interned, so every attribute with the
+   * same name in a parse tree shares the same string, which is owned by
+   * the `GumboOutput` (see `gumbo_interned_name`).
    */
   const char* name;
 
@@ -371,9 +375,16 @@ typedef struct {
    * any quotes that surround the attribute. If the attribute has no
    * value (for example, `selected` on a checkbox) this will be an empty
    * string.
+   *
+   * When parsed with `GumboOptions.zero_copy_text`, a value that needed no
+   * decoding points into the original source buffer instead, and is not
+   * null-terminated.
    */
   const char* value;
 
+  /** The length of `value` in bytes, not counting any null terminator. */
+  size_t value_length;
+
   /**
    * The original text of the value of the attribute. This points into
    * the original source buffer. It includes any quotes that surround
@@ -408,6 +419,16 @@ typedef struct {
  */
 GumboAttribute* gumbo_get_attribute(const GumboVector* attrs, const char* name);
 
+/**
+ * Like `gumbo_get_attribute`, but compares names by pointer, so `name`
+ * must come from `gumbo_interned_name` for the output that `attrs` is
+ * part of. Returns `NULL` if `name` is `NULL`.
+ */
+GumboAttribute* gumbo_get_interned_attribute (
+  const GumboVector* attrs,
+  const char* name
+);
+
 /**
  * Enum denoting the type of node. This determines the type of the
  * `node.v` union.
@@ -581,9 +602,16 @@ typedef struct {
    * The text of this node, after entities have been parsed and decoded.
    * For comment and cdata nodes, this does not include the comment
    * delimiters.
+   *
+   * When parsed with `GumboOptions.zero_copy_text`, the text of a text or
+   * whitespace node that needed no decoding points into the original
+   * source buffer instead of being copied, and is not null-terminated.
    */
   const char* text;
 
+  /** The length of `text` in bytes, not counting any null terminator. */
+  size_t text_length;
+
   /**
    * The original text of this node, as a pointer into the original
    * buffer. For comment/cdata nodes, this includes the comment
@@ -605,19 +633,24 @@ typedef struct {
 typedef struct {
   /**
    * An array of `GumboNode`s, containing the children of this element.
-   * Pointers are owned.
+   * Pointers are owned. The first few are stored in the same allocation
+   * as the element itself.
    */
   GumboVector /* GumboNode* */ children;
 
   /** The GumboTag enum for this element. */
   GumboTag tag;
 
-  /** The name for this element. */
-  const char* name;
-
   /** The GumboNamespaceEnum for this element. */
   GumboNamespaceEnum tag_namespace;
 
+  /**
+   * The name for this element. For known tags this is static data owned
+   * by the library; the names of unknown tags are interned, like
+   * attribute names.
+   */
+  const char* name;
+
   /**
    * A `GumboStringPiece` pointing to the original tag text for this
    * element, pointing directly into the source buffer. If the tag was
@@ -644,8 +677,27 @@ typedef struct {
    * tag in the order that they were parsed. Pointers are owned.
    */
   GumboVector /* GumboAttribute* */ attributes;
+
+  /**
+   * A hash index of `attributes` by name, used by
+   * `gumbo_element_get_attribute`. Only built when parsing with
+   * `GumboOptions.index_attributes`, for elements with enough attributes
+   * to benefit, and `NULL` otherwise. Owned.
+   */
+  struct GumboInternalAttributeIndex* attribute_index;
 } GumboElement;
 
+/**
+ * Like `gumbo_get_attribute`, for the attributes of `element`, but
+ * uses the element's `attribute_index` if it has one. An index is
+ * ignored once attributes have been added to or removed from the
+ * element, and mustn't be relied on if any have been renamed.
+ */
+GumboAttribute* gumbo_element_get_attribute (
+  const GumboElement* element,
+  const char* name
+);
+
 /**
  * A supertype for `GumboElement` and `GumboText`, so that we can
  * include one generic type in lists of children and cast as necessary
@@ -668,7 +720,11 @@ struct GumboInternalNode {
    */
   GumboParseFlags parse_flags;
 
-  /** The actual node data. */
+  /**
+   * The actual node data. Only the member for the node's type is
+   * allocated, so text and comment nodes are much smaller than
+   * `sizeof(GumboNode)` and must not be copied as a whole.
+   */
   union {
     GumboDocument document;  // For GUMBO_NODE_DOCUMENT.
     GumboElement element;    // For GUMBO_NODE_ELEMENT.
@@ -676,6 +732,105 @@ struct GumboInternalNode {
   } v;
 };
 
+/**
+ * Callbacks for the event-driven output mode, enabled by setting
+ * `GumboOptions.callbacks`. Nodes are reported as tree construction
+ * creates them, after implied tags, foster parenting and the like have
+ * been dealt with, so an element's `parent` is where it was inserted.
+ * Nodes that are moved afterwards by the adoption agency algorithm
+ * aren't reported again. Any callback may be `NULL`.
+ *
+ * A node is owned by the parser and may be freed once the callback it's
+ * passed to has returned, except that an element stays valid until its
+ * `end_element` callback has returned.
+ */
+typedef struct GumboInternalCallbacks {
+  /** Passed as the first argument to each callback. */
+  void* userdata;
+
+  /** Called when an element has been inserted into the tree. */
+  void (*start_element)(void* userdata, const GumboNode* element);
+
+  /**
+   * Called when an element is closed, with its `end_pos` and
+   * `original_end_tag` filled in. Every element that's started is
+   * eventually ended, in the reverse order unless the markup is
+   * misnested.
+   */
+  void (*end_element)(void* userdata, const GumboNode* element);
+
+  /**
+   * Called for a text, whitespace or CDATA node once all of its
+   * characters have been seen.
+   */
+  void (*characters)(void* userdata, const GumboNode* text);
+
+  /** Called for a comment node. */
+  void (*comment)(void* userdata, const GumboNode* comment);
+} GumboCallbacks;
+
+/** The number of insertion modes in the HTML tree construction algorithm. */
+#define GUMBO_NUM_INSERTION_MODES 23
+
+/**
+ * Statistics about a single parse, filled in when `GumboOptions.stats`
+ * points to one. Everything is reset when the parse starts. Gathering
+ * them reads the clock around every token, so they're meant for finding
+ * out why a particular document is slow rather than for routine use.
+ */
+typedef struct GumboInternalParseStats {
+  /**
+   * The tokens handled by tree construction, by type. A run of text that
+   * the tokenizer emits in one go counts as one token.
+   */
+  struct {
+    size_t doctype;
+    size_t start_tag;
+    size_t end_tag;
+    size_t comment;
+    size_t whitespace;
+    size_t character;
+    size_t cdata;
+    size_t null;
+    size_t eof;
+  } tokens;
+
+  /**
+   * The nodes created, indexed by `GumboNodeType`. This includes nodes
+   * that were later removed from the tree, such as the clones made by the
+   * adoption agency algorithm.
+   */
+  size_t nodes[GUMBO_NODE_TEMPLATE + 1];
+
+  /**
+   * The memory allocated by the parser on the calling thread, counting
+   * each allocation's full size and only the growth of each resize.
+   */
+  size_t allocations;
+  size_t bytes_allocated;
+
+  /** Runs of the adoption agency algorithm, for misnested end tags. */
+  size_t adoption_agency_runs;
+
+  /** Nodes inserted out of place because they appeared inside a table. */
+  size_t foster_parented_insertions;
+
+  /** Calls to "reconstruct the active formatting elements". */
+  size_t formatting_reconstructions;
+
+  /** Wall-clock time spent in the tokenizer and in tree construction. */
+  double tokenizer_seconds;
+  double tree_construction_seconds;
+
+  /**
+   * Tree construction time broken down by the insertion mode each token
+   * was handled in, indexed in the order the spec lists the modes (see
+   * `gumbo_insertion_mode_name`). A token that's reprocessed counts
+   * towards each mode that handles it.
+   */
+  double insertion_mode_seconds[GUMBO_NUM_INSERTION_MODES];
+} GumboParseStats;
+
 /**
  * Input struct containing configuration options for the parser.
  * These let you specify alternate memory managers, provide different
@@ -727,6 +882,80 @@ typedef struct GumboInternalOptions {
    * Default: `GUMBO_NAMESPACE_HTML`.
    */
   GumboNamespaceEnum fragment_namespace;
+
+  /**
+   * Whether to allocate the parse tree from a region allocator owned by
+   * the `GumboOutput`, rather than allocating every node, attribute,
+   * string and vector individually. This makes parsing and
+   * `gumbo_destroy_output` considerably cheaper, at the cost of not
+   * being able to free parts of the tree before the whole output is
+   * destroyed.
+   * Default: `false`.
+   */
+  bool use_arena;
+
+  /**
+   * Whether to track only byte offsets while parsing. When set, the
+   * `line` and `column` of every `GumboSourcePosition` in the tree are
+   * left as 0 and can be computed on demand with
+   * `gumbo_position_resolve`. Positions of parse errors are always
+   * resolved before parsing returns.
+   * Default: `false`.
+   */
+  bool lazy_positions;
+
+  /**
+   * Callbacks to report nodes to as they're parsed (see
+   * `GumboCallbacks`). When set, nodes are freed as soon as the parser
+   * no longer needs them, so memory use depends on the depth of the
+   * document rather than its size, and the tree in the `GumboOutput`
+   * only holds the root element and the few nodes that were still
+   * referenced when parsing stopped. The callbacks struct must outlive
+   * the parse.
+   * Default: `NULL`.
+   */
+  const GumboCallbacks* callbacks;
+
+  /**
+   * Whether text and attribute values that are byte-for-byte identical to
+   * their source (because they contain no character references, carriage
+   * returns or NULs) should point into the source buffer rather than be
+   * copied. Such strings are not null-terminated, so `GumboText.text_length`
+   * and `GumboAttribute.value_length` must be used to read them. As with
+   * `original_text`, the source buffer must outlive the output.
+   * Default: `false`.
+   */
+  bool zero_copy_text;
+
+  /**
+   * The number of threads to tokenize a large document with. When this is
+   * more than 1, a document of at least 256 KiB per extra thread is split
+   * at likely tag boundaries, and each part after the first is tokenized
+   * speculatively on a thread of its own, as if it started in the data
+   * state. Tree construction checks every speculative token against the
+   * state the tokenizer is really in, and tokenizes any stretch where they
+   * disagree (script contents, say) itself, so the output is always the
+   * same as without threads. Ignored by incremental parses.
+   * Default: `0`.
+   */
+  unsigned int tokenizer_threads;
+
+  /**
+   * Where to put statistics about each parse (see `GumboParseStats`), or
+   * `NULL` to skip gathering them. Used by `gumbo_parse_with_options`,
+   * `gumbo_parser_parse` and incremental parses, but not by
+   * `gumbo_parse_batch`.
+   * Default: `NULL`.
+   */
+  GumboParseStats* stats;
+
+  /**
+   * Whether to build a hash index of the attributes of each element that
+   * has many of them (see `GumboElement.attribute_index`), so that
+   * `gumbo_element_get_attribute` doesn't need to search them.
+   * Default: `false`.
+   */
+  bool index_attributes;
 } GumboOptions;
 
 /** Default options struct; use this with gumbo_parse_with_options. */
@@ -767,6 +996,45 @@ typedef struct GumboInternalOutput {
    * stopped mid-document due to exceptional circumstances.
    */
   GumboOutputStatus status;
+
+  /**
+   * The region allocator that owns the whole tree and error list when
+   * `GumboOptions.use_arena` is set, or `NULL` otherwise. This is
+   * released by `gumbo_destroy_output` and should not be touched by
+   * client code.
+   */
+  struct GumboInternalArena* arena;
+
+  /**
+   * The region allocator that holds the errors and the tag stacks they
+   * refer to. This is `arena` when that is set, and otherwise is created
+   * with the first error, so it's `NULL` if there were none. It is
+   * released by `gumbo_destroy_output` and should not be touched by client
+   * code.
+   */
+  struct GumboInternalArena* error_arena;
+
+  /**
+   * Maps offsets back to line and column numbers when
+   * `GumboOptions.lazy_positions` is set, or `NULL` otherwise. Used by
+   * `gumbo_position_resolve` and should not be touched by client code.
+   */
+  struct GumboInternalLineIndex* line_index;
+
+  /**
+   * The parser's own copies of the input when it was fed incrementally
+   * through `gumbo_parser_feed`, which the `original_text` fields in the
+   * tree point into, or `NULL` otherwise. These are released by
+   * `gumbo_destroy_output` and should not be touched by client code.
+   */
+  struct GumboInternalInputBuffer* input_buffers;
+
+  /**
+   * The interned attribute and unknown element names in the tree. This
+   * is released by `gumbo_destroy_output` and should not be touched by
+   * client code.
+   */
+  struct GumboInternalInternTable* names;
 } GumboOutput;
 
 /**
@@ -788,9 +1056,130 @@ GumboOutput* gumbo_parse_with_options (
   size_t buffer_length
 );
 
+/**
+ * Fills in the `line` and `column` of a position taken from an output
+ * parsed with `GumboOptions.lazy_positions`, based on its `offset`. The
+ * source buffer passed to the parser must still be valid. Positions from
+ * outputs parsed without that option are left unchanged.
+ *
+ * The first call builds an index of line starts in the output, so this
+ * must not be called concurrently on the same output. Positions of nodes
+ * that don't appear in the source (which have an offset of 0) resolve to
+ * line 1, column 1.
+ */
+void gumbo_position_resolve (
+  GumboOutput* output,
+  GumboSourcePosition* position
+);
+
+/**
+ * An incremental parser, for documents that arrive in pieces (e.g. from
+ * the network). Create one with `gumbo_parser_new`, pass it the input
+ * with any number of calls to `gumbo_parser_feed`, and collect the
+ * result with `gumbo_parser_finish`. The parser must then be released
+ * with `gumbo_parser_destroy`.
+ *
+ * A parser can also be reused for any number of documents, incremental
+ * (after `gumbo_parser_reset`) or not (with `gumbo_parser_parse`). It
+ * keeps the stacks and buffers it has allocated from one document to the
+ * next, so parsing many documents with one parser allocates less than
+ * creating a parser, or calling `gumbo_parse_with_options`, for each. A
+ * parser must only be used by one thread at a time.
+ */
+typedef struct GumboInternalParser GumboParser;
+
+/**
+ * Creates a parser, ready to parse a document incrementally. The options
+ * are copied. `lazy_positions` only applies to `gumbo_parser_parse`.
+ */
+GumboParser* gumbo_parser_new(const GumboOptions* options);
+
+/**
+ * Parses the next piece of the document. The chunk may end anywhere,
+ * including in the middle of a UTF-8 sequence, a tag or a character
+ * reference; the parser only holds back the last few bytes it can't
+ * tokenize yet. The chunk is copied, so it need not outlive the call.
+ */
+void gumbo_parser_feed(GumboParser* parser, const char* chunk, size_t length);
+
+/**
+ * Parses the end of the document and returns the result, which is the same
+ * as `gumbo_parse_with_options` would have returned for the concatenation
+ * of all the chunks. The `original_text` fields point into the parser's
+ * copy of the input, which is owned by the output, so the text is no
+ * longer contiguous and `gumbo_caret_diagnostic_to_string` can't be used.
+ * No more input can be fed to the parser afterwards, until it's reset.
+ */
+GumboOutput* gumbo_parser_finish(GumboParser* parser);
+
+/**
+ * Discards the document being parsed incrementally, if there is one (as
+ * `gumbo_parser_destroy` would), and starts parsing a new document with
+ * the same options.
+ */
+void gumbo_parser_reset(GumboParser* parser);
+
+/**
+ * Parses a complete document, and returns the same output as
+ * `gumbo_parse_with_options` with the parser's options (including
+ * `lazy_positions`). Any document being parsed incrementally is discarded
+ * first. Call `gumbo_parser_reset` before feeding the parser input again.
+ */
+GumboOutput* gumbo_parser_parse (
+  GumboParser* parser,
+  const char* buffer,
+  size_t length
+);
+
+/**
+ * Releases a parser created with `gumbo_parser_new`. If it's destroyed
+ * before `gumbo_parser_finish` is called, the partial parse tree is
+ * released as well.
+ */
+void gumbo_parser_destroy(GumboParser* parser);
+
+/**
+ * Parses `count` independent documents, `buffers[i]` being `lengths[i]`
+ * bytes long, with the given options. `outputs[i]` is set to the output
+ * for `buffers[i]`, as `gumbo_parse_with_options` would return it; each
+ * output must be released with `gumbo_destroy_output`.
+ *
+ * The documents are shared out between `num_threads` threads, including
+ * the calling one (0 means one per online CPU), and each thread reuses a
+ * single `GumboParser`. Threads that run out of documents take over
+ * documents queued for the others, so a large document doesn't hold up
+ * the rest of the batch. Any callbacks in the options are called from
+ * all of the threads. Where threads aren't supported, the documents are
+ * parsed one after another.
+ */
+void gumbo_parse_batch (
+  const GumboOptions* options,
+  const char* const* buffers,
+  const size_t* lengths,
+  size_t count,
+  unsigned int num_threads,
+  GumboOutput** outputs
+);
+
+/**
+ * Returns the interned copy of `name` that attributes and unknown
+ * elements with that name in `output` share, for use with
+ * `gumbo_get_interned_attribute` or pointer comparisons. Returns `NULL`
+ * if no node in the output can have that name. The names of common
+ * attributes are static data, and are the same in every output.
+ */
+const char* gumbo_interned_name(const GumboOutput* output, const char* name);
+
 /** Convert a `GumboOutputStatus` code into a readable description. */
 const char* gumbo_status_to_string(GumboOutputStatus status);
 
+/**
+ * Returns the spec's name for insertion mode number `mode` (as used by
+ * `GumboParseStats.insertion_mode_seconds`), such as `"in body"`, or
+ * `NULL` if there's no such mode.
+ */
+const char* gumbo_insertion_mode_name(unsigned int mode);
+
 /** Release the memory used for the parse tree and parse errors. */
 void gumbo_destroy_output(GumboOutput* output);
 
@@ -3,7 +3,8 @@
 
 // https://html.spec.whatwg.org/multipage/parsing.html#insertion-mode
 // If new enum values are added, be sure to update the kTokenHandlers
-// dispatch table in parser.c.
+// dispatch table and kInsertionModeNames in parser.c, and
+// GUMBO_NUM_INSERTION_MODES in gumbo.h.
 typedef enum {
   GUMBO_INSERTION_MODE_INITIAL,
   GUMBO_INSERTION_MODE_BEFORE_HTML,
@@ -0,0 +1,194 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "intern.h"
+#include "util.h"
+
+// Attribute names that occur on most pages, in strcmp(3) order. Interning
+// these doesn't allocate anything, and they are shared between all tables.
+static const char* const kCommonNames[] = {
+  "abbr", "accept", "accept-charset", "accesskey", "action", "align", "alink",
+  "allow", "allowfullscreen", "alt", "archive", "aria-controls",
+  "aria-describedby", "aria-expanded", "aria-haspopup", "aria-hidden",
+  "aria-label", "aria-labelledby", "aria-live", "async", "autocapitalize",
+  "autocomplete", "autofocus", "autoplay", "axis", "background", "bgcolor",
+  "border", "cellpadding", "cellspacing", "char", "charoff", "charset",
+  "checked", "cite", "class", "classid", "clear", "code", "codebase",
+  "codetype", "color", "cols", "colspan", "compact", "content",
+  "contenteditable", "controls", "coords", "crossorigin", "d", "data",
+  "datetime", "declare", "decoding", "default", "defer", "dir", "dirname",
+  "disabled", "download", "draggable", "enctype", "enterkeyhint", "face",
+  "fill", "for", "form", "formaction", "formenctype", "formmethod",
+  "formnovalidate", "formtarget", "frame", "frameborder", "headers", "height",
+  "hidden", "high", "href", "hreflang", "hspace", "http-equiv", "id", "inert",
+  "inputmode", "integrity", "is", "ismap", "itemid", "itemprop", "itemref",
+  "itemscope", "itemtype", "kind", "label", "lang", "language", "link", "list",
+  "loading", "longdesc", "loop", "low", "marginheight", "marginwidth", "max",
+  "maxlength", "media", "method", "min", "minlength", "multiple", "muted",
+  "name", "nomodule", "nonce", "noresize", "noshade", "novalidate", "nowrap",
+  "onblur", "onchange", "onclick", "onerror", "onfocus", "oninput",
+  "onkeydown", "onkeyup", "onload", "onmousedown", "onmouseout", "onmouseover",
+  "onmouseup", "onsubmit", "open", "optimum", "pattern", "ping", "placeholder",
+  "playsinline", "poster", "preload", "profile", "readonly", "referrerpolicy",
+  "rel", "required", "rev", "reversed", "role", "rows", "rowspan", "rules",
+  "sandbox", "scope", "scrolling", "selected", "shape", "size", "sizes",
+  "slot", "span", "spellcheck", "src", "srcdoc", "srclang", "srcset", "start",
+  "step", "stroke", "style", "summary", "tabindex", "target", "text", "title",
+  "transform", "translate", "type", "usemap", "valign", "value", "valuetype",
+  "version", "viewbox", "vlink", "vspace", "width", "wrap", "x", "xmlns", "y",
+};
+
+typedef struct {
+  const char* name;
+  uint32_t length;
+  uint32_t hash;
+  // False for names from kCommonNames.
+  bool owned;
+} InternEntry;
+
+// An open-addressing hash table, which is never more than half full.
+struct GumboInternalInternTable {
+  InternEntry* entries;
+  size_t capacity;
+  size_t count;
+};
+
+static const size_t kInitialCapacity = 64;
+
+// FNV-1a.
+static uint32_t hash_name(const char* name, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; ++i) {
+    hash = (hash ^ (unsigned char) name[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static int compare_common_name(const void* key, const void* element) {
+  const GumboStringPiece* name = key;
+  const char* common = *(const char* const*) element;
+  int result = strncmp(name->data, common, name->length);
+  if (result == 0 && common[name->length] != '\0') {
+    return -1;
+  }
+  return result;
+}
+
+static const char* find_common_name(const char* name, size_t length) {
+  if (memchr(name, '\0', length)) {
+    return NULL;
+  }
+  const GumboStringPiece key = {.data = name, .length = length};
+  const char* const* found = bsearch (
+    &key,
+    kCommonNames,
+    ARRAY_COUNT(kCommonNames),
+    sizeof(kCommonNames[0]),
+    compare_common_name
+  );
+  return found ? *found : NULL;
+}
+
+GumboInternTable* gumbo_intern_table_new(void) {
+  GumboInternTable* table = gumbo_alloc(sizeof(GumboInternTable));
+  table->capacity = kInitialCapacity;
+  table->count = 0;
+  table->entries = gumbo_alloc(kInitialCapacity * sizeof(InternEntry));
+  memset(table->entries, 0, kInitialCapacity * sizeof(InternEntry));
+  return table;
+}
+
+void gumbo_intern_table_destroy(GumboInternTable* table) {
+  if (!table) {
+    return;
+  }
+  for (size_t i = 0; i < table->capacity; ++i) {
+    if (table->entries[i].owned) {
+      gumbo_free((void*) table->entries[i].name);
+    }
+  }
+  gumbo_free(table->entries);
+  gumbo_free(table);
+}
+
+// Returns the slot holding the name, or the empty slot it would go in.
+static InternEntry* find_slot (
+  const GumboInternTable* table,
+  const char* name,
+  size_t length,
+  uint32_t hash
+) {
+  size_t mask = table->capacity - 1;
+  for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+    InternEntry* entry = &table->entries[i];
+    if (
+      !entry->name
+      || (
+        entry->hash == hash
+        && entry->length == length
+        && !memcmp(entry->name, name, length)
+      )
+    ) {
+      return entry;
+    }
+  }
+}
+
+static void grow_table(GumboInternTable* table) {
+  InternEntry* old_entries = table->entries;
+  size_t old_capacity = table->capacity;
+  table->capacity *= 2;
+  table->entries = gumbo_alloc(table->capacity * sizeof(InternEntry));
+  memset(table->entries, 0, table->capacity * sizeof(InternEntry));
+  for (size_t i = 0; i < old_capacity; ++i) {
+    const InternEntry* entry = &old_entries[i];
+    if (entry->name) {
+      *find_slot(table, entry->name, entry->length, entry->hash) = *entry;
+    }
+  }
+  gumbo_free(old_entries);
+}
+
+const char* gumbo_intern (
+  GumboInternTable* table,
+  const char* name,
+  size_t length
+) {
+  uint32_t hash = hash_name(name, length);
+  InternEntry* entry = find_slot(table, name, length, hash);
+  if (entry->name) {
+    return entry->name;
+  }
+  if (2 * (table->count + 1) > table->capacity) {
+    grow_table(table);
+    entry = find_slot(table, name, length, hash);
+  }
+  const char* common = find_common_name(name, length);
+  if (common) {
+    entry->name = common;
+    entry->owned = false;
+  } else {
+    char* copy = gumbo_alloc(length + 1);
+    memcpy(copy, name, length);
+    copy[length] = '\0';
+    entry->name = copy;
+    entry->owned = true;
+  }
+  entry->length = (uint32_t) length;
+  entry->hash = hash;
+  ++table->count;
+  return entry->name;
+}
+
+const char* gumbo_intern_lookup (
+  const GumboInternTable* table,
+  const char* name,
+  size_t length
+) {
+  const char* common = find_common_name(name, length);
+  if (common) {
+    return common;
+  }
+  return find_slot(table, name, length, hash_name(name, length))->name;
+}
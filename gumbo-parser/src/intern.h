@@ -0,0 +1,43 @@
+#ifndef GUMBO_INTERN_H_
+#define GUMBO_INTERN_H_
+
+#include <stddef.h>
+#include "gumbo.h"
+#include "macros.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A set of shared, null-terminated name strings. Each distinct name is stored
+// once, so interned names can be compared by pointer. Common attribute names
+// come from a static read-only list and are the same in every table; other
+// names are copied into the table, which owns them.
+typedef struct GumboInternalInternTable GumboInternTable;
+
+GumboInternTable* gumbo_intern_table_new(void) XMALLOC;
+
+// Releases the table and every name copied into it.
+void gumbo_intern_table_destroy(GumboInternTable* table);
+
+// Returns the shared copy of the first `length` bytes of `name`, adding it to
+// the table if it isn't there yet.
+const char* gumbo_intern (
+  GumboInternTable* table,
+  const char* name,
+  size_t length
+) RETURNS_NONNULL NONNULL_ARGS;
+
+// Returns the shared copy of `name` if it's a common name or is already in the
+// table, or NULL otherwise.
+const char* gumbo_intern_lookup (
+  const GumboInternTable* table,
+  const char* name,
+  size_t length
+) NONNULL_ARGS;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUMBO_INTERN_H_
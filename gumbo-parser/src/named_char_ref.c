@@ -0,0 +1,79 @@
+#include <stdint.h>
+#include <string.h>
+#include "char_ref.h"
+
+// A named character reference, less its first two characters, which are
+// implied by the bucket it's in. The rest of the name is the `length` bytes
+// at `suffix` in kNamedCharRefSuffixes, shared between names like "lt" and
+// "lt;".
+typedef struct {
+  uint16_t suffix;
+  uint8_t length;
+  // Index into kNamedCharRefSeconds.
+  uint8_t second;
+  uint32_t first;
+} NamedCharRef;
+
+#include "named_char_ref_table.h"
+
+// Every name starts with two ASCII letters, which pick one of 52 * 52
+// buckets.
+static int letter_index(unsigned char c) {
+  if (c >= 'A' && c <= 'Z') {
+    return c - 'A';
+  }
+  if (c >= 'a' && c <= 'z') {
+    return c - 'a' + 26;
+  }
+  return -1;
+}
+
+size_t gumbo_match_named_char_ref (
+  const char* data,
+  size_t length,
+  OneOrTwoCodepoints* output
+) {
+  if (length < 2) {
+    return 0;
+  }
+  int c0 = letter_index(data[0]);
+  int c1 = letter_index(data[1]);
+  if (c0 < 0 || c1 < 0) {
+    return 0;
+  }
+  unsigned int bucket = c0 * 52 + c1;
+  const char* rest = data + 2;
+  size_t available = length - 2;
+  const NamedCharRef* match = NULL;
+
+  // The entries in a bucket are sorted by name, so a name always comes before
+  // the longer ones it's a prefix of and the last match is the longest. Once
+  // an entry sorts after the input, all the ones following it do too.
+  for (
+    unsigned int i = kNamedCharRefBuckets[bucket];
+    i < kNamedCharRefBuckets[bucket + 1];
+    ++i
+  ) {
+    const NamedCharRef* ref = &kNamedCharRefs[i];
+    const char* suffix = kNamedCharRefSuffixes + ref->suffix;
+    size_t n = ref->length < available ? ref->length : available;
+    // Most entries differ from the input in their first character.
+    int cmp = n ? (unsigned char) suffix[0] - (unsigned char) rest[0] : 0;
+    if (cmp == 0 && n > 1) {
+      cmp = memcmp(suffix + 1, rest + 1, n - 1);
+    }
+    if (cmp > 0) {
+      break;
+    }
+    if (cmp == 0 && n == ref->length) {
+      match = ref;
+    }
+  }
+
+  if (!match) {
+    return 0;
+  }
+  output->first = match->first;
+  output->second = kNamedCharRefSeconds[match->second];
+  return 2 + match->length;
+}
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+# Generates named_char_ref_table.h, the tables used by named_char_ref.c, from
+# the list of named character references in char_ref.rl.
+#
+# Usage: python3 src/named_char_ref.py < src/char_ref.rl > src/named_char_ref_table.h
+
+import re
+import string
+import sys
+
+LETTERS = string.ascii_uppercase + string.ascii_lowercase
+
+entry_re = re.compile(
+    r"'([^']+)' => \{ output->first = (0x[0-9a-f]+);"
+    r"(?: output->second = (0x[0-9a-f]+);)? fbreak; \};"
+)
+
+refs = []
+for name, first, second in entry_re.findall(sys.stdin.read()):
+    assert len(name) >= 2 and name[0] in LETTERS and name[1] in LETTERS, name
+    refs.append((name, int(first, 16), int(second, 16) if second else None))
+
+# Sorting by name groups the references by their first two characters and
+# puts every name before the longer names it's a prefix of.
+refs.sort(key=lambda ref: ref[0].encode())
+
+# Several references produce a second codepoint, but only a handful of
+# distinct ones. Index 0 means there is none.
+seconds = [None] + sorted({ref[2] for ref in refs if ref[2] is not None})
+assert len(seconds) <= 256
+
+# The suffixes (everything after the first two characters) are packed into
+# one string, longest first, so that a suffix which is a substring of one
+# already stored ("lig" in "lig;") reuses it.
+suffixes = ""
+suffix_offsets = {}
+for suffix in sorted({ref[0][2:] for ref in refs}, key=lambda s: (-len(s), s)):
+    offset = suffixes.find(suffix)
+    if offset < 0:
+        offset = len(suffixes)
+        suffixes += suffix
+    suffix_offsets[suffix] = offset
+assert len(suffixes) < 65536
+
+def bucket(name):
+    return LETTERS.index(name[0]) * len(LETTERS) + LETTERS.index(name[1])
+
+num_buckets = len(LETTERS) * len(LETTERS)
+buckets = [0] * (num_buckets + 1)
+for name, _, _ in refs:
+    buckets[bucket(name) + 1] += 1
+for i in range(num_buckets):
+    buckets[i + 1] += buckets[i]
+
+out = sys.stdout
+out.write("// Generated by named_char_ref.py from char_ref.rl. Do not edit.\n\n")
+
+out.write("static const int kNamedCharRefSeconds[] = {\n")
+out.write("  -1")
+for cp in seconds[1:]:
+    out.write(", 0x%04X" % cp)
+out.write("\n};\n\n")
+
+out.write("static const char kNamedCharRefSuffixes[] =\n")
+for i in range(0, len(suffixes), 64):
+    out.write('  "%s"\n' % suffixes[i:i + 64])
+out.write(";\n\n")
+
+out.write("// Entries [kNamedCharRefBuckets[b], kNamedCharRefBuckets[b + 1]) are\n")
+out.write("// the references whose first two characters map to bucket b.\n")
+out.write("static const uint16_t kNamedCharRefBuckets[%d] = {\n" % (num_buckets + 1))
+for i in range(0, num_buckets + 1, 12):
+    row = ", ".join("%4d" % n for n in buckets[i:i + 12])
+    out.write("  %s,\n" % row)
+out.write("};\n\n")
+
+out.write("static const NamedCharRef kNamedCharRefs[%d] = {\n" % len(refs))
+for name, first, second in refs:
+    suffix = name[2:]
+    out.write (
+        "  {%5d, %2d, %d, 0x%05X}, // %s\n" % (
+            suffix_offsets[suffix],
+            len(suffix),
+            seconds.index(second),
+            first,
+            name
+        )
+    )
+out.write("};\n")
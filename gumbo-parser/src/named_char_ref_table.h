@@ -0,0 +1,2572 @@
+// Generated by named_char_ref.py from char_ref.rl. Do not edit.
+
+static const int kNamedCharRefSeconds[] = {
+  -1, 0x006A, 0x0331, 0x0333, 0x0338, 0x200A, 0x20D2, 0x20E5, 0xFE00
+};
+
+static const char kNamedCharRefSuffixes[] =
+  "unterClockwiseContourIntegral;ubleLongLeftRightArrow;tNestedGrea"
+  "terGreater;acriticalDoubleAcute;tSquareSupersetEqual;gativeVeryT"
+  "hinSpace;lledVerySmallSquare;oseCurlyDoubleQuote;tPrecedesSlantE"
+  "qual;tRightTriangleEqual;tSucceedsSlantEqual;ubleContourIntegral"
+  ";enCurlyDoubleQuote;pitalDifferentialD;ptyVerySmallSquare;tDoubl"
+  "eVerticalBar;tGreaterSlantEqual;tLeftTriangleEqual;tSquareSubset"
+  "Equal;ubleLeftRightArrow;ubleLongRightArrow;verseUpEquilibrium;f"
+  "tArrowRightArrow;ftrightsquigarrow;gativeMediumSpace;ghtArrowLef"
+  "tArrow;tGreaterFullEqual;tRightTriangleBar;ubleLongLeftArrow;wnL"
+  "eftRightVector;acktriangleright;gativeThickSpace;ghtDoubleBracke"
+  "t;ghtDownTeeVector;ghtDownVectorBar;ngleftrightarrow;tLeftTriang"
+  "leBar;uareIntersection;verseEquilibrium;wnRightTeeVector;wnRight"
+  "VectorBar;acktriangledown;acktriangleleft;ftDoubleBracket;ftDown"
+  "TeeVector;ftDownVectorBar;ftrightharpoons;gativeThinSpace;ghtAng"
+  "leBracket;ghtUpDownVector;ghtleftharpoons;lledSmallSquare;oheadr"
+  "ightarrow;rticalSeparator;tGreaterGreater;tLessSlantEqual;tNeste"
+  "dLessLess;tReverseElement;tSquareSuperset;tTildeFullEqual;ubleUp"
+  "DownArrow;wnLeftTeeVector;wnLeftVectorBar;ArrowDownArrow;acritic"
+  "alAcute;acriticalGrave;acriticalTilde;derParenthesis;eaterEqualL"
+  "ess;ftAngleBracket;ftUpDownVector;ghtUpTeeVector;ghtUpVectorBar;"
+  "ghtharpoondown;ghtrightarrows;nBreakingSpace;oheadleftarrow;ptyS"
+  "mallSquare;rclearrowright;rianglerighteq;rtriangleright;ssEqualG"
+  "reater;tPrecedesEqual;tRightTriangle;tSucceedsEqual;tSucceedsTil"
+  "de;tSupersetEqual;ubleRightArrow;wnArrowUpArrow;wnharpoonright;f"
+  "tUpTeeVector;ftUpVectorBar;ftharpoondown;ftrightarrows;ghtDownVe"
+  "ctor;ghtleftarrows;ghtthreetimes;gtriangledown;ortRightArrow;ose"
+  "CurlyQuote;perRightArrow;raightepsilon;rclearrowleft;riangleleft"
+  "eq;rtriangleleft;rvearrowright;tGreaterEqual;tGreaterTilde;tHump"
+  "DownHump;tLeftTriangle;tSquareSubset;ubleDownArrow;ubleLeftArrow"
+  ";werRightArrow;wnRightVector;wnharpoonleft;acriticalDot;enCurlyQ"
+  "uote;ftDownVector;ftleftarrows;ftthreetimes;ghtarrowtail;ghtharp"
+  "oonup;hortparallel;ngrightarrow;okrightarrow;oparrowright;ortDow"
+  "nArrow;ortLeftArrow;perLeftArrow;rizontalLine;roWidthSpace;rvear"
+  "rowleft;tGreaterLess;tLessGreater;tSubsetEqual;tVerticalBar;uble"
+  "RightTee;ublebarwedge;visibleComma;visibleTimes;werLeftArrow;wnL"
+  "eftVector;wndownarrows;acktriangle;allsetminus;asuredangle;ecede"
+  "sTilde;ftarrowtail;ftharpoonup;ghtArrowBar;ghtTeeArrow;ghtUpVect"
+  "or;gtriangleup;incareplane;llingdotseq;ngleftarrow;okleftarrow;o"
+  "parrowleft;plyFunction;rsubsetneqq;rsupsetneqq;rticalTilde;ssFul"
+  "lEqual;tEqualTilde;tTildeEqual;tTildeTilde;ubleLeftTee;ubleUpArr"
+  "ow;videontimes;acklozenge;derBracket;ftArrowBar;ftTeeArrow;ftUpV"
+  "ector;ghtCeiling;lbertSpace;oportional;ortUpArrow;ponentialE;pon"
+  "entiale;rsubsetneq;rsupsetneq;rticalLine;singdotseq;tCongruent;t"
+  "HumpEqual;tLessEqual;tLessTilde;undImplies;wnArrowBar;wnTeeArrow"
+  ";acksquare;allCircle;amondsuit;aternions;cccurlyeq;ccnapprox;cke"
+  "psilon;downarrow;eccurlyeq;ecnapprox;ftCeiling;ickapprox;leDelay"
+  "ed;pectation;raightphi;rcleMinus;rcleTimes;rcledcirc;rcleddash;r"
+  "lyeqprec;rlyeqsucc;slantless;tLessLess;tPrecedes;tSucceeds;tSupe"
+  "rset;uareUnion;aginaryI;ccapprox;derBrace;ecapprox;ghtFloor;mple"
+  "ment;ngmapsto;oportion;oustache;placetrf;pstodown;pstoleft;rcleP"
+  "lus;rcledast;repsilon;reqqless;rlywedge;rnothing;rnoullis;slantg"
+  "tr;ssapprox;sseqqgtr;subseteq;supseteq;tElement;tGreater;ubseteq"
+  "q;uparrows;upseteqq;uriertrf;adesuit;artsuit;ckprime;cksimeq;cks"
+  "lash;eckmark;eqslant;erefore;ertneqq;ftFloor;gotimes;hortmid;ian"
+  "gleq;ionPlus;ipleDot;llintrf;mplexes;nterDot;nterdot;nusPlus;pro"
+  "duct;rapprox;rcleDot;reqless;rpropto;sseqgtr;tCupCap;tExists;tSu"
+  "bset;tchfork;tionals;tsquare;ubleDot;usMinus;wnBreve;agline;agpa"
+  "rt;alpart;artint;bkarow;ccneqq;ccnsim;chThat;ckcong;conint;corne"
+  "r;derBar;dslope;ecneqq;ecnsim;emptyv;eparsl;etasym;fintie;gmsdaa"
+  ";gmsdab;gmsdac;gmsdad;gmsdae;gmsdaf;gmsdag;gmsdah;goplus;grtvbd;"
+  "gsqcup;guplus;gwedge;icksim;igrarr;imesas;iminus;inters;intint;l"
+  "timap;mesbar;ofalar;ofline;ofsurf;olhsub;ongdot;otrahd;pbrcap;pb"
+  "rcup;pezium;polint;proxeq;pstoup;ptyset;rcledR;rcledS;rdshar;rfn"
+  "int;riltri;rkappa;rktbrk;rlyvee;rrocir;rsigma;rtheta;rtialD;rush"
+  "ar;sdotol;sdotor;searow;subset;supset;swarow;tTilde;tegers;teqdo"
+  "t;tercal;tindot;tlarhk;turals;ubsuit;usacir;vparsl;xminus;xtimes"
+  ";Break;agger;aline;amond;anckh;atint;bedot;bmult;bplus;brarr;cau"
+  "se;ccsim;colon;cross;darrl;darrr;derof;dilla;ecsim;efsym;equiv;e"
+  "steq;gamma;gcirc;godot;grtvb;gstar;gzarr;icron;igzag;infin;iplus"
+  ";itime;larrp;ldhar;loneq;ltese;ltrie;luhar;mplus;mrarr;nusdu;pds"
+  "ub;pedot;pfork;phsol;phsub;plarr;pmult;pplus;qsube;qsupe;quest;r"
+  "arrm;rdhar;receq;rksld;rkslu;rless;rrbfs;rrcir;rrsim;rscir;rtenk"
+  ";rtrie;ruhar;sdoto;ssdot;ssgtr;sssim;tLess;tinva;tinvb;tinvc;tni"
+  "va;tnivb;tnivc;tplus;tprod;tural;tween;ucceq;uivDD;upssm;uscir;u"
+  "ssim;ustwo;wLine;wnTee;xplus;yleys;ympeq;CHcy;Dash;FTcy;Harr;RDc"
+  "y;ac12;ac13;ac14;ac15;ac16;ac18;ac23;ac25;ac34;ac35;ac38;ac45;ac"
+  "56;ac58;ac78;ades;anck;ankv;aquo;argt;arlt;aron;arrc;arrw;arts;a"
+  "rul;ashl;ashp;bdot;blac;bsim;bsub;bsup;bull;caps;care;caus;ccue;"
+  "chcy;corn;crop;cups;dand;dbar;dcir;ddot;dels;dgeq;eath;ebar;edil"
+  ";ercy;ere4;etav;etmn;ftcy;gcap;gcup;gmaf;gmav;gmsd;gran;gsph;gve"
+  "e;hard;hree;idot;ierp;igof;iint;ilig;insp;insv;irsp;isht;lArr;lP"
+  "ar;lbar;lcty;leth;llar;llet;llig;llip;lone;lrec;male;mbda;mdot;m"
+  "ero;mesb;mesd;mile;milt;mmad;mmat;mpfn;mtht;ncsp;near;ngrt;nusb;"
+  "nusd;nwar;oust;pand;pbot;pcap;pcir;pcup;pdot;phen;ppav;psim;psub"
+  ";psup;pysr;quor;rAll;rArr;rPar;rack;rall;rbar;rceq;rcnt;rcon;rcu"
+  "e;rdcy;reen;rget;riod;rker;rmid;rmil;rnou;rown;rphi;rrap;rren;rr"
+  "fs;rrhk;rrho;rrlp;rrpl;rrtl;rvee;rwed;sear;sges;sign;sles;sold;s"
+  "p13;sp14;ster;swar;tDot;tarf;tcal;tinE;tpos;trok;ttom;uals;uarf;"
+  "ubnE;ubne;umpe;upnE;upne;urel;usdo;usmn;vbar;vide;vonx;wast;wbar"
+  ";wtie;xbox;xist;ADE;ORN;acr;ade;age;alg;ams;ang;ank;arl;arp;aru;"
+  "arv;asl;bla;blk;cek;cro;der;dic;eck;eeq;ega;eil;emi;eph;epr;esc;"
+  "gon;gst;img;iml;ins;inv;isb;ixt;k12;k14;k34;kap;kcy;lta;mel;mgE;"
+  "mlE;mne;mpE;msp;nap;ngd;ock;olb;ota;otb;par;ped;pha;pid;por;psi;"
+  "pty;ret;rif;rke;rkv;rns;rpi;rrb;scc;shv;sih;sin;siv;tes;tin;tio;"
+  "tni;tns;tur;ubE;ubs;und;upE;xDL;xDR;xDl;xDr;xHD;xHU;xHd;xHu;xUL;"
+  "xUR;xUl;xUr;xVH;xVL;xVR;xVh;xVl;xVr;xcl;xdL;xdR;xdl;xdr;xhD;xhU;"
+  "xhd;xhu;xuL;xuR;xul;xur;xvH;xvL;xvR;xvh;xvl;xvr;ymp;OT;PY;am;ca;"
+  "cp;dd;df;dm;dv;ea;gl;lf;nj;ov;p1;p2;p3;pf;py;qb;rE;ra;sa;sg;tv;u"
+  "f;xH;xV;xh;xv;zf;G;P;z;"
+;
+
+// Entries [kNamedCharRefBuckets[b], kNamedCharRefBuckets[b + 1]) are
+// the references whose first two characters map to bucket b.
+static const uint16_t kNamedCharRefBuckets[2705] = {
+     0,    0,    0,    0,    0,    2,    2,    2,    2,    2,    2,    2,
+     2,    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+     4,    4,    4,    6,    7,   10,   10,   10,   11,   13,   13,   13,
+    13,   13,   14,   15,   16,   18,   19,   19,   21,   23,   25,   27,
+    27,   27,   27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+    27,   27,   27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+    27,   27,   27,   27,   27,   27,   27,   30,   30,   31,   31,   34,
+    35,   35,   35,   35,   35,   35,   35,   35,   35,   36,   36,   36,
+    37,   38,   38,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+    39,   39,   39,   39,   40,   40,   40,   40,   40,   40,   40,   42,
+    42,   42,   42,   42,   42,   42,   42,   42,   42,   42,   42,   46,
+    46,   51,   52,   54,   55,   55,   56,   60,   60,   60,   63,   63,
+    63,   71,   71,   71,   72,   73,   73,   75,   75,   75,   75,   75,
+    75,   75,   75,   75,   77,   77,   77,   77,   77,   77,   78,   78,
+    78,   78,   78,   78,   78,   78,   78,   79,   79,   79,   79,   79,
+    79,   79,   80,   83,   83,   85,   85,   87,   88,   88,   88,   95,
+    95,   95,   95,   95,   95,  127,  127,  127,  127,  129,  129,  129,
+   129,  129,  129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+   129,  129,  129,  129,  129,  129,  130,  130,  130,  130,  130,  130,
+   132,  132,  132,  132,  132,  132,  132,  134,  134,  138,  139,  139,
+   140,  142,  142,  142,  142,  142,  143,  146,  146,  148,  149,  152,
+   152,  154,  155,  157,  157,  157,  159,  159,  159,  159,  159,  159,
+   159,  159,  159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+   159,  159,  159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+   159,  160,  160,  160,  161,  161,  161,  163,  163,  163,  163,  163,
+   163,  166,  166,  166,  166,  167,  167,  167,  167,  167,  167,  167,
+   167,  167,  167,  167,  167,  167,  167,  167,  167,  167,  168,  168,
+   168,  168,  168,  168,  168,  168,  168,  168,  170,  170,  170,  170,
+   170,  170,  170,  172,  173,  176,  177,  177,  178,  179,  179,  179,
+   179,  179,  179,  179,  179,  180,  180,  180,  187,  188,  189,  189,
+   189,  189,  189,  189,  189,  190,  190,  190,  190,  190,  190,  190,
+   190,  190,  190,  190,  190,  190,  190,  190,  190,  190,  190,  190,
+   190,  190,  190,  190,  190,  190,  190,  192,  192,  193,  193,  193,
+   194,  194,  194,  195,  195,  195,  195,  195,  195,  197,  197,  197,
+   197,  199,  199,  201,  201,  201,  201,  201,  201,  201,  201,  201,
+   201,  202,  202,  202,  202,  202,  203,  203,  203,  203,  203,  204,
+   204,  204,  204,  204,  204,  204,  204,  204,  204,  204,  204,  206,
+   206,  209,  210,  210,  211,  213,  213,  213,  213,  213,  213,  217,
+   222,  225,  225,  225,  225,  226,  227,  230,  230,  230,  230,  230,
+   230,  230,  230,  230,  230,  230,  230,  230,  230,  230,  230,  230,
+   230,  230,  230,  230,  230,  230,  230,  230,  230,  230,  230,  230,
+   230,  230,  230,  230,  230,  232,  232,  232,  233,  233,  233,  233,
+   233,  233,  233,  233,  233,  234,  234,  234,  234,  236,  236,  237,
+   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+   238,  238,  239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+   239,  239,  239,  239,  239,  239,  239,  240,  240,  242,  242,  242,
+   243,  243,  243,  243,  243,  243,  243,  243,  243,  244,  244,  244,
+   244,  245,  245,  245,  245,  245,  245,  245,  245,  245,  245,  245,
+   245,  245,  245,  245,  245,  245,  246,  246,  246,  246,  246,  246,
+   246,  246,  246,  246,  248,  248,  248,  248,  248,  248,  248,  253,
+   253,  256,  256,  288,  289,  289,  289,  289,  289,  289,  291,  292,
+   292,  301,  301,  301,  301,  304,  305,  305,  305,  305,  305,  305,
+   305,  305,  305,  305,  305,  305,  305,  305,  305,  305,  305,  305,
+   305,  305,  305,  305,  305,  305,  305,  305,  305,  305,  305,  305,
+   305,  305,  305,  306,  306,  307,  307,  309,  310,  310,  310,  311,
+   311,  311,  311,  311,  311,  312,  312,  312,  312,  313,  313,  314,
+   314,  314,  314,  314,  314,  314,  314,  314,  314,  314,  314,  314,
+   314,  314,  315,  315,  315,  315,  315,  315,  315,  315,  315,  315,
+   315,  315,  315,  315,  315,  315,  315,  316,  316,  319,  319,  326,
+   327,  327,  327,  327,  327,  327,  327,  327,  327,  382,  382,  382,
+   382,  383,  385,  386,  386,  386,  386,  386,  386,  386,  386,  386,
+   386,  387,  387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+   387,  387,  387,  387,  387,  387,  387,  387,  387,  387,  387,  389,
+   389,  392,  393,  393,  394,  396,  396,  396,  396,  396,  396,  399,
+   399,  400,  402,  402,  403,  406,  409,  411,  415,  415,  415,  415,
+   415,  415,  415,  415,  415,  415,  415,  415,  415,  415,  415,  415,
+   415,  415,  415,  415,  415,  415,  415,  415,  415,  415,  415,  415,
+   415,  415,  415,  416,  416,  417,  417,  417,  418,  418,  419,  420,
+   420,  420,  421,  421,  421,  423,  423,  423,  432,  434,  434,  434,
+   434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,
+   434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,
+   434,  436,  436,  436,  436,  436,  436,  436,  436,  436,  436,  436,
+   437,  437,  437,  437,  437,  437,  437,  437,  437,  438,  438,  438,
+   438,  439,  439,  439,  439,  439,  439,  439,  439,  439,  440,  440,
+   440,  442,  442,  442,  442,  442,  442,  442,  442,  442,  442,  442,
+   442,  442,  442,  442,  442,  442,  442,  442,  442,  442,  442,  446,
+   446,  449,  449,  453,  454,  454,  455,  478,  478,  478,  478,  478,
+   478,  480,  480,  480,  481,  483,  483,  484,  484,  484,  484,  484,
+   484,  484,  484,  484,  484,  484,  484,  484,  486,  486,  486,  486,
+   486,  486,  486,  487,  487,  487,  487,  487,  487,  487,  487,  487,
+   487,  487,  487,  488,  488,  493,  493,  493,  494,  494,  498,  499,
+   499,  499,  499,  500,  500,  501,  501,  509,  509,  510,  511,  524,
+   524,  524,  524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
+   526,  526,  526,  526,  526,  526,  526,  526,  526,  526,  527,  529,
+   529,  529,  529,  529,  529,  529,  529,  531,  531,  534,  534,  534,
+   535,  535,  539,  543,  543,  543,  543,  543,  543,  544,  544,  544,
+   545,  547,  547,  547,  547,  547,  547,  547,  547,  547,  547,  547,
+   547,  547,  547,  547,  547,  547,  547,  547,  547,  547,  547,  547,
+   547,  547,  547,  547,  547,  547,  547,  547,  547,  547,  547,  551,
+   553,  556,  557,  557,  558,  560,  560,  560,  560,  560,  560,  561,
+   567,  569,  582,  582,  583,  584,  585,  587,  587,  587,  587,  587,
+   587,  587,  587,  587,  588,  588,  588,  588,  588,  588,  588,  588,
+   588,  588,  588,  588,  588,  588,  588,  588,  588,  588,  588,  588,
+   588,  588,  588,  588,  589,  590,  592,  600,  601,  601,  601,  601,
+   601,  601,  601,  601,  601,  602,  602,  602,  602,  603,  603,  603,
+   604,  604,  604,  604,  604,  604,  604,  604,  604,  604,  604,  604,
+   604,  604,  604,  604,  604,  604,  604,  604,  604,  604,  604,  604,
+   604,  604,  604,  604,  604,  604,  604,  604,  604,  605,  605,  606,
+   607,  607,  607,  607,  607,  607,  607,  607,  607,  608,  608,  608,
+   608,  609,  609,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+   609,  609,  609,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+   609,  609,  609,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+   609,  609,  609,  609,  610,  610,  610,  611,  611,  611,  611,  611,
+   611,  612,  612,  612,  612,  613,  613,  613,  613,  613,  613,  613,
+   613,  614,  614,  614,  614,  614,  614,  614,  614,  615,  615,  615,
+   615,  615,  615,  615,  615,  615,  615,  615,  615,  616,  616,  616,
+   616,  616,  616,  618,  618,  620,  620,  620,  621,  621,  621,  621,
+   621,  621,  621,  621,  621,  622,  622,  622,  622,  623,  623,  624,
+   624,  624,  624,  624,  624,  624,  624,  624,  624,  624,  624,  624,
+   625,  625,  625,  625,  625,  625,  625,  625,  625,  625,  625,  625,
+   625,  625,  625,  625,  625,  625,  625,  626,  626,  628,  629,  631,
+   632,  632,  632,  632,  632,  632,  632,  632,  632,  633,  633,  633,
+   633,  634,  634,  634,  634,  634,  634,  634,  634,  634,  634,  634,
+   634,  634,  634,  634,  634,  634,  634,  634,  634,  634,  634,  634,
+   634,  634,  634,  634,  634,  634,  634,  634,  634,  634,  634,  636,
+   637,  645,  645,  647,  649,  651,  651,  651,  651,  651,  654,  658,
+   681,  683,  691,  691,  693,  697,  699,  701,  701,  703,  703,  703,
+   703,  703,  703,  703,  703,  703,  703,  703,  703,  703,  703,  703,
+   703,  703,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,
+   704,  704,  704,  712,  714,  716,  717,  725,  726,  726,  726,  739,
+   739,  740,  751,  751,  754,  802,  803,  803,  806,  813,  813,  819,
+   819,  819,  819,  819,  819,  819,  819,  819,  819,  819,  819,  819,
+   819,  819,  819,  819,  819,  819,  819,  819,  819,  819,  819,  819,
+   819,  819,  819,  819,  819,  819,  819,  829,  829,  836,  837,  843,
+   844,  844,  848,  863,  863,  863,  865,  865,  865,  882,  882,  882,
+   884,  889,  890,  915,  915,  917,  917,  918,  918,  919,  919,  919,
+   919,  919,  919,  919,  920,  920,  920,  920,  920,  920,  920,  920,
+   920,  920,  920,  920,  920,  920,  920,  920,  920,  920,  920,  925,
+   927,  929,  933,  937,  939,  939,  941,  953,  954,  954,  956,  956,
+   956,  969,  969,  969,  972,  976,  979,  981,  981,  982,  982,  982,
+   984,  984,  984,  984,  986,  986,  986,  986,  986,  986,  986,  986,
+   986,  986,  986,  986,  986,  986,  986,  986,  986,  986,  986,  986,
+   986,  986,  986,  989,  989,  995,  996,  997,  999, 1004, 1004, 1004,
+  1004, 1004, 1009, 1016, 1018, 1020, 1026, 1036, 1038, 1041, 1044, 1047,
+  1047, 1047, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+  1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+  1051, 1051, 1051, 1051, 1051, 1051, 1051, 1052, 1052, 1053, 1053, 1054,
+  1058, 1058, 1058, 1059, 1060, 1060, 1063, 1063, 1064, 1068, 1069, 1069,
+  1089, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090,
+  1090, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092,
+  1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1096,
+  1097, 1099, 1100, 1112, 1113, 1115, 1115, 1116, 1117, 1117, 1121, 1121,
+  1128, 1129, 1129, 1129, 1130, 1134, 1148, 1148, 1150, 1150, 1150, 1150,
+  1150, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151,
+  1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151,
+  1151, 1151, 1151, 1158, 1159, 1160, 1160, 1164, 1165, 1165, 1165, 1165,
+  1165, 1167, 1167, 1167, 1167, 1173, 1173, 1173, 1173, 1176, 1176, 1176,
+  1176, 1176, 1176, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+  1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+  1178, 1178, 1178, 1178, 1178, 1178, 1178, 1180, 1180, 1184, 1184, 1187,
+  1189, 1191, 1191, 1196, 1197, 1197, 1197, 1204, 1215, 1219, 1220, 1222,
+  1222, 1229, 1231, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
+  1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
+  1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
+  1234, 1236, 1236, 1236, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238,
+  1238, 1239, 1239, 1239, 1239, 1241, 1241, 1242, 1242, 1242, 1242, 1242,
+  1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242,
+  1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242,
+  1242, 1242, 1242, 1244, 1244, 1246, 1246, 1246, 1247, 1248, 1249, 1249,
+  1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1252, 1252, 1252,
+  1252, 1252, 1252, 1252, 1252, 1255, 1256, 1256, 1256, 1258, 1258, 1258,
+  1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259,
+  1259, 1259, 1259, 1259, 1259, 1259, 1259, 1282, 1289, 1294, 1300, 1328,
+  1331, 1333, 1337, 1337, 1338, 1338, 1343, 1346, 1353, 1371, 1373, 1373,
+  1379, 1389, 1402, 1404, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+  1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+  1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1418,
+  1418, 1420, 1421, 1422, 1423, 1423, 1424, 1435, 1435, 1435, 1437, 1437,
+  1438, 1440, 1441, 1441, 1441, 1443, 1443, 1446, 1446, 1446, 1446, 1446,
+  1446, 1446, 1446, 1446, 1446, 1446, 1446, 1449, 1449, 1449, 1449, 1449,
+  1454, 1454, 1454, 1454, 1454, 1454, 1455, 1455, 1455, 1455, 1457, 1457,
+  1457, 1457, 1457, 1468, 1472, 1479, 1480, 1491, 1492, 1501, 1504, 1508,
+  1509, 1509, 1525, 1526, 1526, 1539, 1549, 1549, 1556, 1583, 1591, 1595,
+  1609, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
+  1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1615,
+  1615, 1615, 1615, 1615, 1615, 1615, 1615, 1618, 1618, 1622, 1627, 1628,
+  1630, 1634, 1636, 1637, 1637, 1637, 1642, 1647, 1647, 1648, 1651, 1651,
+  1664, 1668, 1672, 1674, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
+  1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
+  1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1682,
+  1682, 1683, 1683, 1688, 1689, 1689, 1693, 1696, 1696, 1696, 1710, 1711,
+  1711, 1715, 1715, 1715, 1741, 1743, 1743, 1744, 1744, 1744, 1744, 1744,
+  1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744,
+  1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744,
+  1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1745, 1745, 1745, 1746,
+  1746, 1746, 1746, 1746, 1746, 1747, 1748, 1748, 1748, 1749, 1749, 1755,
+  1755, 1755, 1755, 1755, 1755, 1758, 1759, 1759, 1759, 1759, 1759, 1759,
+  1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760,
+  1760, 1760, 1760, 1760, 1760, 1760, 1760, 1785, 1792, 1797, 1802, 1809,
+  1812, 1812, 1817, 1828, 1828, 1828, 1831, 1833, 1834, 1841, 1844, 1844,
+  1845, 1851, 1857, 1858, 1858, 1858, 1859, 1859, 1859, 1859, 1859, 1859,
+  1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859,
+  1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1860,
+  1861, 1875, 1878, 1889, 1891, 1891, 1898, 1912, 1912, 1912, 1913, 1921,
+  1921, 1926, 1929, 1945, 1946, 1950, 1955, 2010, 2010, 2015, 2015, 2015,
+  2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017,
+  2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017, 2017,
+  2017, 2017, 2017, 2019, 2020, 2023, 2024, 2025, 2026, 2026, 2038, 2045,
+  2045, 2045, 2045, 2045, 2045, 2052, 2053, 2053, 2068, 2072, 2072, 2072,
+  2072, 2075, 2075, 2075, 2075, 2076, 2076, 2076, 2076, 2076, 2076, 2076,
+  2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077, 2077,
+  2077, 2077, 2077, 2077, 2077, 2077, 2077, 2080, 2082, 2085, 2088, 2088,
+  2090, 2092, 2095, 2095, 2095, 2095, 2099, 2102, 2102, 2104, 2113, 2113,
+  2118, 2119, 2123, 2126, 2126, 2127, 2127, 2127, 2127, 2128, 2130, 2130,
+  2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131,
+  2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2131, 2148,
+  2148, 2149, 2150, 2156, 2157, 2157, 2157, 2157, 2157, 2157, 2158, 2158,
+  2160, 2161, 2162, 2162, 2163, 2168, 2168, 2168, 2168, 2168, 2168, 2168,
+  2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169,
+  2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169, 2169,
+  2169, 2169, 2169, 2169, 2169, 2170, 2170, 2174, 2175, 2175, 2175, 2175,
+  2175, 2175, 2175, 2175, 2175, 2176, 2177, 2177, 2179, 2180, 2180, 2180,
+  2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180,
+  2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180,
+  2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2180, 2183, 2184, 2184,
+  2185, 2185, 2187, 2188, 2188, 2188, 2190, 2191, 2192, 2196, 2196, 2196,
+  2198, 2200, 2200, 2202, 2203, 2204, 2204, 2204, 2204, 2204, 2204, 2204,
+  2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204,
+  2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2204, 2207,
+  2207, 2209, 2209, 2211, 2212, 2212, 2212, 2213, 2213, 2213, 2213, 2213,
+  2213, 2214, 2214, 2214, 2214, 2215, 2215, 2218, 2218, 2218, 2218, 2218,
+  2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218,
+  2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218, 2218,
+  2218, 2218, 2218, 2219, 2219, 2221, 2222, 2224, 2225, 2225, 2226, 2227,
+  2227, 2227, 2227, 2227, 2227, 2228, 2228, 2228, 2228, 2229, 2229, 2229,
+  2229, 2231, 2231, 2231, 2231,
+};
+
+static const NamedCharRef kNamedCharRefs[2231] = {
+  { 5153,  3, 0, 0x000C6}, // AElig
+  { 5153,  4, 0, 0x000C6}, // AElig;
+  {  178,  1, 0, 0x00026}, // AMP
+  { 6291,  2, 0, 0x00026}, // AMP;
+  {   91,  4, 0, 0x000C1}, // Aacute
+  {   91,  5, 0, 0x000C1}, // Aacute;
+  { 3632,  5, 0, 0x00102}, // Abreve;
+  { 2831,  3, 0, 0x000C2}, // Acirc
+  { 2993,  4, 0, 0x000C2}, // Acirc;
+  { 4780,  2, 0, 0x00410}, // Acy;
+  {   73,  2, 0, 0x1D504}, // Afr;
+  { 1170,  4, 0, 0x000C0}, // Agrave
+  { 1170,  5, 0, 0x000C0}, // Agrave;
+  { 5936,  4, 0, 0x00391}, // Alpha;
+  { 5720,  4, 0, 0x00100}, // Amacr;
+  { 2945,  2, 0, 0x02A53}, // And;
+  { 5824,  4, 0, 0x00104}, // Aogon;
+  { 6247,  3, 0, 0x1D538}, // Aopf;
+  { 2443, 12, 0, 0x02061}, // ApplyFunction;
+  { 1316,  3, 0, 0x000C5}, // Aring
+  { 2637,  4, 0, 0x000C5}, // Aring;
+  { 5721,  3, 0, 0x1D49C}, // Ascr;
+  { 5552,  5, 0, 0x02254}, // Assign;
+  { 1068,  4, 0, 0x000C3}, // Atilde
+  { 1185,  5, 0, 0x000C3}, // Atilde;
+  { 5837,  2, 0, 0x000C4}, // Auml
+  { 5837,  3, 0, 0x000C4}, // Auml;
+  { 3389,  8, 0, 0x02216}, // Backslash;
+  { 5761,  3, 0, 0x02AE7}, // Barv;
+  { 5537,  5, 0, 0x02306}, // Barwed;
+  { 4780,  2, 0, 0x00411}, // Bcy;
+  { 4285,  6, 0, 0x02235}, // Because;
+  { 3249,  9, 0, 0x0212C}, // Bernoullis;
+  { 4082,  3, 0, 0x00392}, // Beta;
+  {   73,  2, 0, 0x1D505}, // Bfr;
+  { 6247,  3, 0, 0x1D539}, // Bopf;
+  { 3633,  4, 0, 0x002D8}, // Breve;
+  { 5721,  3, 0, 0x0212C}, // Bscr;
+  { 4772,  5, 0, 0x0224E}, // Bumpeq;
+  { 4779,  3, 0, 0x00427}, // CHcy;
+  { 6199,  2, 0, 0x000A9}, // COPY
+  { 6199,  3, 0, 0x000A9}, // COPY;
+  {   91,  5, 0, 0x00106}, // Cacute;
+  { 1799,  2, 0, 0x022D2}, // Cap;
+  {  276, 19, 0, 0x02145}, // CapitalDifferentialD;
+  { 4765,  6, 0, 0x0212D}, // Cayleys;
+  { 4907,  5, 0, 0x0010C}, // Ccaron;
+  { 5052,  4, 0, 0x000C7}, // Ccedil
+  { 5052,  5, 0, 0x000C7}, // Ccedil;
+  { 2993,  4, 0, 0x00108}, // Ccirc;
+  { 3701,  6, 0, 0x02230}, // Cconint;
+  { 1909,  3, 0, 0x0010A}, // Cdot;
+  { 4327,  6, 0, 0x000B8}, // Cedilla;
+  { 3493,  8, 0, 0x000B7}, // CenterDot;
+  {   73,  2, 0, 0x0212D}, // Cfr;
+  { 2965,  2, 0, 0x003A7}, // Chi;
+  { 3533,  8, 0, 0x02299}, // CircleDot;
+  { 2967, 10, 0, 0x02296}, // CircleMinus;
+  { 3195,  9, 0, 0x02295}, // CirclePlus;
+  { 2977, 10, 0, 0x02297}, // CircleTimes;
+  {    7, 23, 0, 0x02232}, // ClockwiseContourIntegral;
+  {  157, 20, 0, 0x0201D}, // CloseCurlyDoubleQuote;
+  { 1661, 14, 0, 0x02019}, // CloseCurlyQuote;
+  { 1699,  4, 0, 0x02237}, // Colon;
+  { 5222,  5, 0, 0x02A74}, // Colone;
+  { 2743,  8, 0, 0x02261}, // Congruent;
+  { 3702,  5, 0, 0x0222F}, // Conint;
+  {   16, 14, 0, 0x0222E}, // ContourIntegral;
+  { 6247,  3, 0, 0x02102}, // Copf;
+  { 3517,  8, 0, 0x02210}, // Coproduct;
+  {    0, 30, 0, 0x02233}, // CounterClockwiseContourIntegral;
+  { 4305,  4, 0, 0x02A2F}, // Cross;
+  { 5721,  3, 0, 0x1D49E}, // Cscr;
+  { 1799,  2, 0, 0x022D3}, // Cup;
+  { 3568,  5, 0, 0x0224D}, // CupCap;
+  {   29,  1, 0, 0x02145}, // DD;
+  { 3952,  7, 0, 0x02911}, // DDotrahd;
+  { 4779,  3, 0, 0x00402}, // DJcy;
+  { 4779,  3, 0, 0x00405}, // DScy;
+  { 4779,  3, 0, 0x0040F}, // DZcy;
+  { 4232,  5, 0, 0x02021}, // Dagger;
+  { 3872,  3, 0, 0x021A1}, // Darr;
+  { 5988,  4, 0, 0x02AE4}, // Dashv;
+  { 4907,  5, 0, 0x0010E}, // Dcaron;
+  { 4780,  2, 0, 0x00414}, // Dcy;
+  {   28,  2, 0, 0x02207}, // Del;
+  { 5876,  4, 0, 0x00394}, // Delta;
+  {   73,  2, 0, 0x1D507}, // Dfr;
+  { 1145, 15, 0, 0x000B4}, // DiacriticalAcute;
+  { 1899, 13, 0, 0x002D9}, // DiacriticalDot;
+  {   75, 21, 0, 0x002DD}, // DiacriticalDoubleAcute;
+  { 1160, 15, 0, 0x00060}, // DiacriticalGrave;
+  { 1175, 15, 0, 0x002DC}, // DiacriticalTilde;
+  { 4243,  6, 0, 0x022C4}, // Diamond;
+  {  283, 12, 0, 0x02146}, // DifferentialD;
+  { 6247,  3, 0, 0x1D53B}, // Dopf;
+  {  606,  2, 0, 0x000A8}, // Dot;
+  { 5587,  5, 0, 0x020DC}, // DotDot;
+  {  110,  7, 0, 0x02250}, // DotEqual;
+  {  237, 20, 0, 0x0222F}, // DoubleContourIntegral;
+  { 3613,  8, 0, 0x000A8}, // DoubleDot;
+  { 1829, 14, 0, 0x021D3}, // DoubleDownArrow;
+  { 1843, 14, 0, 0x021D0}, // DoubleLeftArrow;
+  {  390, 19, 0, 0x021D4}, // DoubleLeftRightArrow;
+  { 2539, 12, 0, 0x02AE4}, // DoubleLeftTee;
+  {  555, 18, 0, 0x027F8}, // DoubleLongLeftArrow;
+  {   30, 23, 0, 0x027FA}, // DoubleLongLeftRightArrow;
+  {  409, 19, 0, 0x027F9}, // DoubleLongRightArrow;
+  { 1490, 15, 0, 0x021D2}, // DoubleRightArrow;
+  { 2172, 13, 0, 0x022A8}, // DoubleRightTee;
+  { 2551, 12, 0, 0x021D1}, // DoubleUpArrow;
+  { 1082, 16, 0, 0x021D5}, // DoubleUpDownArrow;
+  {  317, 16, 0, 0x02225}, // DoubleVerticalBar;
+  { 1090,  8, 0, 0x02193}, // DownArrow;
+  { 2795, 11, 0, 0x02913}, // DownArrowBar;
+  { 1505, 15, 0, 0x021F5}, // DownArrowUpArrow;
+  { 3629,  8, 0, 0x00311}, // DownBreve;
+  {  573, 18, 0, 0x02950}, // DownLeftRightVector;
+  { 1098, 16, 0, 0x0295E}, // DownLeftTeeVector;
+  { 2237, 13, 0, 0x021BD}, // DownLeftVector;
+  { 1114, 16, 0, 0x02956}, // DownLeftVectorBar;
+  {  744, 17, 0, 0x0295F}, // DownRightTeeVector;
+  { 1871, 14, 0, 0x021C1}, // DownRightVector;
+  {  761, 17, 0, 0x02957}, // DownRightVectorBar;
+  { 4753,  6, 0, 0x022A4}, // DownTee;
+  { 2806, 11, 0, 0x021A7}, // DownTeeArrow;
+  { 2889,  8, 0, 0x021D3}, // Downarrow;
+  { 5721,  3, 0, 0x1D49F}, // Dscr;
+  { 5612,  5, 0, 0x00110}, // Dstrok;
+  { 6289,  2, 0, 0x0014A}, // ENG;
+  { 1788,  1, 0, 0x000D0}, // ETH
+  { 6094,  2, 0, 0x000D0}, // ETH;
+  {   91,  4, 0, 0x000C9}, // Eacute
+  {   91,  5, 0, 0x000C9}, // Eacute;
+  { 4907,  5, 0, 0x0011A}, // Ecaron;
+  { 2831,  3, 0, 0x000CA}, // Ecirc
+  { 2993,  4, 0, 0x000CA}, // Ecirc;
+  { 4780,  2, 0, 0x0042D}, // Ecy;
+  { 1909,  3, 0, 0x00116}, // Edot;
+  {   73,  2, 0, 0x1D508}, // Efr;
+  { 1170,  4, 0, 0x000C8}, // Egrave
+  { 1170,  5, 0, 0x000C8}, // Egrave;
+  { 1044,  6, 0, 0x02208}, // Element;
+  { 5720,  4, 0, 0x00112}, // Emacr;
+  { 1340, 15, 0, 0x025FB}, // EmptySmallSquare;
+  {  295, 19, 0, 0x025AB}, // EmptyVerySmallSquare;
+  { 5824,  4, 0, 0x00118}, // Eogon;
+  { 6247,  3, 0, 0x1D53C}, // Eopf;
+  { 1697,  6, 0, 0x00395}, // Epsilon;
+  {  113,  4, 0, 0x02A75}, // Equal;
+  { 2506,  9, 0, 0x02242}, // EqualTilde;
+  {  437, 10, 0, 0x021CC}, // Equilibrium;
+  { 5721,  3, 0, 0x02130}, // Escr;
+  { 3683,  3, 0, 0x02A73}, // Esim;
+  { 2209,  2, 0, 0x00397}, // Eta;
+  { 5837,  2, 0, 0x000CB}, // Euml
+  { 5837,  3, 0, 0x000CB}, // Euml;
+  { 3576,  5, 0, 0x02203}, // Exists;
+  { 2674, 11, 0, 0x02147}, // ExponentialE;
+  { 4780,  2, 0, 0x00424}, // Fcy;
+  {   73,  2, 0, 0x1D509}, // Ffr;
+  {  938, 16, 0, 0x025FC}, // FilledSmallSquare;
+  {  137, 20, 0, 0x025AA}, // FilledVerySmallSquare;
+  { 6247,  3, 0, 0x1D53D}, // Fopf;
+  { 5392,  5, 0, 0x02200}, // ForAll;
+  { 3348,  9, 0, 0x02131}, // Fouriertrf;
+  { 5721,  3, 0, 0x02131}, // Fscr;
+  { 4779,  3, 0, 0x00403}, // GJcy;
+  {    0,  0, 0, 0x0003E}, // GT
+  {   29,  1, 0, 0x0003E}, // GT;
+  { 2207,  4, 0, 0x00393}, // Gamma;
+  { 5272,  5, 0, 0x003DC}, // Gammad;
+  { 3632,  5, 0, 0x0011E}, // Gbreve;
+  { 5052,  5, 0, 0x00122}, // Gcedil;
+  { 2993,  4, 0, 0x0011C}, // Gcirc;
+  { 4780,  2, 0, 0x00413}, // Gcy;
+  { 1909,  3, 0, 0x00120}, // Gdot;
+  {   73,  2, 0, 0x1D50A}, // Gfr;
+  {   29,  1, 0, 0x022D9}, // Gg;
+  { 6247,  3, 0, 0x1D53E}, // Gopf;
+  { 1762, 11, 0, 0x02265}, // GreaterEqual;
+  { 1205, 15, 0, 0x022DB}, // GreaterEqualLess;
+  {  522, 15, 0, 0x02267}, // GreaterFullEqual;
+  {   62, 13, 0, 0x02AA2}, // GreaterGreater;
+  { 2123, 10, 0, 0x02277}, // GreaterLess;
+  {  336, 16, 0, 0x02A7E}, // GreaterSlantEqual;
+  { 1776, 11, 0, 0x02273}, // GreaterTilde;
+  { 5721,  3, 0, 0x1D4A2}, // Gscr;
+  {   29,  1, 0, 0x0226B}, // Gt;
+  { 4797,  5, 0, 0x0042A}, // HARDcy;
+  { 5776,  4, 0, 0x002C7}, // Hacek;
+  {  606,  2, 0, 0x0005E}, // Hat;
+  { 2993,  4, 0, 0x00124}, // Hcirc;
+  {   73,  2, 0, 0x0210C}, // Hfr;
+  { 2641, 11, 0, 0x0210B}, // HilbertSpace;
+  { 6247,  3, 0, 0x0210D}, // Hopf;
+  { 2081, 13, 0, 0x02500}, // HorizontalLine;
+  { 5721,  3, 0, 0x0210B}, // Hscr;
+  { 5612,  5, 0, 0x00126}, // Hstrok;
+  { 1790, 11, 0, 0x0224E}, // HumpDownHump;
+  { 2754,  8, 0, 0x0224F}, // HumpEqual;
+  { 4779,  3, 0, 0x00415}, // IEcy;
+  { 5153,  4, 0, 0x00132}, // IJlig;
+  { 4779,  3, 0, 0x00401}, // IOcy;
+  {   91,  4, 0, 0x000CD}, // Iacute
+  {   91,  5, 0, 0x000CD}, // Iacute;
+  { 2831,  3, 0, 0x000CE}, // Icirc
+  { 2993,  4, 0, 0x000CE}, // Icirc;
+  { 4780,  2, 0, 0x00418}, // Icy;
+  { 1909,  3, 0, 0x00130}, // Idot;
+  {   73,  2, 0, 0x02111}, // Ifr;
+  { 1170,  4, 0, 0x000CC}, // Igrave
+  { 1170,  5, 0, 0x000CC}, // Igrave;
+  {   29,  1, 0, 0x02111}, // Im;
+  { 5720,  4, 0, 0x0012A}, // Imacr;
+  { 3087,  9, 0, 0x02148}, // ImaginaryI;
+  { 2789,  6, 0, 0x021D2}, // Implies;
+  {  606,  2, 0, 0x0222C}, // Int;
+  {   23,  7, 0, 0x0222B}, // Integral;
+  {  716, 11, 0, 0x022C2}, // Intersection;
+  { 2198, 13, 0, 0x02063}, // InvisibleComma;
+  { 2211, 13, 0, 0x02062}, // InvisibleTimes;
+  { 5824,  4, 0, 0x0012E}, // Iogon;
+  { 6247,  3, 0, 0x1D540}, // Iopf;
+  { 4082,  3, 0, 0x00399}, // Iota;
+  { 5721,  3, 0, 0x02110}, // Iscr;
+  { 1185,  5, 0, 0x00128}, // Itilde;
+  { 5872,  4, 0, 0x00406}, // Iukcy;
+  { 5837,  2, 0, 0x000CF}, // Iuml
+  { 5837,  3, 0, 0x000CF}, // Iuml;
+  { 2993,  4, 0, 0x00134}, // Jcirc;
+  { 4780,  2, 0, 0x00419}, // Jcy;
+  {   73,  2, 0, 0x1D50D}, // Jfr;
+  { 6247,  3, 0, 0x1D541}, // Jopf;
+  { 5721,  3, 0, 0x1D4A5}, // Jscr;
+  { 5057,  5, 0, 0x00408}, // Jsercy;
+  { 5872,  4, 0, 0x00404}, // Jukcy;
+  { 4779,  3, 0, 0x00425}, // KHcy;
+  { 4779,  3, 0, 0x0040C}, // KJcy;
+  { 4046,  4, 0, 0x0039A}, // Kappa;
+  { 5052,  5, 0, 0x00136}, // Kcedil;
+  { 4780,  2, 0, 0x0041A}, // Kcy;
+  {   73,  2, 0, 0x1D50E}, // Kfr;
+  { 6247,  3, 0, 0x1D542}, // Kopf;
+  { 5721,  3, 0, 0x1D4A6}, // Kscr;
+  { 4779,  3, 0, 0x00409}, // LJcy;
+  {    0,  0, 0, 0x0003C}, // LT
+  {   29,  1, 0, 0x0003C}, // LT;
+  {   91,  5, 0, 0x00139}, // Lacute;
+  { 5237,  5, 0, 0x0039B}, // Lambda;
+  { 2638,  3, 0, 0x027EA}, // Lang;
+  { 3168,  9, 0, 0x02112}, // Laplacetrf;
+  { 3872,  3, 0, 0x0219E}, // Larr;
+  { 4907,  5, 0, 0x0013D}, // Lcaron;
+  { 5052,  5, 0, 0x0013B}, // Lcedil;
+  { 4780,  2, 0, 0x0041B}, // Lcy;
+  { 1220, 15, 0, 0x027E8}, // LeftAngleBracket;
+  {  511,  8, 0, 0x02190}, // LeftArrow;
+  { 2597, 11, 0, 0x021E4}, // LeftArrowBar;
+  {  447, 18, 0, 0x021C6}, // LeftArrowRightArrow;
+  { 2917, 10, 0, 0x02308}, // LeftCeiling;
+  {  810, 16, 0, 0x027E6}, // LeftDoubleBracket;
+  {  826, 16, 0, 0x02961}, // LeftDownTeeVector;
+  { 1925, 13, 0, 0x021C3}, // LeftDownVector;
+  {  842, 16, 0, 0x02959}, // LeftDownVectorBar;
+  { 3429,  8, 0, 0x0230A}, // LeftFloor;
+  {   40, 13, 0, 0x02194}, // LeftRightArrow;
+  {  577, 14, 0, 0x0294E}, // LeftRightVector;
+  { 2545,  6, 0, 0x022A3}, // LeftTee;
+  { 2608, 11, 0, 0x021A4}, // LeftTeeArrow;
+  { 1102, 12, 0, 0x0295A}, // LeftTeeVector;
+  { 1804, 11, 0, 0x022B2}, // LeftTriangle;
+  {  696, 14, 0, 0x029CF}, // LeftTriangleBar;
+  {  355, 16, 0, 0x022B4}, // LeftTriangleEqual;
+  { 1235, 15, 0, 0x02951}, // LeftUpDownVector;
+  { 1535, 14, 0, 0x02960}, // LeftUpTeeVector;
+  { 2619, 11, 0, 0x021BF}, // LeftUpVector;
+  { 1549, 14, 0, 0x02958}, // LeftUpVectorBar;
+  { 2241,  9, 0, 0x021BC}, // LeftVector;
+  { 1118, 12, 0, 0x02952}, // LeftVectorBar;
+  { 1332,  8, 0, 0x021D0}, // Leftarrow;
+  {  680, 13, 0, 0x021D4}, // Leftrightarrow;
+  { 1400, 15, 0, 0x022DA}, // LessEqualGreater;
+  { 2491, 12, 0, 0x02266}, // LessFullEqual;
+  { 2136, 10, 0, 0x02276}, // LessGreater;
+  { 1027,  7, 0, 0x02AA1}, // LessLess;
+  { 1005, 13, 0, 0x02A7D}, // LessSlantEqual;
+  { 2776,  8, 0, 0x02272}, // LessTilde;
+  {   73,  2, 0, 0x1D50F}, // Lfr;
+  {   29,  1, 0, 0x022D8}, // Ll;
+  { 1331,  9, 0, 0x021DA}, // Lleftarrow;
+  { 5132,  5, 0, 0x0013F}, // Lmidot;
+  {  561, 12, 0, 0x027F5}, // LongLeftArrow;
+  {   36, 17, 0, 0x027F7}, // LongLeftRightArrow;
+  {  415, 13, 0, 0x027F6}, // LongRightArrow;
+  { 2407, 12, 0, 0x027F8}, // Longleftarrow;
+  {  676, 17, 0, 0x027FA}, // Longleftrightarrow;
+  { 2003, 13, 0, 0x027F9}, // Longrightarrow;
+  { 6247,  3, 0, 0x1D543}, // Lopf;
+  { 2224, 13, 0, 0x02199}, // LowerLeftArrow;
+  { 1857, 14, 0, 0x02198}, // LowerRightArrow;
+  { 5721,  3, 0, 0x02112}, // Lscr;
+  { 3005,  2, 0, 0x021B0}, // Lsh;
+  { 5612,  5, 0, 0x00141}, // Lstrok;
+  {   29,  1, 0, 0x0226A}, // Lt;
+  { 1799,  2, 0, 0x02905}, // Map;
+  { 4780,  2, 0, 0x0041C}, // Mcy;
+  {  491, 10, 0, 0x0205F}, // MediumSpace;
+  { 3477,  8, 0, 0x02133}, // Mellintrf;
+  {   73,  2, 0, 0x1D510}, // Mfr;
+  { 3509,  8, 0, 0x02213}, // MinusPlus;
+  { 6247,  3, 0, 0x1D544}, // Mopf;
+  { 5721,  3, 0, 0x02133}, // Mscr;
+  {   29,  1, 0, 0x0039C}, // Mu;
+  { 4779,  3, 0, 0x0040A}, // NJcy;
+  {   91,  5, 0, 0x00143}, // Nacute;
+  { 4907,  5, 0, 0x00147}, // Ncaron;
+  { 5052,  5, 0, 0x00145}, // Ncedil;
+  { 4780,  2, 0, 0x0041D}, // Ncy;
+  {  483, 18, 0, 0x0200B}, // NegativeMediumSpace;
+  {  608, 17, 0, 0x0200B}, // NegativeThickSpace;
+  {  874, 16, 0, 0x0200B}, // NegativeThinSpace;
+  {  117, 20, 0, 0x0200B}, // NegativeVeryThinSpace;
+  {   56, 19, 0, 0x0226B}, // NestedGreaterGreater;
+  { 1021, 13, 0, 0x0226A}, // NestedLessLess;
+  { 4747,  6, 0, 0x0000A}, // NewLine;
+  {   73,  2, 0, 0x1D511}, // Nfr;
+  { 4225,  6, 0, 0x02060}, // NoBreak;
+  { 1310, 15, 0, 0x000A0}, // NonBreakingSpace;
+  { 6247,  3, 0, 0x02115}, // Nopf;
+  {  606,  2, 0, 0x02AEC}, // Not;
+  { 2740, 11, 0, 0x02262}, // NotCongruent;
+  { 3565,  8, 0, 0x0226D}, // NotCupCap;
+  {  314, 19, 0, 0x02226}, // NotDoubleVerticalBar;
+  { 3303,  9, 0, 0x02209}, // NotElement;
+  {  110,  7, 0, 0x02260}, // NotEqual;
+  { 2503, 12, 4, 0x02242}, // NotEqualTilde;
+  { 3573,  8, 0, 0x02204}, // NotExists;
+  { 3312,  9, 0, 0x0226F}, // NotGreater;
+  { 1759, 14, 0, 0x02271}, // NotGreaterEqual;
+  {  519, 18, 4, 0x02267}, // NotGreaterFullEqual;
+  {  986, 16, 4, 0x0226B}, // NotGreaterGreater;
+  { 2120, 13, 0, 0x02279}, // NotGreaterLess;
+  {  333, 19, 4, 0x02A7E}, // NotGreaterSlantEqual;
+  { 1773, 14, 0, 0x02275}, // NotGreaterTilde;
+  { 1787, 14, 4, 0x0224E}, // NotHumpDownHump;
+  { 2751, 11, 4, 0x0224F}, // NotHumpEqual;
+  { 1801, 14, 0, 0x022EA}, // NotLeftTriangle;
+  {  693, 17, 4, 0x029CF}, // NotLeftTriangleBar;
+  {  352, 19, 0, 0x022EC}, // NotLeftTriangleEqual;
+  { 4645,  6, 0, 0x0226E}, // NotLess;
+  { 2762, 11, 0, 0x02270}, // NotLessEqual;
+  { 2133, 13, 0, 0x02278}, // NotLessGreater;
+  { 3037, 10, 4, 0x0226A}, // NotLessLess;
+  { 1002, 16, 4, 0x02A7D}, // NotLessSlantEqual;
+  { 2773, 11, 0, 0x02274}, // NotLessTilde;
+  {   53, 22, 4, 0x02AA2}, // NotNestedGreaterGreater;
+  { 1018, 16, 4, 0x02AA1}, // NotNestedLessLess;
+  { 3047, 10, 0, 0x02280}, // NotPrecedes;
+  { 1415, 15, 4, 0x02AAF}, // NotPrecedesEqual;
+  {  177, 20, 0, 0x022E0}, // NotPrecedesSlantEqual;
+  { 1034, 16, 0, 0x0220C}, // NotReverseElement;
+  { 1430, 15, 0, 0x022EB}, // NotRightTriangle;
+  {  537, 18, 4, 0x029D0}, // NotRightTriangleBar;
+  {  197, 20, 0, 0x022ED}, // NotRightTriangleEqual;
+  { 1815, 14, 4, 0x0228F}, // NotSquareSubset;
+  {  371, 19, 0, 0x022E2}, // NotSquareSubsetEqual;
+  { 1050, 16, 4, 0x02290}, // NotSquareSuperset;
+  {   96, 21, 0, 0x022E3}, // NotSquareSupersetEqual;
+  { 3581,  8, 6, 0x02282}, // NotSubset;
+  { 2146, 13, 0, 0x02288}, // NotSubsetEqual;
+  { 3057, 10, 0, 0x02281}, // NotSucceeds;
+  { 1445, 15, 4, 0x02AB0}, // NotSucceedsEqual;
+  {  217, 20, 0, 0x022E1}, // NotSucceedsSlantEqual;
+  { 1460, 15, 4, 0x0227F}, // NotSucceedsTilde;
+  { 3067, 10, 6, 0x02283}, // NotSuperset;
+  { 1475, 15, 0, 0x02289}, // NotSupersetEqual;
+  { 4141,  7, 0, 0x02241}, // NotTilde;
+  { 2515, 12, 0, 0x02244}, // NotTildeEqual;
+  { 1066, 16, 0, 0x02247}, // NotTildeFullEqual;
+  { 2527, 12, 0, 0x02249}, // NotTildeTilde;
+  { 2159, 13, 0, 0x02224}, // NotVerticalBar;
+  { 5721,  3, 0, 0x1D4A9}, // Nscr;
+  { 1068,  4, 0, 0x000D1}, // Ntilde
+  { 1185,  5, 0, 0x000D1}, // Ntilde;
+  {   29,  1, 0, 0x0039D}, // Nu;
+  { 5153,  4, 0, 0x00152}, // OElig;
+  {   91,  4, 0, 0x000D3}, // Oacute
+  {   91,  5, 0, 0x000D3}, // Oacute;
+  { 2831,  3, 0, 0x000D4}, // Ocirc
+  { 2993,  4, 0, 0x000D4}, // Ocirc;
+  { 4780,  2, 0, 0x0041E}, // Ocy;
+  { 4947,  5, 0, 0x00150}, // Odblac;
+  {   73,  2, 0, 0x1D512}, // Ofr;
+  { 1170,  4, 0, 0x000D2}, // Ograve
+  { 1170,  5, 0, 0x000D2}, // Ograve;
+  { 5720,  4, 0, 0x0014C}, // Omacr;
+  { 5800,  4, 0, 0x003A9}, // Omega;
+  { 4393,  6, 0, 0x0039F}, // Omicron;
+  { 6247,  3, 0, 0x1D546}, // Oopf;
+  {  257, 19, 0, 0x0201C}, // OpenCurlyDoubleQuote;
+  { 1912, 13, 0, 0x02018}, // OpenCurlyQuote;
+  {   29,  1, 0, 0x02A54}, // Or;
+  { 5721,  3, 0, 0x1D4AA}, // Oscr;
+  { 3392,  4, 0, 0x000D8}, // Oslash
+  { 3392,  5, 0, 0x000D8}, // Oslash;
+  { 1068,  4, 0, 0x000D5}, // Otilde
+  { 1185,  5, 0, 0x000D5}, // Otilde;
+  { 1628,  5, 0, 0x02A37}, // Otimes;
+  { 5837,  2, 0, 0x000D6}, // Ouml
+  { 5837,  3, 0, 0x000D6}, // Ouml;
+  { 3715,  6, 0, 0x0203E}, // OverBar;
+  { 3106,  8, 0, 0x023DE}, // OverBrace;
+  { 2587, 10, 0, 0x023B4}, // OverBracket;
+  { 1191, 14, 0, 0x023DC}, // OverParenthesis;
+  { 4085,  7, 0, 0x02202}, // PartialD;
+  { 4780,  2, 0, 0x0041F}, // Pcy;
+  {   73,  2, 0, 0x1D513}, // Pfr;
+  { 2965,  2, 0, 0x003A6}, // Phi;
+  {   29,  1, 0, 0x003A0}, // Pi;
+  { 3621,  8, 0, 0x000B1}, // PlusMinus;
+  { 2383, 12, 0, 0x0210C}, // Poincareplane;
+  { 6247,  3, 0, 0x02119}, // Popf;
+  {   29,  1, 0, 0x02ABB}, // Pr;
+  { 3050,  7, 0, 0x0227A}, // Precedes;
+  { 1418, 12, 0, 0x02AAF}, // PrecedesEqual;
+  {  180, 17, 0, 0x0227C}, // PrecedesSlantEqual;
+  { 2299, 12, 0, 0x0227E}, // PrecedesTilde;
+  { 3377,  4, 0, 0x02033}, // Prime;
+  { 3519,  6, 0, 0x0220F}, // Product;
+  { 3150,  9, 0, 0x02237}, // Proportion;
+  { 2652, 11, 0, 0x0221D}, // Proportional;
+  { 5721,  3, 0, 0x1D4AB}, // Pscr;
+  { 2965,  2, 0, 0x003A8}, // Psi;
+  { 6196,  2, 0, 0x00022}, // QUOT
+  { 6196,  3, 0, 0x00022}, // QUOT;
+  {   73,  2, 0, 0x1D514}, // Qfr;
+  { 6247,  3, 0, 0x0211A}, // Qopf;
+  { 5721,  3, 0, 0x1D4AC}, // Qscr;
+  { 3871,  4, 0, 0x02910}, // RBarr;
+  {   60,  1, 0, 0x000AE}, // REG
+  { 6289,  2, 0, 0x000AE}, // REG;
+  {   91,  5, 0, 0x00154}, // Racute;
+  { 2638,  3, 0, 0x027EB}, // Rang;
+  { 3872,  3, 0, 0x021A0}, // Rarr;
+  { 5527,  5, 0, 0x02916}, // Rarrtl;
+  { 4907,  5, 0, 0x00158}, // Rcaron;
+  { 5052,  5, 0, 0x00156}, // Rcedil;
+  { 4780,  2, 0, 0x00420}, // Rcy;
+  {   29,  1, 0, 0x0211C}, // Re;
+  { 1037, 13, 0, 0x0220B}, // ReverseElement;
+  {  727, 17, 0, 0x021CB}, // ReverseEquilibrium;
+  {  428, 19, 0, 0x0296F}, // ReverseUpEquilibrium;
+  {   73,  2, 0, 0x0211C}, // Rfr;
+  { 3148,  2, 0, 0x003A1}, // Rho;
+  {  890, 16, 0, 0x027E9}, // RightAngleBracket;
+  {   44,  9, 0, 0x02192}, // RightArrow;
+  { 2335, 12, 0, 0x021E5}, // RightArrowBar;
+  {  501, 18, 0, 0x021C4}, // RightArrowLeftArrow;
+  { 2630, 11, 0, 0x02309}, // RightCeiling;
+  {  625, 17, 0, 0x027E7}, // RightDoubleBracket;
+  {  642, 17, 0, 0x0295D}, // RightDownTeeVector;
+  { 1591, 14, 0, 0x021C2}, // RightDownVector;
+  {  659, 17, 0, 0x02955}, // RightDownVectorBar;
+  { 3123,  9, 0, 0x0230B}, // RightFloor;
+  { 2178,  7, 0, 0x022A2}, // RightTee;
+  { 2347, 12, 0, 0x021A6}, // RightTeeArrow;
+  {  748, 13, 0, 0x0295B}, // RightTeeVector;
+  { 1433, 12, 0, 0x022B3}, // RightTriangle;
+  {  540, 15, 0, 0x029D0}, // RightTriangleBar;
+  {  200, 17, 0, 0x022B5}, // RightTriangleEqual;
+  {  906, 16, 0, 0x0294F}, // RightUpDownVector;
+  { 1250, 15, 0, 0x0295C}, // RightUpTeeVector;
+  { 2359, 12, 0, 0x021BE}, // RightUpVector;
+  { 1265, 15, 0, 0x02954}, // RightUpVectorBar;
+  {  581, 10, 0, 0x021C0}, // RightVector;
+  {  765, 13, 0, 0x02953}, // RightVectorBar;
+  {  684,  9, 0, 0x021D2}, // Rightarrow;
+  { 6247,  3, 0, 0x0211D}, // Ropf;
+  { 2784, 11, 0, 0x02970}, // RoundImplies;
+  {  683, 10, 0, 0x021DB}, // Rrightarrow;
+  { 5721,  3, 0, 0x0211B}, // Rscr;
+  { 3005,  2, 0, 0x021B1}, // Rsh;
+  { 2937, 10, 0, 0x029F4}, // RuleDelayed;
+  { 4777,  5, 0, 0x00429}, // SHCHcy;
+  { 4779,  3, 0, 0x00428}, // SHcy;
+  { 4787,  5, 0, 0x0042C}, // SOFTcy;
+  {   91,  5, 0, 0x0015A}, // Sacute;
+  {   29,  1, 0, 0x02ABC}, // Sc;
+  { 4907,  5, 0, 0x00160}, // Scaron;
+  { 5052,  5, 0, 0x0015E}, // Scedil;
+  { 2993,  4, 0, 0x0015C}, // Scirc;
+  { 4780,  2, 0, 0x00421}, // Scy;
+  {   73,  2, 0, 0x1D516}, // Sfr;
+  { 2042, 13, 0, 0x02193}, // ShortDownArrow;
+  { 2055, 13, 0, 0x02190}, // ShortLeftArrow;
+  { 1647, 14, 0, 0x02192}, // ShortRightArrow;
+  { 2663, 11, 0, 0x02191}, // ShortUpArrow;
+  { 4074,  4, 0, 0x003A3}, // Sigma;
+  { 2827, 10, 0, 0x02218}, // SmallCircle;
+  { 6247,  3, 0, 0x1D54A}, // Sopf;
+  { 3648,  3, 0, 0x0221A}, // Sqrt;
+  {  152,  5, 0, 0x025A1}, // Square;
+  {  710, 17, 0, 0x02293}, // SquareIntersection;
+  { 1818, 11, 0, 0x0228F}, // SquareSubset;
+  {  374, 16, 0, 0x02291}, // SquareSubsetEqual;
+  { 1053, 13, 0, 0x02290}, // SquareSuperset;
+  {   99, 18, 0, 0x02292}, // SquareSupersetEqual;
+  { 3077, 10, 0, 0x02294}, // SquareUnion;
+  { 5721,  3, 0, 0x1D4AE}, // Sscr;
+  {  330,  3, 0, 0x022C6}, // Star;
+  { 3782,  2, 0, 0x022D0}, // Sub;
+  { 1824,  5, 0, 0x022D0}, // Subset;
+  {  380, 10, 0, 0x02286}, // SubsetEqual;
+  { 3060,  7, 0, 0x0227B}, // Succeeds;
+  { 1448, 12, 0, 0x02AB0}, // SucceedsEqual;
+  {  220, 17, 0, 0x0227D}, // SucceedsSlantEqual;
+  { 1463, 12, 0, 0x0227F}, // SucceedsTilde;
+  { 3686,  7, 0, 0x0220B}, // SuchThat;
+  {  445,  2, 0, 0x02211}, // Sum;
+  { 1799,  2, 0, 0x022D1}, // Sup;
+  { 1059,  7, 0, 0x02283}, // Superset;
+  {  105, 12, 0, 0x02287}, // SupersetEqual;
+  { 4129,  5, 0, 0x022D1}, // Supset;
+  { 5716,  3, 0, 0x000DE}, // THORN
+  { 5716,  4, 0, 0x000DE}, // THORN;
+  { 5712,  4, 0, 0x02122}, // TRADE;
+  { 4778,  4, 0, 0x0040B}, // TSHcy;
+  { 4779,  3, 0, 0x00426}, // TScy;
+  { 3782,  2, 0, 0x00009}, // Tab;
+  { 4475,  2, 0, 0x003A4}, // Tau;
+  { 4907,  5, 0, 0x00164}, // Tcaron;
+  { 5052,  5, 0, 0x00162}, // Tcedil;
+  { 4780,  2, 0, 0x00422}, // Tcy;
+  {   73,  2, 0, 0x1D517}, // Tfr;
+  { 3413,  8, 0, 0x02234}, // Therefore;
+  { 4081,  4, 0, 0x00398}, // Theta;
+  {  616,  9, 5, 0x0205F}, // ThickSpace;
+  {  129,  8, 0, 0x02009}, // ThinSpace;
+  { 1186,  4, 0, 0x0223C}, // Tilde;
+  { 2518,  9, 0, 0x02243}, // TildeEqual;
+  { 1069, 13, 0, 0x02245}, // TildeFullEqual;
+  { 2530,  9, 0, 0x02248}, // TildeTilde;
+  { 6247,  3, 0, 0x1D54B}, // Topf;
+  { 3469,  8, 0, 0x020DB}, // TripleDot;
+  { 5721,  3, 0, 0x1D4AF}, // Tscr;
+  { 5612,  5, 0, 0x00166}, // Tstrok;
+  {   91,  4, 0, 0x000DA}, // Uacute
+  {   91,  5, 0, 0x000DA}, // Uacute;
+  { 3872,  3, 0, 0x0219F}, // Uarr;
+  { 4064,  7, 0, 0x02949}, // Uarrocir;
+  { 5058,  4, 0, 0x0040E}, // Ubrcy;
+  { 3632,  5, 0, 0x0016C}, // Ubreve;
+  { 2831,  3, 0, 0x000DB}, // Ucirc
+  { 2993,  4, 0, 0x000DB}, // Ucirc;
+  { 4780,  2, 0, 0x00423}, // Ucy;
+  { 4947,  5, 0, 0x00170}, // Udblac;
+  {   73,  2, 0, 0x1D518}, // Ufr;
+  { 1170,  4, 0, 0x000D9}, // Ugrave
+  { 1170,  5, 0, 0x000D9}, // Ugrave;
+  { 5720,  4, 0, 0x0016A}, // Umacr;
+  { 3714,  7, 0, 0x0005F}, // UnderBar;
+  { 3105,  9, 0, 0x023DF}, // UnderBrace;
+  { 2586, 11, 0, 0x023B5}, // UnderBracket;
+  { 1190, 15, 0, 0x023DD}, // UnderParenthesis;
+  {  723,  4, 0, 0x022C3}, // Union;
+  { 3461,  8, 0, 0x0228E}, // UnionPlus;
+  { 5824,  4, 0, 0x00172}, // Uogon;
+  { 6247,  3, 0, 0x1D54C}, // Uopf;
+  {   47,  6, 0, 0x02191}, // UpArrow;
+  { 2338,  9, 0, 0x02912}, // UpArrowBar;
+  { 1130, 15, 0, 0x021C5}, // UpArrowDownArrow;
+  { 1088, 10, 0, 0x02195}, // UpDownArrow;
+  {  435, 12, 0, 0x0296E}, // UpEquilibrium;
+  { 2181,  4, 0, 0x022A5}, // UpTee;
+  { 2350,  9, 0, 0x021A5}, // UpTeeArrow;
+  {  477,  6, 0, 0x021D1}, // Uparrow;
+  { 2887, 10, 0, 0x021D5}, // Updownarrow;
+  { 2068, 13, 0, 0x02196}, // UpperLeftArrow;
+  { 1675, 14, 0, 0x02197}, // UpperRightArrow;
+  { 5949,  3, 0, 0x003D2}, // Upsi;
+  { 1697,  6, 0, 0x003A5}, // Upsilon;
+  { 2637,  4, 0, 0x0016E}, // Uring;
+  { 5721,  3, 0, 0x1D4B0}, // Uscr;
+  { 1185,  5, 0, 0x00168}, // Utilde;
+  { 5837,  2, 0, 0x000DC}, // Uuml
+  { 5837,  3, 0, 0x000DC}, // Uuml;
+  { 3003,  4, 0, 0x022AB}, // VDash;
+  {  330,  3, 0, 0x02AEB}, // Vbar;
+  { 4780,  2, 0, 0x00412}, // Vcy;
+  { 3003,  4, 0, 0x022A9}, // Vdash;
+  { 4932,  5, 0, 0x02AE6}, // Vdashl;
+  {   94,  2, 0, 0x022C1}, // Vee;
+  { 5417,  5, 0, 0x02016}, // Verbar;
+  { 3648,  3, 0, 0x02016}, // Vert;
+  {  323, 10, 0, 0x02223}, // VerticalBar;
+  { 2718, 11, 0, 0x0007C}, // VerticalLine;
+  {  970, 16, 0, 0x02758}, // VerticalSeparator;
+  { 2479, 12, 0, 0x02240}, // VerticalTilde;
+  {  125, 12, 0, 0x0200A}, // VeryThinSpace;
+  {   73,  2, 0, 0x1D519}, // Vfr;
+  { 6247,  3, 0, 0x1D54D}, // Vopf;
+  { 5721,  3, 0, 0x1D4B1}, // Vscr;
+  { 3002,  5, 0, 0x022AA}, // Vvdash;
+  { 2993,  4, 0, 0x00174}, // Wcirc;
+  { 2194,  4, 0, 0x022C0}, // Wedge;
+  {   73,  2, 0, 0x1D51A}, // Wfr;
+  { 6247,  3, 0, 0x1D54E}, // Wopf;
+  { 5721,  3, 0, 0x1D4B2}, // Wscr;
+  {   73,  2, 0, 0x1D51B}, // Xfr;
+  {   29,  1, 0, 0x0039E}, // Xi;
+  { 6247,  3, 0, 0x1D54F}, // Xopf;
+  { 5721,  3, 0, 0x1D4B3}, // Xscr;
+  { 4779,  3, 0, 0x0042F}, // YAcy;
+  { 4779,  3, 0, 0x00407}, // YIcy;
+  { 4779,  3, 0, 0x0042E}, // YUcy;
+  {   91,  4, 0, 0x000DD}, // Yacute
+  {   91,  5, 0, 0x000DD}, // Yacute;
+  { 2993,  4, 0, 0x00176}, // Ycirc;
+  { 4780,  2, 0, 0x0042B}, // Ycy;
+  {   73,  2, 0, 0x1D51C}, // Yfr;
+  { 6247,  3, 0, 0x1D550}, // Yopf;
+  { 5721,  3, 0, 0x1D4B4}, // Yscr;
+  { 5837,  3, 0, 0x00178}, // Yuml;
+  { 4779,  3, 0, 0x00416}, // ZHcy;
+  {   91,  5, 0, 0x00179}, // Zacute;
+  { 4907,  5, 0, 0x0017D}, // Zcaron;
+  { 4780,  2, 0, 0x00417}, // Zcy;
+  { 1909,  3, 0, 0x0017B}, // Zdot;
+  { 2094, 13, 0, 0x0200B}, // ZeroWidthSpace;
+  { 4082,  3, 0, 0x00396}, // Zeta;
+  {   73,  2, 0, 0x02128}, // Zfr;
+  { 6247,  3, 0, 0x02124}, // Zopf;
+  { 5721,  3, 0, 0x1D4B5}, // Zscr;
+  {   91,  4, 0, 0x000E1}, // aacute
+  {   91,  5, 0, 0x000E1}, // aacute;
+  { 3632,  5, 0, 0x00103}, // abreve;
+  {   29,  1, 0, 0x0223E}, // ac;
+  { 2683,  2, 3, 0x0223E}, // acE;
+  { 2945,  2, 0, 0x0223F}, // acd;
+  { 2831,  3, 0, 0x000E2}, // acirc
+  { 2993,  4, 0, 0x000E2}, // acirc;
+  {   92,  3, 0, 0x000B4}, // acute
+  {   92,  4, 0, 0x000B4}, // acute;
+  { 4780,  2, 0, 0x00430}, // acy;
+  { 5153,  3, 0, 0x000E6}, // aelig
+  { 5153,  4, 0, 0x000E6}, // aelig;
+  {   29,  1, 0, 0x02061}, // af;
+  {   73,  2, 0, 0x1D51E}, // afr;
+  { 1170,  4, 0, 0x000E0}, // agrave
+  { 1170,  5, 0, 0x000E0}, // agrave;
+  { 4339,  6, 0, 0x02135}, // alefsym;
+  { 5812,  4, 0, 0x02135}, // aleph;
+  { 5936,  4, 0, 0x003B1}, // alpha;
+  { 5720,  4, 0, 0x00101}, // amacr;
+  { 5732,  4, 0, 0x02A3F}, // amalg;
+  {  105,  1, 0, 0x00026}, // amp
+  { 1799,  2, 0, 0x00026}, // amp;
+  { 2945,  2, 0, 0x02227}, // and;
+  { 5012,  5, 0, 0x02A55}, // andand;
+  { 6211,  3, 0, 0x02A5C}, // andd;
+  { 3721,  7, 0, 0x02A58}, // andslope;
+  { 6220,  3, 0, 0x02A5A}, // andv;
+  { 2639,  2, 0, 0x02220}, // ang;
+  { 2195,  3, 0, 0x029A4}, // ange;
+  { 1441,  4, 0, 0x02220}, // angle;
+  { 5102,  5, 0, 0x02221}, // angmsd;
+  { 3770,  7, 0, 0x029A8}, // angmsdaa;
+  { 3777,  7, 0, 0x029A9}, // angmsdab;
+  { 3784,  7, 0, 0x029AA}, // angmsdac;
+  { 3791,  7, 0, 0x029AB}, // angmsdad;
+  { 3798,  7, 0, 0x029AC}, // angmsdae;
+  { 3805,  7, 0, 0x029AD}, // angmsdaf;
+  { 3812,  7, 0, 0x029AE}, // angmsdag;
+  { 3819,  7, 0, 0x029AF}, // angmsdah;
+  { 5303,  4, 0, 0x0221F}, // angrt;
+  { 4375,  6, 0, 0x022BE}, // angrtvb;
+  { 3833,  7, 0, 0x0299D}, // angrtvbd;
+  { 5112,  5, 0, 0x02222}, // angsph;
+  { 5828,  4, 0, 0x000C5}, // angst;
+  { 4387,  6, 0, 0x0237C}, // angzarr;
+  { 5824,  4, 0, 0x00105}, // aogon;
+  { 6247,  3, 0, 0x1D552}, // aopf;
+  {   29,  1, 0, 0x02248}, // ap;
+  { 2683,  2, 0, 0x02A70}, // apE;
+  { 4199,  5, 0, 0x02A6F}, // apacir;
+  {   94,  2, 0, 0x0224A}, // ape;
+  { 3450,  3, 0, 0x0224B}, // apid;
+  { 5609,  3, 0, 0x00027}, // apos;
+  { 2872,  5, 0, 0x02248}, // approx;
+  { 3987,  7, 0, 0x0224A}, // approxeq;
+  { 1316,  3, 0, 0x000E5}, // aring
+  { 2637,  4, 0, 0x000E5}, // aring;
+  { 5721,  3, 0, 0x1D4B6}, // ascr;
+  {  606,  2, 0, 0x0002A}, // ast;
+  { 6192,  4, 0, 0x02248}, // asymp;
+  { 4771,  6, 0, 0x0224D}, // asympeq;
+  { 1068,  4, 0, 0x000E3}, // atilde
+  { 1185,  5, 0, 0x000E3}, // atilde;
+  { 5837,  2, 0, 0x000E4}, // auml
+  { 5837,  3, 0, 0x000E4}, // auml;
+  { 3700,  7, 0, 0x02233}, // awconint;
+  { 3661,  4, 0, 0x02A11}, // awint;
+  { 1909,  3, 0, 0x02AED}, // bNot;
+  { 3693,  7, 0, 0x0224C}, // backcong;
+  { 2877, 10, 0, 0x003F6}, // backepsilon;
+  { 3373,  8, 0, 0x02035}, // backprime;
+  { 3862,  6, 0, 0x0223D}, // backsim;
+  { 3381,  8, 0, 0x022CD}, // backsimeq;
+  { 5532,  5, 0, 0x022BD}, // barvee;
+  { 5537,  5, 0, 0x02305}, // barwed;
+  { 2191,  7, 0, 0x02305}, // barwedge;
+  { 3402,  3, 0, 0x023B5}, // bbrk;
+  { 4050,  7, 0, 0x023B6}, // bbrktbrk;
+  { 3696,  4, 0, 0x0224C}, // bcong;
+  { 4780,  2, 0, 0x00431}, // bcy;
+  { 4893,  4, 0, 0x0201E}, // bdquo;
+  { 4982,  5, 0, 0x02235}, // becaus;
+  { 4285,  6, 0, 0x02235}, // because;
+  { 3743,  6, 0, 0x029B0}, // bemptyv;
+  { 5948,  4, 0, 0x003F6}, // bepsi;
+  { 5477,  5, 0, 0x0212C}, // bernou;
+  { 4082,  3, 0, 0x003B2}, // beta;
+  { 5044,  3, 0, 0x02136}, // beth;
+  { 4705,  6, 0, 0x0226C}, // between;
+  {   73,  2, 0, 0x1D51F}, // bfr;
+  { 5082,  5, 0, 0x022C2}, // bigcap;
+  { 4363,  6, 0, 0x025EF}, // bigcirc;
+  { 5087,  5, 0, 0x022C3}, // bigcup;
+  { 4369,  6, 0, 0x02A00}, // bigodot;
+  { 3826,  7, 0, 0x02A01}, // bigoplus;
+  { 3437,  8, 0, 0x02A02}, // bigotimes;
+  { 3840,  7, 0, 0x02A06}, // bigsqcup;
+  { 4381,  6, 0, 0x02605}, // bigstar;
+  { 1633, 14, 0, 0x025BD}, // bigtriangledown;
+  { 2371, 12, 0, 0x025B3}, // bigtriangleup;
+  { 3847,  7, 0, 0x02A04}, // biguplus;
+  { 5117,  5, 0, 0x022C1}, // bigvee;
+  { 3854,  7, 0, 0x022C0}, // bigwedge;
+  { 3667,  5, 0, 0x0290D}, // bkarow;
+  { 2575, 11, 0, 0x029EB}, // blacklozenge;
+  { 2817, 10, 0, 0x025AA}, // blacksquare;
+  { 2263, 12, 0, 0x025B4}, // blacktriangle;
+  {  778, 16, 0, 0x025BE}, // blacktriangledown;
+  {  794, 16, 0, 0x025C2}, // blacktriangleleft;
+  {  591, 17, 0, 0x025B8}, // blacktriangleright;
+  { 5744,  4, 0, 0x02423}, // blank;
+  { 5856,  4, 0, 0x02592}, // blk12;
+  { 5860,  4, 0, 0x02591}, // blk14;
+  { 5864,  4, 0, 0x02593}, // blk34;
+  { 5912,  4, 0, 0x02588}, // block;
+  {   94,  2, 7, 0x0003D}, // bne;
+  { 4345,  6, 7, 0x02261}, // bnequiv;
+  { 1909,  3, 0, 0x02310}, // bnot;
+  { 6247,  3, 0, 0x1D553}, // bopf;
+  {  606,  2, 0, 0x022A5}, // bot;
+  { 5617,  5, 0, 0x022A5}, // bottom;
+  { 5697,  5, 0, 0x022C8}, // bowtie;
+  { 6044,  4, 0, 0x02557}, // boxDL;
+  { 6048,  4, 0, 0x02554}, // boxDR;
+  { 6052,  4, 0, 0x02556}, // boxDl;
+  { 6056,  4, 0, 0x02553}, // boxDr;
+  { 6274,  3, 0, 0x02550}, // boxH;
+  { 6060,  4, 0, 0x02566}, // boxHD;
+  { 6064,  4, 0, 0x02569}, // boxHU;
+  { 6068,  4, 0, 0x02564}, // boxHd;
+  { 6072,  4, 0, 0x02567}, // boxHu;
+  { 6076,  4, 0, 0x0255D}, // boxUL;
+  { 6080,  4, 0, 0x0255A}, // boxUR;
+  { 6084,  4, 0, 0x0255C}, // boxUl;
+  { 6088,  4, 0, 0x02559}, // boxUr;
+  { 6277,  3, 0, 0x02551}, // boxV;
+  { 6092,  4, 0, 0x0256C}, // boxVH;
+  { 6096,  4, 0, 0x02563}, // boxVL;
+  { 6100,  4, 0, 0x02560}, // boxVR;
+  { 6104,  4, 0, 0x0256B}, // boxVh;
+  { 6108,  4, 0, 0x02562}, // boxVl;
+  { 6112,  4, 0, 0x0255F}, // boxVr;
+  { 5702,  5, 0, 0x029C9}, // boxbox;
+  { 6120,  4, 0, 0x02555}, // boxdL;
+  { 6124,  4, 0, 0x02552}, // boxdR;
+  { 6128,  4, 0, 0x02510}, // boxdl;
+  { 6132,  4, 0, 0x0250C}, // boxdr;
+  { 6280,  3, 0, 0x02500}, // boxh;
+  { 6136,  4, 0, 0x02565}, // boxhD;
+  { 6140,  4, 0, 0x02568}, // boxhU;
+  { 6144,  4, 0, 0x0252C}, // boxhd;
+  { 6148,  4, 0, 0x02534}, // boxhu;
+  { 4211,  7, 0, 0x0229F}, // boxminus;
+  { 4759,  6, 0, 0x0229E}, // boxplus;
+  { 4218,  7, 0, 0x022A0}, // boxtimes;
+  { 6152,  4, 0, 0x0255B}, // boxuL;
+  { 6156,  4, 0, 0x02558}, // boxuR;
+  { 6160,  4, 0, 0x02518}, // boxul;
+  { 6164,  4, 0, 0x02514}, // boxur;
+  { 6283,  3, 0, 0x02502}, // boxv;
+  { 6168,  4, 0, 0x0256A}, // boxvH;
+  { 6172,  4, 0, 0x02561}, // boxvL;
+  { 6176,  4, 0, 0x0255E}, // boxvR;
+  { 6180,  4, 0, 0x0253C}, // boxvh;
+  { 6184,  4, 0, 0x02524}, // boxvl;
+  { 6188,  4, 0, 0x0251C}, // boxvr;
+  { 3376,  5, 0, 0x02035}, // bprime;
+  { 3633,  4, 0, 0x002D8}, // breve;
+  { 5672,  4, 0, 0x000A6}, // brvbar
+  { 5672,  5, 0, 0x000A6}, // brvbar;
+  { 5721,  3, 0, 0x1D4B7}, // bscr;
+  { 5808,  4, 0, 0x0204F}, // bsemi;
+  { 3683,  3, 0, 0x0223D}, // bsim;
+  { 3377,  4, 0, 0x022CD}, // bsime;
+  { 4103,  3, 0, 0x0005C}, // bsol;
+  { 5916,  4, 0, 0x029C5}, // bsolb;
+  { 3938,  7, 0, 0x027C8}, // bsolhsub;
+  { 4969,  3, 0, 0x02022}, // bull;
+  { 5207,  5, 0, 0x02022}, // bullet;
+  { 1798,  3, 0, 0x0224E}, // bump;
+  { 5896,  4, 0, 0x02AAE}, // bumpE;
+  { 5643,  4, 0, 0x0224F}, // bumpe;
+  { 4772,  5, 0, 0x0224F}, // bumpeq;
+  {   91,  5, 0, 0x00107}, // cacute;
+  { 1799,  2, 0, 0x02229}, // cap;
+  { 5327,  5, 0, 0x02A44}, // capand;
+  { 3966,  7, 0, 0x02A49}, // capbrcup;
+  { 5337,  5, 0, 0x02A4B}, // capcap;
+  { 5347,  5, 0, 0x02A47}, // capcup;
+  { 5352,  5, 0, 0x02A40}, // capdot;
+  { 4974,  3, 8, 0x02229}, // caps;
+  { 5956,  4, 0, 0x02041}, // caret;
+  { 4395,  4, 0, 0x002C7}, // caron;
+  { 4973,  4, 0, 0x02A4D}, // ccaps;
+  { 4907,  5, 0, 0x0010D}, // ccaron;
+  { 5052,  4, 0, 0x000E7}, // ccedil
+  { 5052,  5, 0, 0x000E7}, // ccedil;
+  { 2993,  4, 0, 0x00109}, // ccirc;
+  { 5008,  4, 0, 0x02A4C}, // ccups;
+  { 4723,  6, 0, 0x02A50}, // ccupssm;
+  { 1909,  3, 0, 0x0010B}, // cdot;
+  { 4327,  3, 0, 0x000B8}, // cedil
+  { 5053,  4, 0, 0x000B8}, // cedil;
+  { 3743,  6, 0, 0x029B2}, // cemptyv;
+  {    1,  2, 0, 0x000A2}, // cent
+  { 1047,  3, 0, 0x000A2}, // cent;
+  { 3501,  8, 0, 0x000B7}, // centerdot;
+  {   73,  2, 0, 0x1D520}, // cfr;
+  { 4779,  3, 0, 0x00447}, // chcy;
+  { 5792,  4, 0, 0x02713}, // check;
+  { 3397,  8, 0, 0x02713}, // checkmark;
+  { 2965,  2, 0, 0x003C7}, // chi;
+  {   73,  2, 0, 0x025CB}, // cir;
+  { 6256,  3, 0, 0x029C3}, // cirE;
+  { 2994,  3, 0, 0x002C6}, // circ;
+  { 5422,  5, 0, 0x02257}, // circeq;
+  { 1703, 14, 0, 0x021BA}, // circlearrowleft;
+  { 1355, 15, 0, 0x021BB}, // circlearrowright;
+  { 4008,  7, 0, 0x000AE}, // circledR;
+  { 4015,  7, 0, 0x024C8}, // circledS;
+  { 3204,  9, 0, 0x0229B}, // circledast;
+  { 2987, 10, 0, 0x0229A}, // circledcirc;
+  { 2997, 10, 0, 0x0229D}, // circleddash;
+  {  154,  3, 0, 0x02257}, // cire;
+  { 4029,  7, 0, 0x02A10}, // cirfnint;
+  { 5467,  5, 0, 0x02AEF}, // cirmid;
+  { 4597,  6, 0, 0x029C2}, // cirscir;
+  { 6032,  4, 0, 0x02663}, // clubs;
+  { 4190,  7, 0, 0x02663}, // clubsuit;
+  { 1699,  4, 0, 0x0003A}, // colon;
+  { 5222,  5, 0, 0x02254}, // colone;
+  { 4435,  6, 0, 0x02254}, // coloneq;
+  { 2207,  4, 0, 0x0002C}, // comma;
+  { 5277,  5, 0, 0x00040}, // commat;
+  { 1798,  3, 0, 0x02201}, // comp;
+  { 5282,  5, 0, 0x02218}, // compfn;
+  { 3132,  9, 0, 0x02201}, // complement;
+  { 3485,  8, 0, 0x02102}, // complexes;
+  { 2638,  3, 0, 0x02245}, // cong;
+  { 3946,  6, 0, 0x02A6D}, // congdot;
+  { 3702,  5, 0, 0x0222E}, // conint;
+  { 6247,  3, 0, 0x1D554}, // copf;
+  { 4694,  5, 0, 0x02210}, // coprod;
+  { 5382,  2, 0, 0x000A9}, // copy
+  { 6250,  3, 0, 0x000A9}, // copy;
+  { 5382,  5, 0, 0x02117}, // copysr;
+  { 3871,  4, 0, 0x021B5}, // crarr;
+  { 4305,  4, 0, 0x02717}, // cross;
+  { 5721,  3, 0, 0x1D4B8}, // cscr;
+  { 3942,  3, 0, 0x02ACF}, // csub;
+  { 4527,  4, 0, 0x02AD1}, // csube;
+  { 1987,  3, 0, 0x02AD0}, // csup;
+  { 4533,  4, 0, 0x02AD2}, // csupe;
+  { 3505,  4, 0, 0x022EF}, // ctdot;
+  { 4309,  6, 0, 0x02938}, // cudarrl;
+  { 4315,  6, 0, 0x02935}, // cudarrr;
+  { 5816,  4, 0, 0x022DE}, // cuepr;
+  { 5820,  4, 0, 0x022DF}, // cuesc;
+  { 4508,  5, 0, 0x021B6}, // cularr;
+  { 4423,  6, 0, 0x0293D}, // cularrp;
+  { 1799,  2, 0, 0x0222A}, // cup;
+  { 3959,  7, 0, 0x02A48}, // cupbrcap;
+  { 5337,  5, 0, 0x02A46}, // cupcap;
+  { 5347,  5, 0, 0x02A4A}, // cupcup;
+  { 5352,  5, 0, 0x0228D}, // cupdot;
+  { 5944,  4, 0, 0x02A45}, // cupor;
+  { 4974,  3, 8, 0x0222A}, // cups;
+  { 3870,  5, 0, 0x021B7}, // curarr;
+  { 4543,  6, 0, 0x0293C}, // curarrm;
+  { 3007, 10, 0, 0x022DE}, // curlyeqprec;
+  { 3017, 10, 0, 0x022DF}, // curlyeqsucc;
+  { 4057,  7, 0, 0x022CE}, // curlyvee;
+  { 3231,  9, 0, 0x022CF}, // curlywedge;
+  { 5497,  4, 0, 0x000A4}, // curren
+  { 5497,  5, 0, 0x000A4}, // curren;
+  { 2107, 13, 0, 0x021B6}, // curvearrowleft;
+  { 1745, 14, 0, 0x021B7}, // curvearrowright;
+  { 4060,  4, 0, 0x022CE}, // cuvee;
+  { 5538,  4, 0, 0x022CF}, // cuwed;
+  { 3700,  7, 0, 0x02232}, // cwconint;
+  { 3661,  4, 0, 0x02231}, // cwint;
+  { 5192,  5, 0, 0x0232D}, // cylcty;
+  { 3872,  3, 0, 0x021D3}, // dArr;
+  {  330,  3, 0, 0x02965}, // dHar;
+  { 4232,  5, 0, 0x02020}, // dagger;
+  { 5197,  5, 0, 0x02138}, // daleth;
+  { 3872,  3, 0, 0x02193}, // darr;
+  { 3004,  3, 0, 0x02010}, // dash;
+  { 5988,  4, 0, 0x022A3}, // dashv;
+  { 3666,  6, 0, 0x0290F}, // dbkarow;
+  { 4948,  4, 0, 0x002DD}, // dblac;
+  { 4907,  5, 0, 0x0010F}, // dcaron;
+  { 4780,  2, 0, 0x00434}, // dcy;
+  {   29,  1, 0, 0x02146}, // dd;
+  { 4231,  6, 0, 0x02021}, // ddagger;
+  { 3871,  4, 0, 0x021CA}, // ddarr;
+  { 2401,  6, 0, 0x02A77}, // ddotseq;
+  {   25,  1, 0, 0x000B0}, // deg
+  { 2639,  2, 0, 0x000B0}, // deg;
+  { 5876,  4, 0, 0x003B4}, // delta;
+  { 3743,  6, 0, 0x029B1}, // demptyv;
+  { 5172,  5, 0, 0x0297F}, // dfisht;
+  {   73,  2, 0, 0x1D521}, // dfr;
+  { 5748,  4, 0, 0x021C3}, // dharl;
+  { 3871,  4, 0, 0x021C2}, // dharr;
+  { 6202,  3, 0, 0x022C4}, // diam;
+  { 4243,  6, 0, 0x022C4}, // diamond;
+  { 2837, 10, 0, 0x02666}, // diamondsuit;
+  { 5736,  4, 0, 0x02666}, // diams;
+  {   94,  2, 0, 0x000A8}, // die;
+  { 4357,  6, 0, 0x003DD}, // digamma;
+  { 5996,  4, 0, 0x022F2}, // disin;
+  { 3747,  2, 0, 0x000F7}, // div;
+  { 2563,  4, 0, 0x000F7}, // divide
+  { 5677,  5, 0, 0x000F7}, // divide;
+  { 2563, 12, 0, 0x022C7}, // divideontimes;
+  { 5682,  5, 0, 0x022C7}, // divonx;
+  { 4779,  3, 0, 0x00452}, // djcy;
+  { 4997,  5, 0, 0x0231E}, // dlcorn;
+  { 5002,  5, 0, 0x0230D}, // dlcrop;
+  { 5202,  5, 0, 0x00024}, // dollar;
+  { 6247,  3, 0, 0x1D555}, // dopf;
+  {  606,  2, 0, 0x002D9}, // dot;
+  { 1381,  4, 0, 0x02250}, // doteq;
+  { 4155,  7, 0, 0x02251}, // doteqdot;
+  { 2280,  7, 0, 0x02238}, // dotminus;
+  { 4687,  6, 0, 0x02214}, // dotplus;
+  { 3605,  8, 0, 0x022A1}, // dotsquare;
+  { 2185, 13, 0, 0x02306}, // doublebarwedge;
+  { 2889,  8, 0, 0x02193}, // downarrow;
+  { 2250, 13, 0, 0x021CA}, // downdownarrows;
+  { 1885, 14, 0, 0x021C3}, // downharpoonleft;
+  { 1520, 15, 0, 0x021C2}, // downharpoonright;
+  { 3665,  7, 0, 0x02910}, // drbkarow;
+  { 4997,  5, 0, 0x0231F}, // drcorn;
+  { 5002,  5, 0, 0x0230C}, // drcrop;
+  { 5721,  3, 0, 0x1D4B9}, // dscr;
+  { 4779,  3, 0, 0x00455}, // dscy;
+  { 4103,  3, 0, 0x029F6}, // dsol;
+  { 5612,  5, 0, 0x00111}, // dstrok;
+  { 3505,  4, 0, 0x022F1}, // dtdot;
+  { 4040,  3, 0, 0x025BF}, // dtri;
+  { 5960,  4, 0, 0x025BE}, // dtrif;
+  { 3871,  4, 0, 0x021F5}, // duarr;
+  { 4025,  4, 0, 0x0296F}, // duhar;
+  { 1439,  6, 0, 0x029A6}, // dwangle;
+  { 4779,  3, 0, 0x0045F}, // dzcy;
+  { 3868,  7, 0, 0x027FF}, // dzigrarr;
+  { 1908,  4, 0, 0x02A77}, // eDDot;
+  { 1909,  3, 0, 0x02251}, // eDot;
+  {   91,  4, 0, 0x000E9}, // eacute
+  {   91,  5, 0, 0x000E9}, // eacute;
+  { 5577,  5, 0, 0x02A6E}, // easter;
+  { 4907,  5, 0, 0x0011B}, // ecaron;
+  { 4068,  3, 0, 0x02256}, // ecir;
+  { 2831,  3, 0, 0x000EA}, // ecirc
+  { 2993,  4, 0, 0x000EA}, // ecirc;
+  { 4298,  5, 0, 0x02255}, // ecolon;
+  { 4780,  2, 0, 0x0044D}, // ecy;
+  { 1909,  3, 0, 0x00117}, // edot;
+  {   29,  1, 0, 0x02147}, // ee;
+  { 1908,  4, 0, 0x02252}, // efDot;
+  {   73,  2, 0, 0x1D522}, // efr;
+  {   29,  1, 0, 0x02A9A}, // eg;
+  { 1170,  4, 0, 0x000E8}, // egrave
+  { 1170,  5, 0, 0x000E8}, // egrave;
+  {  872,  2, 0, 0x02A96}, // egs;
+  { 4628,  5, 0, 0x02A98}, // egsdot;
+  {   29,  1, 0, 0x02A99}, // el;
+  { 3889,  7, 0, 0x023E7}, // elinters;
+  {   28,  2, 0, 0x02113}, // ell;
+  {  872,  2, 0, 0x02A95}, // els;
+  { 4628,  5, 0, 0x02A97}, // elsdot;
+  { 5720,  4, 0, 0x00113}, // emacr;
+  { 5952,  4, 0, 0x02205}, // empty;
+  { 4001,  7, 0, 0x02205}, // emptyset;
+  { 3744,  5, 0, 0x02205}, // emptyv;
+  { 5567,  5, 0, 0x02004}, // emsp13;
+  { 5572,  5, 0, 0x02005}, // emsp14;
+  { 5159,  3, 0, 0x02003}, // emsp;
+  { 2639,  2, 0, 0x0014B}, // eng;
+  { 5159,  3, 0, 0x02002}, // ensp;
+  { 5824,  4, 0, 0x00119}, // eogon;
+  { 6247,  3, 0, 0x1D556}, // eopf;
+  {  330,  3, 0, 0x022D5}, // epar;
+  { 3751,  5, 0, 0x029E3}, // eparsl;
+  { 3200,  4, 0, 0x02A71}, // eplus;
+  { 5949,  3, 0, 0x003B5}, // epsi;
+  { 1697,  6, 0, 0x003B5}, // epsilon;
+  { 6000,  4, 0, 0x003F5}, // epsiv;
+  { 2992,  5, 0, 0x02256}, // eqcirc;
+  { 4297,  6, 0, 0x02255}, // eqcolon;
+  { 3682,  4, 0, 0x02242}, // eqsim;
+  { 3258,  9, 0, 0x02A96}, // eqslantgtr;
+  { 3027, 10, 0, 0x02A95}, // eqslantless;
+  { 5622,  5, 0, 0x0003D}, // equals;
+  { 4538,  5, 0, 0x0225F}, // equest;
+  { 4347,  4, 0, 0x02261}, // equiv;
+  { 4717,  6, 0, 0x02A78}, // equivDD;
+  { 4204,  7, 0, 0x029E5}, // eqvparsl;
+  { 1908,  4, 0, 0x02253}, // erDot;
+  { 3871,  4, 0, 0x02971}, // erarr;
+  { 5721,  3, 0, 0x0212F}, // escr;
+  { 3505,  4, 0, 0x02250}, // esdot;
+  { 3683,  3, 0, 0x02242}, // esim;
+  { 2209,  2, 0, 0x003B7}, // eta;
+  {   45,  1, 0, 0x000F0}, // eth
+  { 3005,  2, 0, 0x000F0}, // eth;
+  { 5837,  2, 0, 0x000EB}, // euml
+  { 5837,  3, 0, 0x000EB}, // euml;
+  { 5249,  3, 0, 0x020AC}, // euro;
+  { 6117,  3, 0, 0x00021}, // excl;
+  { 5708,  4, 0, 0x02203}, // exist;
+  { 2947, 10, 0, 0x02130}, // expectation;
+  { 2685, 11, 0, 0x02147}, // exponentiale;
+  { 2395, 12, 0, 0x02252}, // fallingdotseq;
+  { 4780,  2, 0, 0x00444}, // fcy;
+  { 5232,  5, 0, 0x02640}, // female;
+  { 5152,  5, 0, 0x0FB03}, // ffilig;
+  { 5153,  4, 0, 0x0FB00}, // fflig;
+  { 5212,  5, 0, 0x0FB04}, // ffllig;
+  {   73,  2, 0, 0x1D523}, // ffr;
+  { 5153,  4, 0, 0x0FB01}, // filig;
+  { 5153,  4, 1, 0x00066}, // fjlig;
+  { 3690,  3, 0, 0x0266D}, // flat;
+  { 5153,  4, 0, 0x0FB02}, // fllig;
+  { 6020,  4, 0, 0x025B1}, // fltns;
+  { 4324,  3, 0, 0x00192}, // fnof;
+  { 6247,  3, 0, 0x1D557}, // fopf;
+  { 5412,  5, 0, 0x02200}, // forall;
+  { 3402,  3, 0, 0x022D4}, // fork;
+  { 5968,  4, 0, 0x02AD9}, // forkv;
+  { 3658,  7, 0, 0x02A0D}, // fpartint;
+  { 4802,  4, 0, 0x000BD}, // frac12
+  { 4802,  5, 0, 0x000BD}, // frac12;
+  { 4807,  5, 0, 0x02153}, // frac13;
+  { 4812,  4, 0, 0x000BC}, // frac14
+  { 4812,  5, 0, 0x000BC}, // frac14;
+  { 4817,  5, 0, 0x02155}, // frac15;
+  { 4822,  5, 0, 0x02159}, // frac16;
+  { 4827,  5, 0, 0x0215B}, // frac18;
+  { 4832,  5, 0, 0x02154}, // frac23;
+  { 4837,  5, 0, 0x02156}, // frac25;
+  { 4842,  4, 0, 0x000BE}, // frac34
+  { 4842,  5, 0, 0x000BE}, // frac34;
+  { 4847,  5, 0, 0x02157}, // frac35;
+  { 4852,  5, 0, 0x0215C}, // frac38;
+  { 4857,  5, 0, 0x02158}, // frac45;
+  { 4862,  5, 0, 0x0215A}, // frac56;
+  { 4867,  5, 0, 0x0215D}, // frac58;
+  { 4872,  5, 0, 0x0215E}, // frac78;
+  { 5764,  4, 0, 0x02044}, // frasl;
+  {  790,  4, 0, 0x02322}, // frown;
+  { 5721,  3, 0, 0x1D4BB}, // fscr;
+  {   29,  1, 0, 0x02267}, // gE;
+  {   28,  2, 0, 0x02A8C}, // gEl;
+  {   91,  5, 0, 0x001F5}, // gacute;
+  { 2207,  4, 0, 0x003B3}, // gamma;
+  { 5272,  5, 0, 0x003DD}, // gammad;
+  { 1799,  2, 0, 0x02A86}, // gap;
+  { 3632,  5, 0, 0x0011F}, // gbreve;
+  { 2993,  4, 0, 0x0011D}, // gcirc;
+  { 4780,  2, 0, 0x00433}, // gcy;
+  { 1909,  3, 0, 0x00121}, // gdot;
+  {   29,  1, 0, 0x02265}, // ge;
+  {   28,  2, 0, 0x022DB}, // gel;
+  { 1383,  2, 0, 0x02265}, // geq;
+  { 2464,  3, 0, 0x02267}, // geqq;
+  { 3406,  7, 0, 0x02A7E}, // geqslant;
+  {  872,  2, 0, 0x02A7E}, // ges;
+  { 5984,  4, 0, 0x02AA9}, // gescc;
+  { 4628,  5, 0, 0x02A80}, // gesdot;
+  { 4621,  6, 0, 0x02A82}, // gesdoto;
+  { 4099,  7, 0, 0x02A84}, // gesdotol;
+  { 3753,  3, 8, 0x022DB}, // gesl;
+  { 5557,  5, 0, 0x02A94}, // gesles;
+  {   73,  2, 0, 0x1D524}, // gfr;
+  {   29,  1, 0, 0x0226B}, // gg;
+  { 2639,  2, 0, 0x022D9}, // ggg;
+  { 5880,  4, 0, 0x02137}, // gimel;
+  { 4779,  3, 0, 0x00453}, // gjcy;
+  {   29,  1, 0, 0x02277}, // gl;
+  { 2683,  2, 0, 0x02A92}, // glE;
+  { 2209,  2, 0, 0x02AA5}, // gla;
+  { 6233,  2, 0, 0x02AA4}, // glj;
+  { 2683,  2, 0, 0x02269}, // gnE;
+  { 3570,  3, 0, 0x02A8A}, // gnap;
+  { 2870,  7, 0, 0x02A8A}, // gnapprox;
+  {   94,  2, 0, 0x02A88}, // gne;
+  { 1382,  3, 0, 0x02A88}, // gneq;
+  { 2463,  4, 0, 0x02269}, // gneqq;
+  { 3682,  4, 0, 0x022E7}, // gnsim;
+  { 6247,  3, 0, 0x1D558}, // gopf;
+  { 1171,  4, 0, 0x00060}, // grave;
+  { 5721,  3, 0, 0x0210A}, // gscr;
+  { 3683,  3, 0, 0x02273}, // gsim;
+  { 3377,  4, 0, 0x02A8E}, // gsime;
+  { 5836,  4, 0, 0x02A90}, // gsiml;
+  {    0,  0, 0, 0x0003E}, // gt
+  {   29,  1, 0, 0x0003E}, // gt;
+  { 3024,  3, 0, 0x02AA7}, // gtcc;
+  { 4067,  4, 0, 0x02A7A}, // gtcir;
+  { 3505,  4, 0, 0x022D7}, // gtdot;
+  { 5182,  5, 0, 0x02995}, // gtlPar;
+  { 4537,  6, 0, 0x02A7C}, // gtquest;
+  { 3525,  8, 0, 0x02A86}, // gtrapprox;
+  { 3870,  5, 0, 0x02978}, // gtrarr;
+  { 3504,  5, 0, 0x022D7}, // gtrdot;
+  { 3541,  8, 0, 0x022DB}, // gtreqless;
+  { 3222,  9, 0, 0x02A8C}, // gtreqqless;
+  { 4573,  6, 0, 0x02277}, // gtrless;
+  { 4592,  5, 0, 0x02273}, // gtrsim;
+  { 3421,  8, 8, 0x02269}, // gvertneqq;
+  { 5604,  3, 8, 0x02269}, // gvnE;
+  { 3872,  3, 0, 0x021D4}, // hArr;
+  { 5167,  5, 0, 0x0200A}, // hairsp;
+  { 6229,  3, 0, 0x000BD}, // half;
+  { 5267,  5, 0, 0x0210B}, // hamilt;
+  { 5442,  5, 0, 0x0044A}, // hardcy;
+  { 3872,  3, 0, 0x02194}, // harr;
+  { 4585,  6, 0, 0x02948}, // harrcir;
+  { 4918,  4, 0, 0x021AD}, // harrw;
+  {  330,  3, 0, 0x0210F}, // hbar;
+  { 2993,  4, 0, 0x00125}, // hcirc;
+  { 4922,  5, 0, 0x02665}, // hearts;
+  { 3365,  8, 0, 0x02665}, // heartsuit;
+  { 5217,  5, 0, 0x02026}, // hellip;
+  { 5432,  5, 0, 0x022B9}, // hercon;
+  {   73,  2, 0, 0x1D525}, // hfr;
+  { 4113,  7, 0, 0x02925}, // hksearow;
+  { 4134,  7, 0, 0x02926}, // hkswarow;
+  { 3871,  4, 0, 0x021FF}, // hoarr;
+  { 5287,  5, 0, 0x0223B}, // homtht;
+  { 2419, 12, 0, 0x021A9}, // hookleftarrow;
+  { 2016, 13, 0, 0x021AA}, // hookrightarrow;
+  { 6247,  3, 0, 0x1D559}, // hopf;
+  { 5417,  5, 0, 0x02015}, // horbar;
+  { 5721,  3, 0, 0x1D4BD}, // hscr;
+  { 3392,  5, 0, 0x0210F}, // hslash;
+  { 5612,  5, 0, 0x00127}, // hstrok;
+  { 4967,  5, 0, 0x02043}, // hybull;
+  { 5357,  5, 0, 0x02010}, // hyphen;
+  {   91,  4, 0, 0x000ED}, // iacute
+  {   91,  5, 0, 0x000ED}, // iacute;
+  {   29,  1, 0, 0x02063}, // ic;
+  { 2831,  3, 0, 0x000EE}, // icirc
+  { 2993,  4, 0, 0x000EE}, // icirc;
+  { 4780,  2, 0, 0x00438}, // icy;
+  { 4779,  3, 0, 0x00435}, // iecy;
+  { 6116,  3, 0, 0x000A1}, // iexcl
+  { 6116,  4, 0, 0x000A1}, // iexcl;
+  { 3175,  2, 0, 0x021D4}, // iff;
+  {   73,  2, 0, 0x1D526}, // ifr;
+  { 1170,  4, 0, 0x000EC}, // igrave
+  { 1170,  5, 0, 0x000EC}, // igrave;
+  {   29,  1, 0, 0x02148}, // ii;
+  { 5147,  5, 0, 0x02A0C}, // iiiint;
+  { 3661,  4, 0, 0x0222D}, // iiint;
+  { 4406,  5, 0, 0x029DC}, // iinfin;
+  { 5920,  4, 0, 0x02129}, // iiota;
+  { 5153,  4, 0, 0x00133}, // ijlig;
+  { 5720,  4, 0, 0x0012B}, // imacr;
+  { 5728,  4, 0, 0x02111}, // image;
+  { 3637,  7, 0, 0x02110}, // imagline;
+  { 3644,  7, 0, 0x02111}, // imagpart;
+  { 5043,  4, 0, 0x00131}, // imath;
+  { 4324,  3, 0, 0x022B7}, // imof;
+  { 5932,  4, 0, 0x001B5}, // imped;
+  {   29,  1, 0, 0x02208}, // in;
+  { 4977,  5, 0, 0x02105}, // incare;
+  { 4407,  4, 0, 0x0221E}, // infin;
+  { 3763,  7, 0, 0x029DD}, // infintie;
+  { 4370,  5, 0, 0x00131}, // inodot;
+  {  606,  2, 0, 0x0222B}, // int;
+  { 5597,  5, 0, 0x022BA}, // intcal;
+  { 4148,  7, 0, 0x02124}, // integers;
+  { 4162,  7, 0, 0x022BA}, // intercal;
+  { 4176,  7, 0, 0x02A17}, // intlarhk;
+  { 4693,  6, 0, 0x02A3C}, // intprod;
+  { 4779,  3, 0, 0x00451}, // iocy;
+  { 5824,  4, 0, 0x0012F}, // iogon;
+  { 6247,  3, 0, 0x1D55A}, // iopf;
+  { 4082,  3, 0, 0x003B9}, // iota;
+  { 4695,  4, 0, 0x02A3C}, // iprod;
+  { 4538,  4, 0, 0x000BF}, // iquest
+  { 4538,  5, 0, 0x000BF}, // iquest;
+  { 5721,  3, 0, 0x1D4BE}, // iscr;
+  { 4408,  3, 0, 0x02208}, // isin;
+  { 5603,  4, 0, 0x022F9}, // isinE;
+  { 4170,  6, 0, 0x022F5}, // isindot;
+  { 5840,  4, 0, 0x022F4}, // isins;
+  { 5162,  5, 0, 0x022F3}, // isinsv;
+  { 5844,  4, 0, 0x02208}, // isinv;
+  {   29,  1, 0, 0x02062}, // it;
+  { 1185,  5, 0, 0x00129}, // itilde;
+  { 5872,  4, 0, 0x00456}, // iukcy;
+  { 5837,  2, 0, 0x000EF}, // iuml
+  { 5837,  3, 0, 0x000EF}, // iuml;
+  { 2993,  4, 0, 0x00135}, // jcirc;
+  { 4780,  2, 0, 0x00439}, // jcy;
+  {   73,  2, 0, 0x1D527}, // jfr;
+  { 5043,  4, 0, 0x00237}, // jmath;
+  { 6247,  3, 0, 0x1D55B}, // jopf;
+  { 5721,  3, 0, 0x1D4BF}, // jscr;
+  { 5057,  5, 0, 0x00458}, // jsercy;
+  { 5872,  4, 0, 0x00454}, // jukcy;
+  { 4046,  4, 0, 0x003BA}, // kappa;
+  { 5362,  5, 0, 0x003F0}, // kappav;
+  { 5052,  5, 0, 0x00137}, // kcedil;
+  { 4780,  2, 0, 0x0043A}, // kcy;
+  {   73,  2, 0, 0x1D528}, // kfr;
+  { 5447,  5, 0, 0x00138}, // kgreen;
+  { 4779,  3, 0, 0x00445}, // khcy;
+  { 4779,  3, 0, 0x0045C}, // kjcy;
+  { 6247,  3, 0, 0x1D55C}, // kopf;
+  { 5721,  3, 0, 0x1D4C0}, // kscr;
+  { 3871,  4, 0, 0x021DA}, // lAarr;
+  { 3872,  3, 0, 0x021D0}, // lArr;
+  { 1972,  5, 0, 0x0291B}, // lAtail;
+  { 3871,  4, 0, 0x0290E}, // lBarr;
+  {   29,  1, 0, 0x02266}, // lE;
+  { 2639,  2, 0, 0x02A8B}, // lEg;
+  {  330,  3, 0, 0x02962}, // lHar;
+  {   91,  5, 0, 0x0013A}, // lacute;
+  { 3742,  7, 0, 0x029B4}, // laemptyv;
+  { 5107,  5, 0, 0x02112}, // lagran;
+  { 5237,  5, 0, 0x003BB}, // lambda;
+  { 2638,  3, 0, 0x027E8}, // lang;
+  { 5908,  4, 0, 0x02991}, // langd;
+  { 1440,  5, 0, 0x027E8}, // langle;
+  { 1799,  2, 0, 0x02A85}, // lap;
+  { 4893,  3, 0, 0x000AB}, // laquo
+  { 4893,  4, 0, 0x000AB}, // laquo;
+  { 3872,  3, 0, 0x02190}, // larr;
+  { 5980,  4, 0, 0x021E4}, // larrb;
+  { 4579,  6, 0, 0x0291F}, // larrbfs;
+  { 5502,  5, 0, 0x0291D}, // larrfs;
+  { 5507,  5, 0, 0x021A9}, // larrhk;
+  { 5517,  5, 0, 0x021AB}, // larrlp;
+  { 5522,  5, 0, 0x02939}, // larrpl;
+  { 4591,  6, 0, 0x02973}, // larrsim;
+  { 5527,  5, 0, 0x021A2}, // larrtl;
+  {  606,  2, 0, 0x02AAB}, // lat;
+  { 1972,  5, 0, 0x02919}, // latail;
+  {   93,  3, 0, 0x02AAD}, // late;
+  { 6004,  4, 8, 0x02AAD}, // lates;
+  { 3871,  4, 0, 0x0290C}, // lbarr;
+  { 4053,  4, 0, 0x02772}, // lbbrk;
+  { 3109,  5, 0, 0x0007B}, // lbrace;
+  { 5407,  5, 0, 0x0005B}, // lbrack;
+  { 5964,  4, 0, 0x0298B}, // lbrke;
+  { 4561,  6, 0, 0x0298F}, // lbrksld;
+  { 4567,  6, 0, 0x0298D}, // lbrkslu;
+  { 4907,  5, 0, 0x0013E}, // lcaron;
+  { 5052,  5, 0, 0x0013C}, // lcedil;
+  { 5804,  4, 0, 0x02308}, // lceil;
+  { 3942,  3, 0, 0x0007B}, // lcub;
+  { 4780,  2, 0, 0x0043B}, // lcy;
+  { 6205,  3, 0, 0x02936}, // ldca;
+  { 4893,  4, 0, 0x0201C}, // ldquo;
+  { 5387,  5, 0, 0x0201E}, // ldquor;
+  { 4549,  6, 0, 0x02967}, // ldrdhar;
+  { 4092,  7, 0, 0x0294B}, // ldrushar;
+  { 3004,  3, 0, 0x021B2}, // ldsh;
+  {   29,  1, 0, 0x02264}, // le;
+  { 1332,  8, 0, 0x02190}, // leftarrow;
+  { 2311, 12, 0, 0x021A2}, // leftarrowtail;
+  { 1563, 14, 0, 0x021BD}, // leftharpoondown;
+  { 2323, 12, 0, 0x021BC}, // leftharpoonup;
+  { 1938, 13, 0, 0x021C7}, // leftleftarrows;
+  {  680, 13, 0, 0x02194}, // leftrightarrow;
+  { 1577, 14, 0, 0x021C6}, // leftrightarrows;
+  {  858, 16, 0, 0x021CB}, // leftrightharpoons;
+  {  465, 18, 0, 0x021AD}, // leftrightsquigarrow;
+  { 1951, 13, 0, 0x022CB}, // leftthreetimes;
+  { 2639,  2, 0, 0x022DA}, // leg;
+  { 1383,  2, 0, 0x02264}, // leq;
+  { 2464,  3, 0, 0x02266}, // leqq;
+  { 3406,  7, 0, 0x02A7D}, // leqslant;
+  {  872,  2, 0, 0x02A7D}, // les;
+  { 5984,  4, 0, 0x02AA8}, // lescc;
+  { 4628,  5, 0, 0x02A7F}, // lesdot;
+  { 4621,  6, 0, 0x02A81}, // lesdoto;
+  { 4106,  7, 0, 0x02A83}, // lesdotor;
+  { 6265,  3, 8, 0x022DA}, // lesg;
+  { 5547,  5, 0, 0x02A93}, // lesges;
+  { 3267,  9, 0, 0x02A85}, // lessapprox;
+  { 4627,  6, 0, 0x022D6}, // lessdot;
+  { 3557,  8, 0, 0x022DA}, // lesseqgtr;
+  { 3276,  9, 0, 0x02A8B}, // lesseqqgtr;
+  { 4633,  6, 0, 0x02276}, // lessgtr;
+  { 4639,  6, 0, 0x02272}, // lesssim;
+  { 5172,  5, 0, 0x0297C}, // lfisht;
+  { 3127,  5, 0, 0x0230A}, // lfloor;
+  {   73,  2, 0, 0x1D529}, // lfr;
+  {   29,  1, 0, 0x02276}, // lg;
+  { 2683,  2, 0, 0x02A91}, // lgE;
+  { 5123,  4, 0, 0x021BD}, // lhard;
+  { 5756,  4, 0, 0x021BC}, // lharu;
+  { 4927,  5, 0, 0x0296A}, // lharul;
+  { 5772,  4, 0, 0x02584}, // lhblk;
+  { 4779,  3, 0, 0x00459}, // ljcy;
+  {   29,  1, 0, 0x0226A}, // ll;
+  { 3871,  4, 0, 0x021C7}, // llarr;
+  { 3707,  7, 0, 0x0231E}, // llcorner;
+  { 5122,  5, 0, 0x0296B}, // llhard;
+  { 4039,  4, 0, 0x025FA}, // lltri;
+  { 5132,  5, 0, 0x00140}, // lmidot;
+  { 5322,  5, 0, 0x023B0}, // lmoust;
+  { 3159,  9, 0, 0x023B0}, // lmoustache;
+  { 2683,  2, 0, 0x02268}, // lnE;
+  { 3570,  3, 0, 0x02A89}, // lnap;
+  { 2870,  7, 0, 0x02A89}, // lnapprox;
+  {   94,  2, 0, 0x02A87}, // lne;
+  { 1382,  3, 0, 0x02A87}, // lneq;
+  { 2463,  4, 0, 0x02268}, // lneqq;
+  { 3682,  4, 0, 0x022E6}, // lnsim;
+  { 5740,  4, 0, 0x027EC}, // loang;
+  { 3871,  4, 0, 0x021FD}, // loarr;
+  { 4053,  4, 0, 0x027E6}, // lobrk;
+  { 2407, 12, 0, 0x027F5}, // longleftarrow;
+  {  676, 17, 0, 0x027F7}, // longleftrightarrow;
+  { 3141,  9, 0, 0x027FC}, // longmapsto;
+  { 2003, 13, 0, 0x027F6}, // longrightarrow;
+  { 2431, 12, 0, 0x021AB}, // looparrowleft;
+  { 2029, 13, 0, 0x021AC}, // looparrowright;
+  { 5928,  4, 0, 0x02985}, // lopar;
+  { 6247,  3, 0, 0x1D55D}, // lopf;
+  { 3828,  5, 0, 0x02A2D}, // loplus;
+  { 1627,  6, 0, 0x02A34}, // lotimes;
+  { 5687,  5, 0, 0x02217}, // lowast;
+  { 5692,  5, 0, 0x0005F}, // lowbar;
+  { 6293,  2, 0, 0x025CA}, // loz;
+  { 2580,  6, 0, 0x025CA}, // lozenge;
+  { 6286,  3, 0, 0x029EB}, // lozf;
+  {  330,  3, 0, 0x00028}, // lpar;
+  { 4902,  5, 0, 0x02993}, // lparlt;
+  { 3871,  4, 0, 0x021C6}, // lrarr;
+  { 3707,  7, 0, 0x0231F}, // lrcorner;
+  { 4025,  4, 0, 0x021CB}, // lrhar;
+  { 5122,  5, 0, 0x0296D}, // lrhard;
+  {  445,  2, 0, 0x0200E}, // lrm;
+  { 4039,  4, 0, 0x022BF}, // lrtri;
+  { 4892,  5, 0, 0x02039}, // lsaquo;
+  { 5721,  3, 0, 0x1D4C1}, // lscr;
+  { 3005,  2, 0, 0x021B0}, // lsh;
+  { 3683,  3, 0, 0x02272}, // lsim;
+  { 3377,  4, 0, 0x02A8D}, // lsime;
+  { 5832,  4, 0, 0x02A8F}, // lsimg;
+  { 6253,  3, 0, 0x0005B}, // lsqb;
+  { 4893,  4, 0, 0x02018}, // lsquo;
+  { 5387,  5, 0, 0x0201A}, // lsquor;
+  { 5612,  5, 0, 0x00142}, // lstrok;
+  {    0,  0, 0, 0x0003C}, // lt
+  {   29,  1, 0, 0x0003C}, // lt;
+  { 3024,  3, 0, 0x02AA6}, // ltcc;
+  { 4067,  4, 0, 0x02A79}, // ltcir;
+  { 3505,  4, 0, 0x022D6}, // ltdot;
+  { 5127,  5, 0, 0x022CB}, // lthree;
+  { 1628,  5, 0, 0x022C9}, // ltimes;
+  { 4508,  5, 0, 0x02976}, // ltlarr;
+  { 4537,  6, 0, 0x02A7B}, // ltquest;
+  { 5402,  5, 0, 0x02996}, // ltrPar;
+  { 4040,  3, 0, 0x025C3}, // ltri;
+  { 4449,  4, 0, 0x022B4}, // ltrie;
+  { 5960,  4, 0, 0x025C2}, // ltrif;
+  { 4022,  7, 0, 0x0294A}, // lurdshar;
+  { 4615,  6, 0, 0x02966}, // luruhar;
+  { 3421,  8, 8, 0x02268}, // lvertneqq;
+  { 5604,  3, 8, 0x02268}, // lvnE;
+  { 1908,  4, 0, 0x0223A}, // mDDot;
+  {   76,  2, 0, 0x000AF}, // macr
+  { 5721,  3, 0, 0x000AF}, // macr;
+  { 1442,  3, 0, 0x02642}, // male;
+  { 4270,  3, 0, 0x02720}, // malt;
+  { 4441,  6, 0, 0x02720}, // maltese;
+  { 1799,  2, 0, 0x021A6}, // map;
+  { 3145,  5, 0, 0x021A6}, // mapsto;
+  { 3177,  9, 0, 0x021A7}, // mapstodown;
+  { 3186,  9, 0, 0x021A4}, // mapstoleft;
+  { 3994,  7, 0, 0x021A5}, // mapstoup;
+  { 5462,  5, 0, 0x025AE}, // marker;
+  { 2206,  5, 0, 0x02A29}, // mcomma;
+  { 4780,  2, 0, 0x0043C}, // mcy;
+  { 3003,  4, 0, 0x02014}, // mdash;
+  { 2287, 12, 0, 0x02221}, // measuredangle;
+  {   73,  2, 0, 0x1D52A}, // mfr;
+  { 3148,  2, 0, 0x02127}, // mho;
+  { 4303,  3, 0, 0x000B5}, // micro
+  { 5780,  4, 0, 0x000B5}, // micro;
+  { 2945,  2, 0, 0x02223}, // mid;
+  { 3208,  5, 0, 0x0002A}, // midast;
+  { 5022,  5, 0, 0x02AF0}, // midcir;
+  { 5027,  4, 0, 0x000B7}, // middot
+  { 5027,  5, 0, 0x000B7}, // middot;
+  { 2283,  4, 0, 0x02212}, // minus;
+  { 5307,  5, 0, 0x0229F}, // minusb;
+  { 5312,  5, 0, 0x02238}, // minusd;
+  { 4471,  6, 0, 0x02A2A}, // minusdu;
+  { 6208,  3, 0, 0x02ADB}, // mlcp;
+  { 6133,  3, 0, 0x02026}, // mldr;
+  { 3828,  5, 0, 0x02213}, // mnplus;
+  { 5032,  5, 0, 0x022A7}, // models;
+  { 6247,  3, 0, 0x1D55E}, // mopf;
+  {   29,  1, 0, 0x02213}, // mp;
+  { 5721,  3, 0, 0x1D4C2}, // mscr;
+  { 5607,  5, 0, 0x0223E}, // mstpos;
+  {   29,  1, 0, 0x003BC}, // mu;
+  { 3903,  7, 0, 0x022B8}, // multimap;
+  { 3906,  4, 0, 0x022B8}, // mumap;
+  { 2639,  2, 4, 0x022D9}, // nGg;
+  {  606,  2, 6, 0x0226B}, // nGt;
+  { 6268,  3, 4, 0x0226B}, // nGtv;
+  { 1331,  9, 0, 0x021CD}, // nLeftarrow;
+  {  679, 14, 0, 0x021CE}, // nLeftrightarrow;
+  {   28,  2, 4, 0x022D8}, // nLl;
+  {  606,  2, 6, 0x0226A}, // nLt;
+  { 6268,  3, 4, 0x0226A}, // nLtv;
+  {  683, 10, 0, 0x021CF}, // nRightarrow;
+  { 4782,  5, 0, 0x022AF}, // nVDash;
+  { 3002,  5, 0, 0x022AE}, // nVdash;
+  { 5768,  4, 0, 0x02207}, // nabla;
+  {   91,  5, 0, 0x00144}, // nacute;
+  { 2638,  3, 6, 0x02220}, // nang;
+  { 1799,  2, 0, 0x02249}, // nap;
+  { 5897,  3, 4, 0x02A70}, // napE;
+  { 5940,  4, 4, 0x0224B}, // napid;
+  { 5608,  4, 0, 0x00149}, // napos;
+  { 2871,  6, 0, 0x02249}, // napprox;
+  { 6024,  4, 0, 0x0266E}, // natur;
+  { 4699,  6, 0, 0x0266E}, // natural;
+  { 4183,  7, 0, 0x02115}, // naturals;
+  { 5113,  2, 0, 0x000A0}, // nbsp
+  { 5159,  3, 0, 0x000A0}, // nbsp;
+  { 1797,  4, 4, 0x0224E}, // nbump;
+  { 5642,  5, 4, 0x0224F}, // nbumpe;
+  { 3570,  3, 0, 0x02A43}, // ncap;
+  { 4907,  5, 0, 0x00148}, // ncaron;
+  { 5052,  5, 0, 0x00146}, // ncedil;
+  { 3696,  4, 0, 0x02247}, // ncong;
+  { 3945,  7, 4, 0x02A6D}, // ncongdot;
+  { 1987,  3, 0, 0x02A42}, // ncup;
+  { 4780,  2, 0, 0x0043D}, // ncy;
+  { 3003,  4, 0, 0x02013}, // ndash;
+  {   29,  1, 0, 0x02260}, // ne;
+  { 5178,  4, 0, 0x021D7}, // neArr;
+  { 4178,  5, 0, 0x02924}, // nearhk;
+  { 3871,  4, 0, 0x02197}, // nearr;
+  {  477,  6, 0, 0x02197}, // nearrow;
+  { 3505,  4, 4, 0x02250}, // nedot;
+  { 4346,  5, 0, 0x02262}, // nequiv;
+  { 5542,  5, 0, 0x02928}, // nesear;
+  { 3682,  4, 4, 0x02242}, // nesim;
+  { 5707,  5, 0, 0x02204}, // nexist;
+  { 3575,  6, 0, 0x02204}, // nexists;
+  {   73,  2, 0, 0x1D52B}, // nfr;
+  { 2683,  2, 4, 0x02267}, // ngE;
+  {   94,  2, 0, 0x02271}, // nge;
+  { 1382,  3, 0, 0x02271}, // ngeq;
+  { 2463,  4, 4, 0x02267}, // ngeqq;
+  { 3405,  8, 4, 0x02A7E}, // ngeqslant;
+  { 1630,  3, 4, 0x02A7E}, // nges;
+  { 3682,  4, 0, 0x02275}, // ngsim;
+  {  606,  2, 0, 0x0226F}, // ngt;
+  { 3264,  3, 0, 0x0226F}, // ngtr;
+  { 5178,  4, 0, 0x021CE}, // nhArr;
+  { 3871,  4, 0, 0x021AE}, // nharr;
+  { 5928,  4, 0, 0x02AF2}, // nhpar;
+  {   29,  1, 0, 0x0220B}, // ni;
+  {  872,  2, 0, 0x022FC}, // nis;
+  { 5104,  3, 0, 0x022FA}, // nisd;
+  { 3747,  2, 0, 0x0220B}, // niv;
+  { 4779,  3, 0, 0x0045A}, // njcy;
+  { 5178,  4, 0, 0x021CD}, // nlArr;
+  { 2683,  2, 4, 0x02266}, // nlE;
+  { 3871,  4, 0, 0x0219A}, // nlarr;
+  { 6133,  3, 0, 0x02025}, // nldr;
+  {   94,  2, 0, 0x02270}, // nle;
+  { 1331,  9, 0, 0x0219A}, // nleftarrow;
+  {  679, 14, 0, 0x021AE}, // nleftrightarrow;
+  { 1382,  3, 0, 0x02270}, // nleq;
+  { 2463,  4, 4, 0x02266}, // nleqq;
+  { 3405,  8, 4, 0x02A7D}, // nleqslant;
+  { 1630,  3, 4, 0x02A7D}, // nles;
+  { 1030,  4, 0, 0x0226E}, // nless;
+  { 3682,  4, 0, 0x02274}, // nlsim;
+  {  606,  2, 0, 0x0226E}, // nlt;
+  { 4039,  4, 0, 0x022EA}, // nltri;
+  { 4448,  5, 0, 0x022EC}, // nltrie;
+  { 3450,  3, 0, 0x02224}, // nmid;
+  { 6247,  3, 0, 0x1D55F}, // nopf;
+  {    2,  1, 0, 0x000AC}, // not
+  {  606,  2, 0, 0x000AC}, // not;
+  { 6008,  4, 0, 0x02209}, // notin;
+  { 5602,  5, 4, 0x022F9}, // notinE;
+  { 4169,  7, 4, 0x022F5}, // notindot;
+  { 4651,  6, 0, 0x02209}, // notinva;
+  { 4657,  6, 0, 0x022F7}, // notinvb;
+  { 4663,  6, 0, 0x022F6}, // notinvc;
+  { 6016,  4, 0, 0x0220C}, // notni;
+  { 4669,  6, 0, 0x0220C}, // notniva;
+  { 4675,  6, 0, 0x022FE}, // notnivb;
+  { 4681,  6, 0, 0x022FD}, // notnivc;
+  {  330,  3, 0, 0x02226}, // npar;
+  { 1995,  8, 0, 0x02226}, // nparallel;
+  { 3751,  5, 7, 0x02AFD}, // nparsl;
+  { 3647,  4, 4, 0x02202}, // npart;
+  { 3981,  6, 0, 0x02A14}, // npolint;
+  {   73,  2, 0, 0x02280}, // npr;
+  { 5437,  5, 0, 0x022E0}, // nprcue;
+  {  154,  3, 4, 0x02AAF}, // npre;
+  { 3013,  4, 0, 0x02280}, // nprec;
+  { 4555,  6, 4, 0x02AAF}, // npreceq;
+  { 5178,  4, 0, 0x021CF}, // nrArr;
+  { 3871,  4, 0, 0x0219B}, // nrarr;
+  { 4912,  5, 4, 0x02933}, // nrarrc;
+  { 4917,  5, 4, 0x0219D}, // nrarrw;
+  {  683, 10, 0, 0x0219B}, // nrightarrow;
+  { 4039,  4, 0, 0x022EB}, // nrtri;
+  { 4448,  5, 0, 0x022ED}, // nrtrie;
+  { 2995,  2, 0, 0x02281}, // nsc;
+  { 4987,  5, 0, 0x022E1}, // nsccue;
+  {  134,  3, 4, 0x02AB0}, // nsce;
+  { 5721,  3, 0, 0x1D4C3}, // nscr;
+  { 3445,  8, 0, 0x02224}, // nshortmid;
+  { 1990, 13, 0, 0x02226}, // nshortparallel;
+  { 3683,  3, 0, 0x02241}, // nsim;
+  { 3377,  4, 0, 0x02244}, // nsime;
+  { 3384,  5, 0, 0x02244}, // nsimeq;
+  { 3449,  4, 0, 0x02224}, // nsmid;
+  { 5928,  4, 0, 0x02226}, // nspar;
+  { 4525,  6, 0, 0x022E2}, // nsqsube;
+  { 4531,  6, 0, 0x022E3}, // nsqsupe;
+  { 3942,  3, 0, 0x02284}, // nsub;
+  { 6028,  4, 4, 0x02AC5}, // nsubE;
+  { 4527,  4, 0, 0x02288}, // nsube;
+  { 1823,  6, 6, 0x02282}, // nsubset;
+  { 3286,  8, 0, 0x02288}, // nsubseteq;
+  { 3321,  9, 4, 0x02AC5}, // nsubseteqq;
+  { 3023,  4, 0, 0x02281}, // nsucc;
+  { 4711,  6, 4, 0x02AB0}, // nsucceq;
+  { 1987,  3, 0, 0x02285}, // nsup;
+  { 6040,  4, 4, 0x02AC6}, // nsupE;
+  { 4533,  4, 0, 0x02289}, // nsupe;
+  { 4128,  6, 6, 0x02283}, // nsupset;
+  { 3295,  8, 0, 0x02289}, // nsupseteq;
+  { 3339,  9, 4, 0x02AC6}, // nsupseteqq;
+  { 6226,  3, 0, 0x02279}, // ntgl;
+  { 1068,  4, 0, 0x000F1}, // ntilde
+  { 1185,  5, 0, 0x000F1}, // ntilde;
+  { 5733,  3, 0, 0x02278}, // ntlg;
+  {  798, 12, 0, 0x022EA}, // ntriangleleft;
+  { 1717, 14, 0, 0x022EC}, // ntrianglelefteq;
+  {  595, 13, 0, 0x022EB}, // ntriangleright;
+  { 1370, 15, 0, 0x022ED}, // ntrianglerighteq;
+  {   29,  1, 0, 0x003BD}, // nu;
+  {  445,  2, 0, 0x00023}, // num;
+  { 5247,  5, 0, 0x02116}, // numero;
+  { 5900,  4, 0, 0x02007}, // numsp;
+  { 4782,  5, 0, 0x022AD}, // nvDash;
+  { 4792,  5, 0, 0x02904}, // nvHarr;
+  { 3570,  3, 6, 0x0224D}, // nvap;
+  { 3002,  5, 0, 0x022AC}, // nvdash;
+  { 2195,  3, 6, 0x02265}, // nvge;
+  { 4899,  3, 6, 0x0003E}, // nvgt;
+  { 4405,  6, 0, 0x029DE}, // nvinfin;
+  { 5177,  5, 0, 0x02902}, // nvlArr;
+  { 1442,  3, 6, 0x02264}, // nvle;
+  { 4270,  3, 6, 0x0003C}, // nvlt;
+  { 4447,  6, 6, 0x022B4}, // nvltrie;
+  { 5397,  5, 0, 0x02903}, // nvrArr;
+  { 4609,  6, 6, 0x022B5}, // nvrtrie;
+  { 3682,  4, 6, 0x0223C}, // nvsim;
+  { 5178,  4, 0, 0x021D6}, // nwArr;
+  { 4178,  5, 0, 0x02923}, // nwarhk;
+  { 3871,  4, 0, 0x02196}, // nwarr;
+  {  477,  6, 0, 0x02196}, // nwarrow;
+  { 5297,  5, 0, 0x02927}, // nwnear;
+  {   29,  1, 0, 0x024C8}, // oS;
+  {   91,  4, 0, 0x000F3}, // oacute
+  {   91,  5, 0, 0x000F3}, // oacute;
+  { 3210,  3, 0, 0x0229B}, // oast;
+  { 4068,  3, 0, 0x0229A}, // ocir;
+  { 2831,  3, 0, 0x000F4}, // ocirc
+  { 2993,  4, 0, 0x000F4}, // ocirc;
+  { 4780,  2, 0, 0x0043E}, // ocy;
+  { 3003,  4, 0, 0x0229D}, // odash;
+  { 4947,  5, 0, 0x00151}, // odblac;
+  { 4348,  3, 0, 0x02A38}, // odiv;
+  { 1909,  3, 0, 0x02299}, // odot;
+  { 5562,  5, 0, 0x029BC}, // odsold;
+  { 5153,  4, 0, 0x00153}, // oelig;
+  { 4067,  4, 0, 0x029BF}, // ofcir;
+  {   73,  2, 0, 0x1D52C}, // ofr;
+  {  724,  3, 0, 0x002DB}, // ogon;
+  { 1170,  4, 0, 0x000F2}, // ograve
+  { 1170,  5, 0, 0x000F2}, // ograve;
+  {  606,  2, 0, 0x029C1}, // ogt;
+  { 3913,  4, 0, 0x029B5}, // ohbar;
+  {  445,  2, 0, 0x003A9}, // ohm;
+  { 1047,  3, 0, 0x0222E}, // oint;
+  { 3871,  4, 0, 0x021BA}, // olarr;
+  { 4067,  4, 0, 0x029BE}, // olcir;
+  { 4303,  6, 0, 0x029BB}, // olcross;
+  { 2090,  4, 0, 0x0203E}, // oline;
+  {  606,  2, 0, 0x029C0}, // olt;
+  { 5720,  4, 0, 0x0014D}, // omacr;
+  { 5800,  4, 0, 0x003C9}, // omega;
+  { 4393,  6, 0, 0x003BF}, // omicron;
+  { 3450,  3, 0, 0x029B6}, // omid;
+  { 2282,  5, 0, 0x02296}, // ominus;
+  { 6247,  3, 0, 0x1D560}, // oopf;
+  {  330,  3, 0, 0x029B7}, // opar;
+  { 5138,  4, 0, 0x029B9}, // operp;
+  { 3200,  4, 0, 0x02295}, // oplus;
+  {   29,  1, 0, 0x02228}, // or;
+  { 3871,  4, 0, 0x021BB}, // orarr;
+  { 2945,  2, 0, 0x02A5D}, // ord;
+  { 5784,  4, 0, 0x02134}, // order;
+  { 4321,  6, 0, 0x02134}, // orderof;
+  { 6214,  2, 0, 0x000AA}, // ordf
+  { 6214,  3, 0, 0x000AA}, // ordf;
+  { 6217,  2, 0, 0x000BA}, // ordm
+  { 6217,  3, 0, 0x000BA}, // ordm;
+  { 5142,  5, 0, 0x022B6}, // origof;
+  {  588,  3, 0, 0x02A56}, // oror;
+  { 3722,  6, 0, 0x02A57}, // orslope;
+  { 3747,  2, 0, 0x02A5B}, // orv;
+  { 5721,  3, 0, 0x02134}, // oscr;
+  { 3392,  4, 0, 0x000F8}, // oslash
+  { 3392,  5, 0, 0x000F8}, // oslash;
+  { 4103,  3, 0, 0x02298}, // osol;
+  { 1068,  4, 0, 0x000F5}, // otilde
+  { 1185,  5, 0, 0x000F5}, // otilde;
+  { 1628,  5, 0, 0x02297}, // otimes;
+  { 3875,  7, 0, 0x02A36}, // otimesas;
+  { 5837,  2, 0, 0x000F6}, // ouml
+  { 5837,  3, 0, 0x000F6}, // ouml;
+  { 3913,  4, 0, 0x0233D}, // ovbar;
+  {   73,  2, 0, 0x02225}, // par;
+  {   26,  2, 0, 0x000B6}, // para
+  { 6259,  3, 0, 0x000B6}, // para;
+  { 1996,  7, 0, 0x02225}, // parallel;
+  { 4592,  5, 0, 0x02AF3}, // parsim;
+  { 3752,  4, 0, 0x02AFD}, // parsl;
+  { 3648,  3, 0, 0x02202}, // part;
+  { 4780,  2, 0, 0x0043F}, // pcy;
+  { 5427,  5, 0, 0x00025}, // percnt;
+  { 5457,  5, 0, 0x0002E}, // period;
+  { 5472,  5, 0, 0x02030}, // permil;
+  { 4426,  3, 0, 0x022A5}, // perp;
+  { 4603,  6, 0, 0x02031}, // pertenk;
+  {   73,  2, 0, 0x1D52D}, // pfr;
+  { 2965,  2, 0, 0x003C6}, // phi;
+  { 4348,  3, 0, 0x003D5}, // phiv;
+  { 5277,  5, 0, 0x02133}, // phmmat;
+  { 5223,  4, 0, 0x0260E}, // phone;
+  {   29,  1, 0, 0x003C0}, // pi;
+  { 3589,  8, 0, 0x022D4}, // pitchfork;
+  { 3747,  2, 0, 0x003D6}, // piv;
+  { 4882,  5, 0, 0x0210F}, // planck;
+  { 4249,  6, 0, 0x0210E}, // planckh;
+  { 4887,  5, 0, 0x0210F}, // plankv;
+  { 2284,  3, 0, 0x0002B}, // plus;
+  { 4197,  7, 0, 0x02A23}, // plusacir;
+  { 5308,  4, 0, 0x0229E}, // plusb;
+  { 4729,  6, 0, 0x02A22}, // pluscir;
+  { 5662,  5, 0, 0x02214}, // plusdo;
+  { 4472,  5, 0, 0x02A25}, // plusdu;
+  { 4287,  4, 0, 0x02A72}, // pluse;
+  { 5667,  4, 0, 0x000B1}, // plusmn
+  { 5667,  5, 0, 0x000B1}, // plusmn;
+  { 4735,  6, 0, 0x02A26}, // plussim;
+  { 4741,  6, 0, 0x02A27}, // plustwo;
+  {   29,  1, 0, 0x000B1}, // pm;
+  { 3896,  7, 0, 0x02A15}, // pointint;
+  { 6247,  3, 0, 0x1D561}, // popf;
+  { 2784,  3, 0, 0x000A3}, // pound
+  { 6036,  4, 0, 0x000A3}, // pound;
+  {   29,  1, 0, 0x0227A}, // pr;
+  { 2683,  2, 0, 0x02AB3}, // prE;
+  { 3570,  3, 0, 0x02AB7}, // prap;
+  { 4988,  4, 0, 0x0227C}, // prcue;
+  {   94,  2, 0, 0x02AAF}, // pre;
+  { 3014,  3, 0, 0x0227A}, // prec;
+  { 3114,  9, 0, 0x02AB7}, // precapprox;
+  { 2897, 10, 0, 0x0227C}, // preccurlyeq;
+  { 4556,  5, 0, 0x02AAF}, // preceq;
+  { 2907, 10, 0, 0x02AB9}, // precnapprox;
+  { 3728,  7, 0, 0x02AB5}, // precneqq;
+  { 3735,  7, 0, 0x022E8}, // precnsim;
+  { 4333,  6, 0, 0x0227E}, // precsim;
+  { 3377,  4, 0, 0x02032}, // prime;
+  { 1628,  5, 0, 0x02119}, // primes;
+  { 5604,  3, 0, 0x02AB5}, // prnE;
+  { 5904,  4, 0, 0x02AB9}, // prnap;
+  { 3681,  5, 0, 0x022E8}, // prnsim;
+  { 4696,  3, 0, 0x0220F}, // prod;
+  { 3917,  7, 0, 0x0232E}, // profalar;
+  { 3924,  7, 0, 0x02312}, // profline;
+  { 3931,  7, 0, 0x02313}, // profsurf;
+  { 5004,  3, 0, 0x0221D}, // prop;
+  { 3552,  5, 0, 0x0221D}, // propto;
+  { 3682,  4, 0, 0x0227E}, // prsim;
+  { 5657,  5, 0, 0x022B0}, // prurel;
+  { 5721,  3, 0, 0x1D4C5}, // pscr;
+  { 2965,  2, 0, 0x003C8}, // psi;
+  { 5292,  5, 0, 0x02008}, // puncsp;
+  {   73,  2, 0, 0x1D52E}, // qfr;
+  { 1047,  3, 0, 0x02A0C}, // qint;
+  { 6247,  3, 0, 0x1D562}, // qopf;
+  { 3376,  5, 0, 0x02057}, // qprime;
+  { 5721,  3, 0, 0x1D4C6}, // qscr;
+  { 2847, 10, 0, 0x0210D}, // quaternions;
+  { 4255,  6, 0, 0x02A16}, // quatint;
+  { 4539,  4, 0, 0x0003F}, // quest;
+  { 4351,  6, 0, 0x0225F}, // questeq;
+  {  173,  2, 0, 0x00022}, // quot
+  { 1909,  3, 0, 0x00022}, // quot;
+  { 3871,  4, 0, 0x021DB}, // rAarr;
+  { 3872,  3, 0, 0x021D2}, // rArr;
+  { 1972,  5, 0, 0x0291C}, // rAtail;
+  { 3871,  4, 0, 0x0290F}, // rBarr;
+  {  330,  3, 0, 0x02964}, // rHar;
+  {  134,  3, 2, 0x0223D}, // race;
+  {   91,  5, 0, 0x00155}, // racute;
+  { 5788,  4, 0, 0x0221A}, // radic;
+  { 3742,  7, 0, 0x029B3}, // raemptyv;
+  { 2638,  3, 0, 0x027E9}, // rang;
+  { 5908,  4, 0, 0x02992}, // rangd;
+  { 2582,  4, 0, 0x029A5}, // range;
+  { 1440,  5, 0, 0x027E9}, // rangle;
+  { 4893,  3, 0, 0x000BB}, // raquo
+  { 4893,  4, 0, 0x000BB}, // raquo;
+  { 3872,  3, 0, 0x02192}, // rarr;
+  { 5492,  5, 0, 0x02975}, // rarrap;
+  { 5980,  4, 0, 0x021E5}, // rarrb;
+  { 4579,  6, 0, 0x02920}, // rarrbfs;
+  { 4913,  4, 0, 0x02933}, // rarrc;
+  { 5502,  5, 0, 0x0291E}, // rarrfs;
+  { 5507,  5, 0, 0x021AA}, // rarrhk;
+  { 5517,  5, 0, 0x021AC}, // rarrlp;
+  { 5522,  5, 0, 0x02945}, // rarrpl;
+  { 4591,  6, 0, 0x02974}, // rarrsim;
+  { 5527,  5, 0, 0x021A3}, // rarrtl;
+  { 4918,  4, 0, 0x0219D}, // rarrw;
+  { 1972,  5, 0, 0x0291A}, // ratail;
+  { 6012,  4, 0, 0x02236}, // ratio;
+  { 3597,  8, 0, 0x0211A}, // rationals;
+  { 3871,  4, 0, 0x0290D}, // rbarr;
+  { 4053,  4, 0, 0x02773}, // rbbrk;
+  { 3109,  5, 0, 0x0007D}, // rbrace;
+  { 5407,  5, 0, 0x0005D}, // rbrack;
+  { 5964,  4, 0, 0x0298C}, // rbrke;
+  { 4561,  6, 0, 0x0298E}, // rbrksld;
+  { 4567,  6, 0, 0x02990}, // rbrkslu;
+  { 4907,  5, 0, 0x00159}, // rcaron;
+  { 5052,  5, 0, 0x00157}, // rcedil;
+  { 5804,  4, 0, 0x02309}, // rceil;
+  { 3942,  3, 0, 0x0007D}, // rcub;
+  { 4780,  2, 0, 0x00440}, // rcy;
+  { 6205,  3, 0, 0x02937}, // rdca;
+  { 4429,  6, 0, 0x02969}, // rdldhar;
+  { 4893,  4, 0, 0x0201D}, // rdquo;
+  { 5387,  5, 0, 0x0201D}, // rdquor;
+  { 3004,  3, 0, 0x021B3}, // rdsh;
+  {   27,  3, 0, 0x0211C}, // real;
+  { 4237,  6, 0, 0x0211B}, // realine;
+  { 3651,  7, 0, 0x0211C}, // realpart;
+  { 3601,  4, 0, 0x0211D}, // reals;
+  { 3522,  3, 0, 0x025AD}, // rect;
+  {   25,  1, 0, 0x000AE}, // reg
+  { 2639,  2, 0, 0x000AE}, // reg;
+  { 5172,  5, 0, 0x0297D}, // rfisht;
+  { 3127,  5, 0, 0x0230B}, // rfloor;
+  {   73,  2, 0, 0x1D52F}, // rfr;
+  { 5123,  4, 0, 0x021C1}, // rhard;
+  { 5756,  4, 0, 0x021C0}, // rharu;
+  { 4927,  5, 0, 0x0296C}, // rharul;
+  { 3148,  2, 0, 0x003C1}, // rho;
+  { 6235,  3, 0, 0x003F1}, // rhov;
+  {  684,  9, 0, 0x02192}, // rightarrow;
+  { 1964, 13, 0, 0x021A3}, // rightarrowtail;
+  { 1280, 15, 0, 0x021C1}, // rightharpoondown;
+  { 1977, 13, 0, 0x021C0}, // rightharpoonup;
+  { 1605, 14, 0, 0x021C4}, // rightleftarrows;
+  {  922, 16, 0, 0x021CC}, // rightleftharpoons;
+  { 1295, 15, 0, 0x021C9}, // rightrightarrows;
+  {  469, 14, 0, 0x0219D}, // rightsquigarrow;
+  { 1619, 14, 0, 0x022CC}, // rightthreetimes;
+  { 2638,  3, 0, 0x002DA}, // ring;
+  { 2729, 11, 0, 0x02253}, // risingdotseq;
+  { 3871,  4, 0, 0x021C4}, // rlarr;
+  { 4025,  4, 0, 0x021CC}, // rlhar;
+  {  445,  2, 0, 0x0200F}, // rlm;
+  { 5322,  5, 0, 0x023B1}, // rmoust;
+  { 3159,  9, 0, 0x023B1}, // rmoustache;
+  { 3449,  4, 0, 0x02AEE}, // rnmid;
+  { 5740,  4, 0, 0x027ED}, // roang;
+  { 3871,  4, 0, 0x021FE}, // roarr;
+  { 4053,  4, 0, 0x027E7}, // robrk;
+  { 5928,  4, 0, 0x02986}, // ropar;
+  { 6247,  3, 0, 0x1D563}, // ropf;
+  { 3828,  5, 0, 0x02A2E}, // roplus;
+  { 1627,  6, 0, 0x02A35}, // rotimes;
+  {  330,  3, 0, 0x00029}, // rpar;
+  { 4897,  5, 0, 0x02994}, // rpargt;
+  { 3980,  7, 0, 0x02A12}, // rppolint;
+  { 3871,  4, 0, 0x021C9}, // rrarr;
+  { 4892,  5, 0, 0x0203A}, // rsaquo;
+  { 5721,  3, 0, 0x1D4C7}, // rscr;
+  { 3005,  2, 0, 0x021B1}, // rsh;
+  { 6253,  3, 0, 0x0005D}, // rsqb;
+  { 4893,  4, 0, 0x02019}, // rsquo;
+  { 5387,  5, 0, 0x02019}, // rsquor;
+  { 5127,  5, 0, 0x022CC}, // rthree;
+  { 1628,  5, 0, 0x022CA}, // rtimes;
+  { 4040,  3, 0, 0x025B9}, // rtri;
+  { 4449,  4, 0, 0x022B5}, // rtrie;
+  { 5960,  4, 0, 0x025B8}, // rtrif;
+  { 4036,  7, 0, 0x029CE}, // rtriltri;
+  { 4453,  6, 0, 0x02968}, // ruluhar;
+  {   29,  1, 0, 0x0211E}, // rx;
+  {   91,  5, 0, 0x0015B}, // sacute;
+  { 4893,  4, 0, 0x0201A}, // sbquo;
+  {   29,  1, 0, 0x0227B}, // sc;
+  { 2683,  2, 0, 0x02AB4}, // scE;
+  { 3570,  3, 0, 0x02AB8}, // scap;
+  { 4907,  5, 0, 0x00161}, // scaron;
+  { 4988,  4, 0, 0x0227D}, // sccue;
+  {   94,  2, 0, 0x02AB0}, // sce;
+  { 5052,  5, 0, 0x0015F}, // scedil;
+  { 2993,  4, 0, 0x0015D}, // scirc;
+  { 5604,  3, 0, 0x02AB6}, // scnE;
+  { 5904,  4, 0, 0x02ABA}, // scnap;
+  { 3681,  5, 0, 0x022E9}, // scnsim;
+  { 3980,  7, 0, 0x02A13}, // scpolint;
+  { 3682,  4, 0, 0x0227F}, // scsim;
+  { 4780,  2, 0, 0x00441}, // scy;
+  { 1909,  3, 0, 0x022C5}, // sdot;
+  { 5924,  4, 0, 0x022A1}, // sdotb;
+  {  173,  4, 0, 0x02A66}, // sdote;
+  { 5178,  4, 0, 0x021D8}, // seArr;
+  { 4178,  5, 0, 0x02925}, // searhk;
+  { 3871,  4, 0, 0x02198}, // searr;
+  {  477,  6, 0, 0x02198}, // searrow;
+  {  586,  2, 0, 0x000A7}, // sect
+  { 3522,  3, 0, 0x000A7}, // sect;
+  { 5809,  3, 0, 0x0003B}, // semi;
+  { 5582,  5, 0, 0x02929}, // seswar;
+  { 2280,  7, 0, 0x02216}, // setminus;
+  { 5073,  4, 0, 0x02216}, // setmn;
+  { 5853,  3, 0, 0x02736}, // sext;
+  {   73,  2, 0, 0x1D530}, // sfr;
+  { 5482,  5, 0, 0x02322}, // sfrown;
+  { 5752,  4, 0, 0x0266F}, // sharp;
+  { 4992,  5, 0, 0x00449}, // shchcy;
+  { 4779,  3, 0, 0x00448}, // shcy;
+  { 3446,  7, 0, 0x02223}, // shortmid;
+  { 1991, 12, 0, 0x02225}, // shortparallel;
+  {  126,  1, 0, 0x000AD}, // shy
+  { 4780,  2, 0, 0x000AD}, // shy;
+  { 4074,  4, 0, 0x003C3}, // sigma;
+  { 5092,  5, 0, 0x003C2}, // sigmaf;
+  { 5097,  5, 0, 0x003C2}, // sigmav;
+  {  445,  2, 0, 0x0223C}, // sim;
+  { 5242,  5, 0, 0x02A6A}, // simdot;
+  { 3378,  3, 0, 0x02243}, // sime;
+  { 3385,  4, 0, 0x02243}, // simeq;
+  { 5833,  3, 0, 0x02A9E}, // simg;
+  { 5884,  4, 0, 0x02AA0}, // simgE;
+  { 5837,  3, 0, 0x02A9D}, // siml;
+  { 5888,  4, 0, 0x02A9F}, // simlE;
+  { 5892,  4, 0, 0x02246}, // simne;
+  { 4459,  6, 0, 0x02A24}, // simplus;
+  { 4465,  6, 0, 0x02972}, // simrarr;
+  { 3871,  4, 0, 0x02190}, // slarr;
+  { 2275, 12, 0, 0x02216}, // smallsetminus;
+  { 4937,  5, 0, 0x02A33}, // smashp;
+  { 3749,  7, 0, 0x029E4}, // smeparsl;
+  { 3450,  3, 0, 0x02223}, // smid;
+  { 5263,  4, 0, 0x02323}, // smile;
+  {  606,  2, 0, 0x02AAA}, // smt;
+  {   93,  3, 0, 0x02AAC}, // smte;
+  { 6004,  4, 8, 0x02AAC}, // smtes;
+  { 5077,  5, 0, 0x0044C}, // softcy;
+  {   28,  2, 0, 0x0002F}, // sol;
+  { 5917,  3, 0, 0x029C4}, // solb;
+  { 5187,  5, 0, 0x0233F}, // solbar;
+  { 6247,  3, 0, 0x1D564}, // sopf;
+  { 4877,  5, 0, 0x02660}, // spades;
+  { 3357,  8, 0, 0x02660}, // spadesuit;
+  {  330,  3, 0, 0x02225}, // spar;
+  { 3962,  4, 0, 0x02293}, // sqcap;
+  { 4972,  5, 8, 0x02293}, // sqcaps;
+  { 3843,  4, 0, 0x02294}, // sqcup;
+  { 5007,  5, 8, 0x02294}, // sqcups;
+  { 3941,  4, 0, 0x0228F}, // sqsub;
+  { 4526,  5, 0, 0x02291}, // sqsube;
+  { 4120,  7, 0, 0x0228F}, // sqsubset;
+  { 3285,  9, 0, 0x02291}, // sqsubseteq;
+  { 4963,  4, 0, 0x02290}, // sqsup;
+  { 4532,  5, 0, 0x02292}, // sqsupe;
+  { 4127,  7, 0, 0x02290}, // sqsupset;
+  { 3294,  9, 0, 0x02292}, // sqsupseteq;
+  { 4475,  2, 0, 0x025A1}, // squ;
+  {  152,  5, 0, 0x025A1}, // square;
+  { 5627,  5, 0, 0x025AA}, // squarf;
+  { 6271,  3, 0, 0x025AA}, // squf;
+  { 3871,  4, 0, 0x02192}, // srarr;
+  { 5721,  3, 0, 0x1D4C8}, // sscr;
+  { 5072,  5, 0, 0x02216}, // ssetmn;
+  { 5262,  5, 0, 0x02323}, // ssmile;
+  { 5592,  5, 0, 0x022C6}, // sstarf;
+  {  330,  3, 0, 0x02606}, // star;
+  { 5593,  4, 0, 0x02605}, // starf;
+  { 1689, 14, 0, 0x003F5}, // straightepsilon;
+  { 2957, 10, 0, 0x003D5}, // straightphi;
+  { 5972,  4, 0, 0x000AF}, // strns;
+  { 3782,  2, 0, 0x02282}, // sub;
+  { 6029,  3, 0, 0x02AC5}, // subE;
+  { 4942,  5, 0, 0x02ABD}, // subdot;
+  { 4528,  3, 0, 0x02286}, // sube;
+  { 4261,  6, 0, 0x02AC3}, // subedot;
+  { 4267,  6, 0, 0x02AC1}, // submult;
+  { 5633,  4, 0, 0x02ACB}, // subnE;
+  { 5638,  4, 0, 0x0228A}, // subne;
+  { 4273,  6, 0, 0x02ABF}, // subplus;
+  { 4279,  6, 0, 0x02979}, // subrarr;
+  { 1824,  5, 0, 0x02282}, // subset;
+  { 3287,  7, 0, 0x02286}, // subseteq;
+  { 3322,  8, 0, 0x02AC5}, // subseteqq;
+  { 2699,  8, 0, 0x0228A}, // subsetneq;
+  { 2458,  9, 0, 0x02ACB}, // subsetneqq;
+  { 4952,  5, 0, 0x02AC7}, // subsim;
+  { 4957,  5, 0, 0x02AD5}, // subsub;
+  { 4962,  5, 0, 0x02AD3}, // subsup;
+  { 3024,  3, 0, 0x0227B}, // succ;
+  { 3096,  9, 0, 0x02AB8}, // succapprox;
+  { 2857, 10, 0, 0x0227D}, // succcurlyeq;
+  { 4712,  5, 0, 0x02AB0}, // succeq;
+  { 2867, 10, 0, 0x02ABA}, // succnapprox;
+  { 3672,  7, 0, 0x02AB6}, // succneqq;
+  { 3679,  7, 0, 0x022E9}, // succnsim;
+  { 4291,  6, 0, 0x0227F}, // succsim;
+  {  445,  2, 0, 0x02211}, // sum;
+  { 2638,  3, 0, 0x0266A}, // sung;
+  { 5568,  2, 0, 0x000B9}, // sup1
+  { 6238,  3, 0, 0x000B9}, // sup1;
+  { 6241,  2, 0, 0x000B2}, // sup2
+  { 6241,  3, 0, 0x000B2}, // sup2;
+  { 6244,  2, 0, 0x000B3}, // sup3
+  { 6244,  3, 0, 0x000B3}, // sup3;
+  { 1799,  2, 0, 0x02283}, // sup;
+  { 5897,  3, 0, 0x02AC6}, // supE;
+  { 5352,  5, 0, 0x02ABE}, // supdot;
+  { 4477,  6, 0, 0x02AD8}, // supdsub;
+  { 3725,  3, 0, 0x02287}, // supe;
+  { 4483,  6, 0, 0x02AC4}, // supedot;
+  { 4495,  6, 0, 0x027C9}, // suphsol;
+  { 4501,  6, 0, 0x02AD7}, // suphsub;
+  { 4507,  6, 0, 0x0297B}, // suplarr;
+  { 4513,  6, 0, 0x02AC2}, // supmult;
+  { 5648,  4, 0, 0x02ACC}, // supnE;
+  { 5653,  4, 0, 0x0228B}, // supne;
+  { 4519,  6, 0, 0x02AC0}, // supplus;
+  { 4129,  5, 0, 0x02283}, // supset;
+  { 3296,  7, 0, 0x02287}, // supseteq;
+  { 3340,  8, 0, 0x02AC6}, // supseteqq;
+  { 2710,  8, 0, 0x0228B}, // supsetneq;
+  { 2470,  9, 0, 0x02ACC}, // supsetneqq;
+  { 5367,  5, 0, 0x02AC8}, // supsim;
+  { 5372,  5, 0, 0x02AD4}, // supsub;
+  { 5377,  5, 0, 0x02AD6}, // supsup;
+  { 5178,  4, 0, 0x021D9}, // swArr;
+  { 4178,  5, 0, 0x02926}, // swarhk;
+  { 3871,  4, 0, 0x02199}, // swarr;
+  {  477,  6, 0, 0x02199}, // swarrow;
+  { 5317,  5, 0, 0x0292A}, // swnwar;
+  { 5153,  3, 0, 0x000DF}, // szlig
+  { 5153,  4, 0, 0x000DF}, // szlig;
+  { 5452,  5, 0, 0x02316}, // target;
+  { 4475,  2, 0, 0x003C4}, // tau;
+  { 3402,  3, 0, 0x023B4}, // tbrk;
+  { 4907,  5, 0, 0x00165}, // tcaron;
+  { 5052,  5, 0, 0x00163}, // tcedil;
+  { 4780,  2, 0, 0x00442}, // tcy;
+  { 1909,  3, 0, 0x020DB}, // tdot;
+  { 5227,  5, 0, 0x02315}, // telrec;
+  {   73,  2, 0, 0x1D531}, // tfr;
+  { 5062,  5, 0, 0x02234}, // there4;
+  { 3413,  8, 0, 0x02234}, // therefore;
+  { 4081,  4, 0, 0x003B8}, // theta;
+  { 3756,  7, 0, 0x003D1}, // thetasym;
+  { 5067,  5, 0, 0x003D1}, // thetav;
+  { 2927, 10, 0, 0x02248}, // thickapprox;
+  { 3861,  7, 0, 0x0223C}, // thicksim;
+  { 5157,  5, 0, 0x02009}, // thinsp;
+  { 5868,  4, 0, 0x02248}, // thkap;
+  { 3863,  5, 0, 0x0223C}, // thksim;
+  { 3708,  3, 0, 0x000FE}, // thorn
+  { 4998,  4, 0, 0x000FE}, // thorn;
+  { 1186,  4, 0, 0x002DC}, // tilde;
+  { 1629,  3, 0, 0x000D7}, // times
+  { 1629,  4, 0, 0x000D7}, // times;
+  { 5252,  5, 0, 0x022A0}, // timesb;
+  { 3910,  7, 0, 0x02A31}, // timesbar;
+  { 5257,  5, 0, 0x02A30}, // timesd;
+  { 1047,  3, 0, 0x0222D}, // tint;
+  { 6223,  3, 0, 0x02928}, // toea;
+  { 1799,  2, 0, 0x022A4}, // top;
+  { 5332,  5, 0, 0x02336}, // topbot;
+  { 5342,  5, 0, 0x02AF1}, // topcir;
+  { 6247,  3, 0, 0x1D565}, // topf;
+  { 4489,  6, 0, 0x02ADA}, // topfork;
+  { 6262,  3, 0, 0x02929}, // tosa;
+  { 3376,  5, 0, 0x02034}, // tprime;
+  { 5724,  4, 0, 0x02122}, // trade;
+  { 1438,  7, 0, 0x025B5}, // triangle;
+  {  783, 11, 0, 0x025BF}, // triangledown;
+  {  799, 11, 0, 0x025C3}, // triangleleft;
+  { 1718, 13, 0, 0x022B4}, // trianglelefteq;
+  { 3453,  8, 0, 0x0225C}, // triangleq;
+  {  596, 12, 0, 0x025B9}, // triangleright;
+  { 1371, 14, 0, 0x022B5}, // trianglerighteq;
+  { 5132,  5, 0, 0x025EC}, // tridot;
+  { 3767,  3, 0, 0x0225C}, // trie;
+  { 3882,  7, 0, 0x02A3A}, // triminus;
+  { 4411,  6, 0, 0x02A39}, // triplus;
+  { 5848,  4, 0, 0x029CD}, // trisb;
+  { 4417,  6, 0, 0x02A3B}, // tritime;
+  { 3973,  7, 0, 0x023E2}, // trpezium;
+  { 5721,  3, 0, 0x1D4C9}, // tscr;
+  { 4779,  3, 0, 0x00446}, // tscy;
+  { 4993,  4, 0, 0x0045B}, // tshcy;
+  { 5612,  5, 0, 0x00167}, // tstrok;
+  { 5852,  4, 0, 0x0226C}, // twixt;
+  { 1325, 15, 0, 0x0219E}, // twoheadleftarrow;
+  {  954, 16, 0, 0x021A0}, // twoheadrightarrow;
+  { 3872,  3, 0, 0x021D1}, // uArr;
+  {  330,  3, 0, 0x02963}, // uHar;
+  {   91,  4, 0, 0x000FA}, // uacute
+  {   91,  5, 0, 0x000FA}, // uacute;
+  { 3872,  3, 0, 0x02191}, // uarr;
+  { 5058,  4, 0, 0x0045E}, // ubrcy;
+  { 3632,  5, 0, 0x0016D}, // ubreve;
+  { 2831,  3, 0, 0x000FB}, // ucirc
+  { 2993,  4, 0, 0x000FB}, // ucirc;
+  { 4780,  2, 0, 0x00443}, // ucy;
+  { 3871,  4, 0, 0x021C5}, // udarr;
+  { 4947,  5, 0, 0x00171}, // udblac;
+  { 4025,  4, 0, 0x0296E}, // udhar;
+  { 5172,  5, 0, 0x0297E}, // ufisht;
+  {   73,  2, 0, 0x1D532}, // ufr;
+  { 1170,  4, 0, 0x000F9}, // ugrave
+  { 1170,  5, 0, 0x000F9}, // ugrave;
+  { 5748,  4, 0, 0x021BF}, // uharl;
+  { 3871,  4, 0, 0x021BE}, // uharr;
+  { 5772,  4, 0, 0x02580}, // uhblk;
+  { 4997,  5, 0, 0x0231C}, // ulcorn;
+  { 3707,  7, 0, 0x0231C}, // ulcorner;
+  { 5002,  5, 0, 0x0230F}, // ulcrop;
+  { 4039,  4, 0, 0x025F8}, // ultri;
+  { 5720,  4, 0, 0x0016B}, // umacr;
+  {    6,  1, 0, 0x000A8}, // uml
+  {   28,  2, 0, 0x000A8}, // uml;
+  { 5824,  4, 0, 0x00173}, // uogon;
+  { 6247,  3, 0, 0x1D566}, // uopf;
+  {  477,  6, 0, 0x02191}, // uparrow;
+  { 2887, 10, 0, 0x02195}, // updownarrow;
+  { 1887, 12, 0, 0x021BF}, // upharpoonleft;
+  { 1522, 13, 0, 0x021BE}, // upharpoonright;
+  { 3200,  4, 0, 0x0228E}, // uplus;
+  { 5949,  3, 0, 0x003C5}, // upsi;
+  { 5992,  4, 0, 0x003D2}, // upsih;
+  { 1697,  6, 0, 0x003C5}, // upsilon;
+  { 3330,  9, 0, 0x021C8}, // upuparrows;
+  { 4997,  5, 0, 0x0231D}, // urcorn;
+  { 3707,  7, 0, 0x0231D}, // urcorner;
+  { 5002,  5, 0, 0x0230E}, // urcrop;
+  { 2637,  4, 0, 0x0016F}, // uring;
+  { 4039,  4, 0, 0x025F9}, // urtri;
+  { 5721,  3, 0, 0x1D4CA}, // uscr;
+  { 3505,  4, 0, 0x022F0}, // utdot;
+  { 1185,  5, 0, 0x00169}, // utilde;
+  { 4040,  3, 0, 0x025B5}, // utri;
+  { 5960,  4, 0, 0x025B4}, // utrif;
+  { 3871,  4, 0, 0x021C8}, // uuarr;
+  { 5837,  2, 0, 0x000FC}, // uuml
+  { 5837,  3, 0, 0x000FC}, // uuml;
+  { 1439,  6, 0, 0x029A7}, // uwangle;
+  { 3872,  3, 0, 0x021D5}, // vArr;
+  {  330,  3, 0, 0x02AE8}, // vBar;
+  { 5760,  4, 0, 0x02AE9}, // vBarv;
+  { 3003,  4, 0, 0x022A8}, // vDash;
+  { 5302,  5, 0, 0x0299C}, // vangrt;
+  { 3213,  9, 0, 0x003F5}, // varepsilon;
+  { 4043,  7, 0, 0x003F0}, // varkappa;
+  { 3240,  9, 0, 0x02205}, // varnothing;
+  { 5487,  5, 0, 0x003D5}, // varphi;
+  { 5976,  4, 0, 0x003D6}, // varpi;
+  { 3549,  8, 0, 0x0221D}, // varpropto;
+  { 3872,  3, 0, 0x02195}, // varr;
+  { 5512,  5, 0, 0x003F1}, // varrho;
+  { 4071,  7, 0, 0x003C2}, // varsigma;
+  { 2696, 11, 8, 0x0228A}, // varsubsetneq;
+  { 2455, 12, 8, 0x02ACB}, // varsubsetneqq;
+  { 2707, 11, 8, 0x0228B}, // varsupsetneq;
+  { 2467, 12, 8, 0x02ACC}, // varsupsetneqq;
+  { 4078,  7, 0, 0x003D1}, // vartheta;
+  { 1731, 14, 0, 0x022B2}, // vartriangleleft;
+  { 1385, 15, 0, 0x022B3}, // vartriangleright;
+  { 4780,  2, 0, 0x00432}, // vcy;
+  { 3003,  4, 0, 0x022A2}, // vdash;
+  {   94,  2, 0, 0x02228}, // vee;
+  { 5047,  5, 0, 0x022BB}, // veebar;
+  { 5796,  4, 0, 0x0225A}, // veeeq;
+  { 5217,  5, 0, 0x022EE}, // vellip;
+  { 5417,  5, 0, 0x0007C}, // verbar;
+  { 3648,  3, 0, 0x0007C}, // vert;
+  {   73,  2, 0, 0x1D533}, // vfr;
+  { 4039,  4, 0, 0x022B2}, // vltri;
+  { 3941,  4, 6, 0x02282}, // vnsub;
+  { 4963,  4, 6, 0x02283}, // vnsup;
+  { 6247,  3, 0, 0x1D567}, // vopf;
+  { 5003,  4, 0, 0x0221D}, // vprop;
+  { 4039,  4, 0, 0x022B3}, // vrtri;
+  { 5721,  3, 0, 0x1D4CB}, // vscr;
+  { 5632,  5, 8, 0x02ACB}, // vsubnE;
+  { 5637,  5, 8, 0x0228A}, // vsubne;
+  { 5647,  5, 8, 0x02ACC}, // vsupnE;
+  { 5652,  5, 8, 0x0228B}, // vsupne;
+  { 4399,  6, 0, 0x0299A}, // vzigzag;
+  { 2993,  4, 0, 0x00175}, // wcirc;
+  { 5017,  5, 0, 0x02A5F}, // wedbar;
+  { 2194,  4, 0, 0x02227}, // wedge;
+  { 5037,  5, 0, 0x02259}, // wedgeq;
+  { 5137,  5, 0, 0x02118}, // weierp;
+  {   73,  2, 0, 0x1D534}, // wfr;
+  { 6247,  3, 0, 0x1D568}, // wopf;
+  {   29,  1, 0, 0x02118}, // wp;
+  {   29,  1, 0, 0x02240}, // wr;
+  { 5042,  5, 0, 0x02240}, // wreath;
+  { 5721,  3, 0, 0x1D4CC}, // wscr;
+  { 3570,  3, 0, 0x022C2}, // xcap;
+  { 2993,  4, 0, 0x025EF}, // xcirc;
+  { 1987,  3, 0, 0x022C3}, // xcup;
+  { 4039,  4, 0, 0x025BD}, // xdtri;
+  {   73,  2, 0, 0x1D535}, // xfr;
+  { 5178,  4, 0, 0x027FA}, // xhArr;
+  { 3871,  4, 0, 0x027F7}, // xharr;
+  {   29,  1, 0, 0x003BE}, // xi;
+  { 5178,  4, 0, 0x027F8}, // xlArr;
+  { 3871,  4, 0, 0x027F5}, // xlarr;
+  { 3570,  3, 0, 0x027FC}, // xmap;
+  { 1202,  3, 0, 0x022FB}, // xnis;
+  { 3505,  4, 0, 0x02A00}, // xodot;
+  { 6247,  3, 0, 0x1D569}, // xopf;
+  { 3828,  5, 0, 0x02A01}, // xoplus;
+  { 4418,  5, 0, 0x02A02}, // xotime;
+  { 5178,  4, 0, 0x027F9}, // xrArr;
+  { 3871,  4, 0, 0x027F6}, // xrarr;
+  { 5721,  3, 0, 0x1D4CD}, // xscr;
+  { 3842,  5, 0, 0x02A06}, // xsqcup;
+  { 3828,  5, 0, 0x02A04}, // xuplus;
+  { 4039,  4, 0, 0x025B3}, // xutri;
+  { 2182,  3, 0, 0x022C1}, // xvee;
+  { 2193,  5, 0, 0x022C0}, // xwedge;
+  {   91,  4, 0, 0x000FD}, // yacute
+  {   91,  5, 0, 0x000FD}, // yacute;
+  { 4779,  3, 0, 0x0044F}, // yacy;
+  { 2993,  4, 0, 0x00177}, // ycirc;
+  { 4780,  2, 0, 0x0044B}, // ycy;
+  {    1,  1, 0, 0x000A5}, // yen
+  {  725,  2, 0, 0x000A5}, // yen;
+  {   73,  2, 0, 0x1D536}, // yfr;
+  { 4779,  3, 0, 0x00457}, // yicy;
+  { 6247,  3, 0, 0x1D56A}, // yopf;
+  { 5721,  3, 0, 0x1D4CE}, // yscr;
+  { 4779,  3, 0, 0x0044E}, // yucy;
+  { 5837,  2, 0, 0x000FF}, // yuml
+  { 5837,  3, 0, 0x000FF}, // yuml;
+  {   91,  5, 0, 0x0017A}, // zacute;
+  { 4907,  5, 0, 0x0017E}, // zcaron;
+  { 4780,  2, 0, 0x00437}, // zcy;
+  { 1909,  3, 0, 0x0017C}, // zdot;
+  { 3172,  5, 0, 0x02128}, // zeetrf;
+  { 4082,  3, 0, 0x003B6}, // zeta;
+  {   73,  2, 0, 0x1D537}, // zfr;
+  { 4779,  3, 0, 0x00436}, // zhcy;
+  { 3869,  6, 0, 0x021DD}, // zigrarr;
+  { 6247,  3, 0, 0x1D56B}, // zopf;
+  { 5721,  3, 0, 0x1D4CF}, // zscr;
+  { 6233,  2, 0, 0x0200D}, // zwj;
+  { 6232,  3, 0, 0x0200C}, // zwnj;
+};
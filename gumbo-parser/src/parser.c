@@ -17,18 +17,23 @@
 
 #include <assert.h>
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "arena.h"
 #include "ascii.h"
 #include "attribute.h"
 #include "error.h"
 #include "gumbo.h"
 #include "insertion_mode.h"
+#include "intern.h"
 #include "macros.h"
 #include "parser.h"
+#include "position.h"
 #include "replacement.h"
+#include "speculation.h"
 #include "tokenizer.h"
 #include "tokenizer_states.h"
 #include "utf8.h"
@@ -51,9 +56,25 @@ const GumboOptions kGumboDefaultOptions = {
   .stop_on_first_error = false,
   .max_errors = -1,
   .fragment_context = GUMBO_TAG_LAST,
-  .fragment_namespace = GUMBO_NAMESPACE_HTML
+  .fragment_namespace = GUMBO_NAMESPACE_HTML,
+  .use_arena = false,
+  .lazy_positions = false,
+  .callbacks = NULL,
+  .zero_copy_text = false,
+  .tokenizer_threads = 0,
+  .stats = NULL,
+  .index_attributes = false
 };
 
+// Bumps a counter in the caller's GumboParseStats, if there is one.
+#define COUNT_STAT(parser, field) \
+  do { \
+    GumboParseStats* stats_ = (parser)->_options->stats; \
+    if (unlikely(stats_)) { \
+      ++stats_->field; \
+    } \
+  } while (0)
+
 #define STRING(s) {.data = s, .length = sizeof(s) - 1}
 #define TERMINATOR {.data = "", .length = 0}
 
@@ -208,6 +229,8 @@ typedef struct _TextNodeBufferState {
   GumboNodeType _type;
 } TextNodeBufferState;
 
+#define FORMATTING_BUCKETS 256
+
 typedef struct GumboInternalParserState {
   // https://html.spec.whatwg.org/multipage/parsing.html#insertion-mode
   GumboInsertionMode _insertion_mode;
@@ -219,6 +242,27 @@ typedef struct GumboInternalParserState {
   // https://html.spec.whatwg.org/multipage/parsing.html#the-stack-of-open-elements
   GumboVector /*GumboNode*/ _open_elements;
 
+  // The number of HTML elements of each tag on the stack of open elements,
+  // kept up to date by the functions below that push and remove them. Most
+  // scope checks are for an element that isn't open at all, which this
+  // answers without walking the stack.
+  unsigned int _open_html_element_counts[GUMBO_TAG_LAST];
+
+  // The tag stack recorded for the last parse error, one entry per open
+  // element from the bottom up, and how many of its entries are known to
+  // still match the stack of open elements. The next error only looks at the
+  // part of the stack above those, so errors under the same elements share
+  // their snapshots.
+  GumboVector /*const GumboTagStack*/ _error_tag_stack;
+  unsigned int _error_tag_stack_unchanged;
+
+  // The number of scope markers in the list of active formatting elements,
+  // and how many of its elements fall in each bucket of signature and scope
+  // (see formatting_bucket). The Noah's Ark clause only has to look for
+  // identical elements in a bucket that has three.
+  unsigned int _formatting_markers;
+  unsigned int _formatting_bucket_counts[FORMATTING_BUCKETS];
+
   // https://html.spec.whatwg.org/multipage/parsing.html#the-list-of-active-formatting-elements
   GumboVector /*GumboNode*/ _active_formatting_elements;
 
@@ -261,6 +305,23 @@ typedef struct GumboInternalParserState {
   // The current token.
   GumboToken* _current_token;
 
+  // Storage for the token being handled, which _current_token points to. It
+  // lives here rather than on the stack so that an incremental parse can pick
+  // up where the last chunk left off.
+  GumboToken _token;
+
+  // Whether any parse error has been reported so far, for stop_on_first_error.
+  bool _has_error;
+
+  // Tokens lexed ahead on other threads, with GumboOptions.tokenizer_threads.
+  GumboSpeculation* _speculation;
+
+  // With GumboOptions.callbacks, the nodes that have been reported closed or
+  // that have dropped out of the list of active formatting elements during the
+  // current token. They're freed after it has been handled, once nothing else
+  // refers to them (see release_closed_nodes).
+  GumboVector _closed_nodes;
+
   // The way that the spec is written, the </body> and </html> tags are *always*
   // implicit, because encountering one of those tokens merely switches the
   // insertion mode out of "in body". So we have individual state flags for
@@ -284,7 +345,11 @@ static bool attribute_matches (
   const char* value
 ) {
   const GumboAttribute* attr = gumbo_get_attribute(attributes, name);
-  return attr ? gumbo_ascii_strcasecmp(value, attr->value) == 0 : false;
+  size_t length = strlen(value);
+  return
+    attr
+    && attr->value_length == length
+    && gumbo_ascii_strncasecmp(value, attr->value, length) == 0;
 }
 
 // Checks if the value of the specified attribute is a case-sensitive match
@@ -292,10 +357,14 @@ static bool attribute_matches (
 static bool attribute_matches_case_sensitive (
   const GumboVector* attributes,
   const char* name,
-  const char* value
+  const char* value,
+  size_t length
 ) {
   const GumboAttribute* attr = gumbo_get_attribute(attributes, name);
-  return attr ? strcmp(value, attr->value) == 0 : false;
+  return
+    attr
+    && attr->value_length == length
+    && memcmp(value, attr->value, length) == 0;
 }
 
 // Checks if the specified attribute vectors are identical.
@@ -306,7 +375,14 @@ static bool all_attributes_match (
   unsigned int num_unmatched_attr2_elements = attr2->length;
   for (unsigned int i = 0; i < attr1->length; ++i) {
     const GumboAttribute* attr = attr1->data[i];
-    if (attribute_matches_case_sensitive(attr2, attr->name, attr->value)) {
+    if (
+      attribute_matches_case_sensitive (
+        attr2,
+        attr->name,
+        attr->value,
+        attr->value_length
+      )
+    ) {
       --num_unmatched_attr2_elements;
     } else {
       return false;
@@ -320,17 +396,74 @@ static void set_frameset_not_ok(GumboParser* parser) {
   parser->_parser_state->_frameset_ok = false;
 }
 
-static GumboNode* create_node(GumboNodeType type) {
-  GumboNode* node = gumbo_alloc(sizeof(GumboNode));
+// Elements are allocated with room for this many children after the node,
+// which their children vector uses until it outgrows it.
+#define INLINE_CHILDREN 2
+
+// Tree construction's own bookkeeping for an element, kept in the element's
+// allocation between the node and its inline children.
+typedef struct {
+  // The element's index in the stack of open elements and in the list of
+  // active formatting elements, or -1 if it isn't in them. Kept up to date by
+  // the functions that add elements to and remove them from those lists, so
+  // finding an element in either takes constant time.
+  int open_index;
+  int formatting_index;
+
+  // For elements that have been in the list of active formatting elements, a
+  // hash of the qualified name and attributes (see element_signature), and
+  // the bucket that the element is counted in while it's in the list.
+  uint32_t signature;
+  unsigned int formatting_bucket;
+} ElementState;
+
+static ElementState* element_state(const GumboNode* node) {
+  assert(node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE);
+  return (ElementState*) (node + 1);
+}
+
+static void** inline_children(GumboNode* node) {
+  return (void**) ((ElementState*) (node + 1) + 1);
+}
+
+// Only allocates the part of the node's union that its type uses.
+static GumboNode* create_node(GumboParser* parser, GumboNodeType type) {
+  COUNT_STAT(parser, nodes[type]);
+  size_t size;
+  switch (type) {
+    case GUMBO_NODE_DOCUMENT:
+      size = offsetof(GumboNode, v) + sizeof(GumboDocument);
+      break;
+    case GUMBO_NODE_ELEMENT:
+    case GUMBO_NODE_TEMPLATE:
+      size =
+        sizeof(GumboNode) + sizeof(ElementState)
+        + INLINE_CHILDREN * sizeof(void*);
+      break;
+    default:
+      size = offsetof(GumboNode, v) + sizeof(GumboText);
+      break;
+  }
+  GumboNode* node = gumbo_alloc(size);
   node->parent = NULL;
   node->index_within_parent = -1;
   node->type = type;
   node->parse_flags = GUMBO_INSERTION_NORMAL;
+  if (type == GUMBO_NODE_ELEMENT || type == GUMBO_NODE_TEMPLATE) {
+    node->v.element.attribute_index = NULL;
+    GumboVector* children = &node->v.element.children;
+    children->data = inline_children(node);
+    children->length = 0;
+    children->capacity = INLINE_CHILDREN;
+    element_state(node)->open_index = -1;
+    element_state(node)->formatting_index = -1;
+    element_state(node)->signature = 0;
+  }
   return node;
 }
 
-static GumboNode* new_document_node() {
-  GumboNode* document_node = create_node(GUMBO_NODE_DOCUMENT);
+static GumboNode* new_document_node(GumboParser* parser) {
+  GumboNode* document_node = create_node(parser, GUMBO_NODE_DOCUMENT);
   document_node->parse_flags = GUMBO_INSERTION_BY_PARSER;
   gumbo_vector_init(1, &document_node->v.document.children);
 
@@ -346,32 +479,80 @@ static GumboNode* new_document_node() {
 
 static void output_init(GumboParser* parser) {
   GumboOutput* output = gumbo_alloc(sizeof(GumboOutput));
+  output->arena = NULL;
+  if (parser->_options->use_arena) {
+    // Everything but the output struct itself comes out of the arena, so
+    // that gumbo_destroy_output() can release the tree without walking it.
+    output->arena = gumbo_arena_new();
+    gumbo_set_arena(output->arena);
+  }
+  output->line_index = NULL;
+  output->input_buffers = NULL;
+  output->names = gumbo_intern_table_new();
   output->root = NULL;
-  output->document = new_document_node();
+  output->document = new_document_node(parser);
   output->status = GUMBO_STATUS_OK;
   parser->_output = output;
   gumbo_init_errors(parser);
+  // With an arena, the errors are kept in it along with everything else.
+  output->error_arena = output->arena;
 }
 
-static void parser_state_init(GumboParser* parser) {
-  GumboParserState* parser_state = gumbo_alloc(sizeof(GumboParserState));
+// Gets the parser state ready for a new document, keeping the capacity of its
+// stacks and buffers.
+static void parser_state_reset(GumboParser* parser) {
+  GumboParserState* parser_state = parser->_parser_state;
   parser_state->_insertion_mode = GUMBO_INSERTION_MODE_INITIAL;
   parser_state->_reprocess_current_token = false;
   parser_state->_frameset_ok = true;
   parser_state->_ignore_next_linefeed = false;
   parser_state->_foster_parent_insertions = false;
   parser_state->_text_node._type = GUMBO_NODE_WHITESPACE;
-  gumbo_string_buffer_init(&parser_state->_text_node._buffer);
-  gumbo_vector_init(10, &parser_state->_open_elements);
-  gumbo_vector_init(5, &parser_state->_active_formatting_elements);
-  gumbo_vector_init(5, &parser_state->_template_insertion_modes);
+  parser_state->_text_node._start_original_text = NULL;
+  gumbo_string_buffer_clear(&parser_state->_text_node._buffer);
+  parser_state->_open_elements.length = 0;
+  parser_state->_error_tag_stack.length = 0;
+  parser_state->_error_tag_stack_unchanged = 0;
+  memset (
+    parser_state->_open_html_element_counts,
+    0,
+    sizeof(parser_state->_open_html_element_counts)
+  );
+  parser_state->_formatting_markers = 0;
+  memset (
+    parser_state->_formatting_bucket_counts,
+    0,
+    sizeof(parser_state->_formatting_bucket_counts)
+  );
+  parser_state->_active_formatting_elements.length = 0;
+  parser_state->_template_insertion_modes.length = 0;
+  parser_state->_closed_nodes.length = 0;
   parser_state->_head_element = NULL;
   parser_state->_form_element = NULL;
   parser_state->_fragment_ctx = NULL;
   parser_state->_current_token = NULL;
+  parser_state->_has_error = false;
+  parser_state->_speculation = NULL;
   parser_state->_closed_body_tag = false;
   parser_state->_closed_html_tag = false;
+}
+
+static void parser_state_init(GumboParser* parser) {
+  GumboParserState* parser_state = gumbo_alloc(sizeof(GumboParserState));
+  gumbo_string_buffer_init(&parser_state->_text_node._buffer);
+  gumbo_vector_init(10, &parser_state->_open_elements);
+  gumbo_vector_init(10, &parser_state->_error_tag_stack);
+  gumbo_vector_init(5, &parser_state->_active_formatting_elements);
+  gumbo_vector_init(5, &parser_state->_template_insertion_modes);
+  // Only used with callbacks. It can't start out empty if it may be kept for
+  // another parse (see gumbo_parser_reset), or it would first be allocated
+  // in that parse's arena.
+  gumbo_vector_init (
+    parser->_options->callbacks ? 8 : 0,
+    &parser_state->_closed_nodes
+  );
   parser->_parser_state = parser_state;
+  parser_state_reset(parser);
 }
 
 typedef void (*TreeTraversalCallback)(GumboNode* node);
@@ -431,15 +612,20 @@ static void destroy_node_callback(GumboNode* node) {
         gumbo_destroy_attribute(node->v.element.attributes.data[i]);
       }
       gumbo_free(node->v.element.attributes.data);
-      gumbo_free(node->v.element.children.data);
-      if (node->v.element.tag == GUMBO_TAG_UNKNOWN)
-        gumbo_free((void *)node->v.element.name);
+      gumbo_free(node->v.element.attribute_index);
+      if (node->v.element.children.data != inline_children(node)) {
+        gumbo_free(node->v.element.children.data);
+      }
       break;
     case GUMBO_NODE_TEXT:
     case GUMBO_NODE_CDATA:
     case GUMBO_NODE_COMMENT:
     case GUMBO_NODE_WHITESPACE:
-      gumbo_free((void*) node->v.text.text);
+      // Text shared with the source (see GumboOptions.zero_copy_text)
+      // starts exactly at the original text.
+      if (node->v.text.text != node->v.text.original_text.data) {
+        gumbo_free((void*) node->v.text.text);
+      }
       break;
   }
   gumbo_free(node);
@@ -451,12 +637,11 @@ static void destroy_node(GumboNode* node) {
 
 static void parser_state_destroy(GumboParser* parser) {
   GumboParserState* state = parser->_parser_state;
-  if (state->_fragment_ctx) {
-    destroy_node(state->_fragment_ctx);
-  }
   gumbo_vector_destroy(&state->_active_formatting_elements);
   gumbo_vector_destroy(&state->_open_elements);
+  gumbo_vector_destroy(&state->_error_tag_stack);
   gumbo_vector_destroy(&state->_template_insertion_modes);
+  gumbo_vector_destroy(&state->_closed_nodes);
   gumbo_string_buffer_destroy(&state->_text_node._buffer);
   gumbo_free(state);
 }
@@ -728,6 +913,42 @@ static void reset_insertion_mode_appropriately(GumboParser* parser) {
   assert(0);
 }
 
+// Returns the tag stack of the current stack of open elements, reusing the
+// entries of the last one for as much of it as has the same tags.
+static const GumboTagStack* snapshot_tag_stack(GumboParser* parser) {
+  GumboParserState* state = parser->_parser_state;
+  const GumboVector* open_elements = &state->_open_elements;
+  GumboVector* snapshot = &state->_error_tag_stack;
+  assert(state->_error_tag_stack_unchanged <= open_elements->length);
+  for (
+    unsigned int i = state->_error_tag_stack_unchanged;
+    i < open_elements->length;
+    ++i
+  ) {
+    const GumboNode* node = open_elements->data[i];
+    assert (
+      node->type == GUMBO_NODE_ELEMENT
+      || node->type == GUMBO_NODE_TEMPLATE
+    );
+    const GumboTagStack* below = i ? snapshot->data[i - 1] : NULL;
+    if (i < snapshot->length) {
+      const GumboTagStack* entry = snapshot->data[i];
+      if (entry->below == below && entry->tag == node->v.element.tag) {
+        continue;
+      }
+    } else {
+      gumbo_vector_add(NULL, snapshot);
+    }
+    GumboTagStack* entry = gumbo_add_error_tag_stack(parser);
+    entry->below = below;
+    entry->tag = node->v.element.tag;
+    snapshot->data[i] = entry;
+  }
+  snapshot->length = open_elements->length;
+  state->_error_tag_stack_unchanged = open_elements->length;
+  return snapshot->length ? snapshot->data[snapshot->length - 1] : NULL;
+}
+
 static GumboError* parser_add_parse_error (
   GumboParser* parser,
   const GumboToken* token
@@ -748,20 +969,8 @@ static GumboError* parser_add_parse_error (
   } else if (token->type == GUMBO_TOKEN_END_TAG) {
     extra_data->input_tag = token->v.end_tag.tag;
   }
-  const GumboParserState* state = parser->_parser_state;
-  extra_data->parser_state = state->_insertion_mode;
-  gumbo_vector_init(state->_open_elements.length, &extra_data->tag_stack);
-  for (unsigned int i = 0; i < state->_open_elements.length; ++i) {
-    const GumboNode* node = state->_open_elements.data[i];
-    assert (
-      node->type == GUMBO_NODE_ELEMENT
-      || node->type == GUMBO_NODE_TEMPLATE
-    );
-    gumbo_vector_add (
-      (void*) node->v.element.tag,
-      &extra_data->tag_stack
-    );
-  }
+  extra_data->parser_state = parser->_parser_state->_insertion_mode;
+  extra_data->tag_stack = snapshot_tag_stack(parser);
   return error;
 }
 
@@ -834,6 +1043,7 @@ static InsertionLocation get_appropriate_insertion_location (
   }
 
   // Foster-parenting case.
+  COUNT_STAT(parser, foster_parented_insertions);
   int last_template_index = -1;
   int last_table_index = -1;
   const GumboVector* open_elements = &parser->_parser_state->_open_elements;
@@ -867,6 +1077,45 @@ static InsertionLocation get_appropriate_insertion_location (
   return retval;
 }
 
+// Moves the children of an element out of the node's own allocation when
+// there's no room left there for another, since the vector can only grow
+// memory that was allocated separately.
+static void make_room_for_child(GumboNode* parent) {
+  GumboVector* children = &parent->v.element.children;
+  if (
+    children->data == inline_children(parent)
+    && children->length == children->capacity
+  ) {
+    void** data = gumbo_alloc(2 * children->capacity * sizeof(void*));
+    memcpy(data, children->data, children->length * sizeof(void*));
+    children->data = data;
+    children->capacity *= 2;
+  }
+}
+
+// Moves every child of `from` to `to`, which must be a new element with no
+// children. A separately allocated vector is handed over as a whole, reducing
+// memory traffic and allocations.
+static void move_children(GumboNode* from, GumboNode* to) {
+  GumboVector* source = &from->v.element.children;
+  GumboVector* target = &to->v.element.children;
+  assert(target->length == 0 && target->data == inline_children(to));
+  if (source->data == inline_children(from)) {
+    memcpy(target->data, source->data, source->length * sizeof(void*));
+    target->length = source->length;
+    source->length = 0;
+  } else {
+    *target = *source;
+    source->data = inline_children(from);
+    source->length = 0;
+    source->capacity = INLINE_CHILDREN;
+  }
+  for (unsigned int i = 0; i < target->length; ++i) {
+    GumboNode* child = target->data[i];
+    child->parent = to;
+  }
+}
+
 // Appends a node to the end of its parent, setting the "parent" and
 // "index_within_parent" fields appropriately.
 static void append_node(GumboNode* parent, GumboNode* node) {
@@ -878,6 +1127,7 @@ static void append_node(GumboNode* parent, GumboNode* node) {
     || parent->type == GUMBO_NODE_TEMPLATE
   ) {
     children = &parent->v.element.children;
+    make_room_for_child(parent);
   } else {
     assert(parent->type == GUMBO_NODE_DOCUMENT);
     children = &parent->v.document.children;
@@ -903,6 +1153,7 @@ static void insert_node(GumboNode* node, InsertionLocation location) {
       || parent->type == GUMBO_NODE_TEMPLATE
     ) {
       children = &parent->v.element.children;
+      make_room_for_child(parent);
     } else if (parent->type == GUMBO_NODE_DOCUMENT) {
       children = &parent->v.document.children;
       assert(children->length == 0);
@@ -926,6 +1177,53 @@ static void insert_node(GumboNode* node, InsertionLocation location) {
   }
 }
 
+// Queues a node to be freed after the current token, if it's no longer needed
+// by then. Only used with GumboOptions.callbacks.
+static void add_closed_node(GumboParser* parser, GumboNode* node) {
+  GumboVector* closed_nodes = &parser->_parser_state->_closed_nodes;
+  if (
+    parser->_options->callbacks
+    && gumbo_vector_index_of(closed_nodes, node) == -1
+  ) {
+    gumbo_vector_add(node, closed_nodes);
+  }
+}
+
+// Passes a node to the callbacks in the options, if any: the start or end of an
+// element, or a complete text or comment node. Once reported, nodes other than
+// started elements are queued to be freed.
+static void report_node(GumboParser* parser, GumboNode* node, bool is_end) {
+  const GumboCallbacks* callbacks = parser->_options->callbacks;
+  if (likely(!callbacks)) {
+    return;
+  }
+  switch (node->type) {
+    case GUMBO_NODE_ELEMENT:
+    case GUMBO_NODE_TEMPLATE:
+      if (!is_end) {
+        if (callbacks->start_element) {
+          callbacks->start_element(callbacks->userdata, node);
+        }
+        return;
+      }
+      if (callbacks->end_element) {
+        callbacks->end_element(callbacks->userdata, node);
+      }
+      break;
+    case GUMBO_NODE_COMMENT:
+      if (callbacks->comment) {
+        callbacks->comment(callbacks->userdata, node);
+      }
+      break;
+    default:
+      if (callbacks->characters) {
+        callbacks->characters(callbacks->userdata, node);
+      }
+      break;
+  }
+  add_closed_node(parser, node);
+}
+
 static void maybe_flush_text_node_buffer(GumboParser* parser) {
   GumboParserState* state = parser->_parser_state;
   TextNodeBufferState* buffer_state = &state->_text_node;
@@ -938,13 +1236,23 @@ static void maybe_flush_text_node_buffer(GumboParser* parser) {
     || buffer_state->_type == GUMBO_NODE_TEXT
     || buffer_state->_type == GUMBO_NODE_CDATA
   );
-  GumboNode* text_node = create_node(buffer_state->_type);
+  GumboNode* text_node = create_node(parser, buffer_state->_type);
   GumboText* text_node_data = &text_node->v.text;
-  text_node_data->text = gumbo_string_buffer_to_string(&buffer_state->_buffer);
+  const GumboStringBuffer* buffer = &buffer_state->_buffer;
   text_node_data->original_text.data = buffer_state->_start_original_text;
   text_node_data->original_text.length =
       state->_current_token->original_text.data -
       buffer_state->_start_original_text;
+  text_node_data->text_length = buffer->length;
+  if (
+    parser->_options->zero_copy_text
+    && buffer->length == text_node_data->original_text.length
+    && !memcmp(buffer->data, text_node_data->original_text.data, buffer->length)
+  ) {
+    text_node_data->text = text_node_data->original_text.data;
+  } else {
+    text_node_data->text = gumbo_string_buffer_to_string(buffer);
+  }
   text_node_data->start_pos = buffer_state->_start_position;
 
   gumbo_debug (
@@ -960,6 +1268,7 @@ static void maybe_flush_text_node_buffer(GumboParser* parser) {
     destroy_node(text_node);
   } else {
     insert_node(text_node, location);
+    report_node(parser, text_node, false);
   }
 
   gumbo_string_buffer_clear(&buffer_state->_buffer);
@@ -978,6 +1287,194 @@ static void record_end_of_element (
       : kGumboEmptyString;
 }
 
+static void count_open_element (
+  GumboParserState* state,
+  const GumboNode* node,
+  int delta
+) {
+  const GumboElement* element = &node->v.element;
+  if (element->tag_namespace == GUMBO_NAMESPACE_HTML) {
+    state->_open_html_element_counts[element->tag] += delta;
+  }
+}
+
+// Notes that the stack of open elements has changed from `index` up, so that
+// the next parse error takes a new snapshot of that part of it.
+static void tag_stack_changed_at(GumboParserState* state, unsigned int index) {
+  if (state->_error_tag_stack_unchanged > index) {
+    state->_error_tag_stack_unchanged = index;
+  }
+}
+
+// Updates the indices of the open elements from `index` up, after an
+// insertion or removal there.
+static void renumber_open_elements(GumboParserState* state, unsigned int index) {
+  const GumboVector* open_elements = &state->_open_elements;
+  for (unsigned int i = index; i < open_elements->length; ++i) {
+    element_state(open_elements->data[i])->open_index = i;
+  }
+}
+
+static void push_open_element(GumboParserState* state, GumboNode* node) {
+  element_state(node)->open_index = state->_open_elements.length;
+  gumbo_vector_add(node, &state->_open_elements);
+  count_open_element(state, node, 1);
+}
+
+static void insert_open_element_at (
+  GumboParserState* state,
+  GumboNode* node,
+  unsigned int index
+) {
+  gumbo_vector_insert_at(node, index, &state->_open_elements);
+  renumber_open_elements(state, index);
+  tag_stack_changed_at(state, index);
+  count_open_element(state, node, 1);
+}
+
+static void remove_open_element_at(GumboParserState* state, unsigned int index) {
+  GumboNode* node = gumbo_vector_remove_at(index, &state->_open_elements);
+  element_state(node)->open_index = -1;
+  renumber_open_elements(state, index);
+  tag_stack_changed_at(state, index);
+  count_open_element(state, node, -1);
+}
+
+static void remove_open_element(GumboParserState* state, GumboNode* node) {
+  int index = element_state(node)->open_index;
+  assert(index >= 0);
+  remove_open_element_at(state, index);
+}
+
+// Puts `node` in the place of the open element at `index`, which must have the
+// same tag.
+static void replace_open_element (
+  GumboParserState* state,
+  unsigned int index,
+  GumboNode* node
+) {
+  GumboNode** slot = (GumboNode**) &state->_open_elements.data[index];
+  element_state(*slot)->open_index = -1;
+  element_state(node)->open_index = index;
+  *slot = node;
+}
+
+static bool is_open_element(const GumboNode* node) {
+  return element_state(node)->open_index >= 0;
+}
+
+// The list of active formatting elements is kept the same way. Scope markers
+// have no index of their own.
+static void set_formatting_index(const GumboNode* node, int index) {
+  if (node != &kActiveFormattingScopeMarker) {
+    element_state(node)->formatting_index = index;
+  }
+}
+
+static void renumber_formatting_elements (
+  GumboParserState* state,
+  unsigned int index
+) {
+  const GumboVector* elements = &state->_active_formatting_elements;
+  for (unsigned int i = index; i < elements->length; ++i) {
+    set_formatting_index(elements->data[i], i);
+  }
+}
+
+// Elements are counted by signature and by the number of markers before them,
+// since the Noah's Ark clause only compares elements in the same scope. A
+// bucket may hold more than one kind of element, so its count only bounds the
+// number of identical elements.
+static unsigned int formatting_bucket (
+  const GumboParserState* state,
+  uint32_t signature
+) {
+  return
+    (signature + state->_formatting_markers * 0x9E3779B9u)
+    % FORMATTING_BUCKETS;
+}
+
+static void count_formatting_element (
+  GumboParserState* state,
+  const GumboNode* node,
+  bool add
+) {
+  if (node == &kActiveFormattingScopeMarker) {
+    state->_formatting_markers += add ? 1 : -1;
+    return;
+  }
+  ElementState* element = element_state(node);
+  if (add) {
+    element->formatting_bucket = formatting_bucket(state, element->signature);
+    ++state->_formatting_bucket_counts[element->formatting_bucket];
+  } else {
+    --state->_formatting_bucket_counts[element->formatting_bucket];
+  }
+}
+
+static void push_formatting_element (
+  GumboParserState* state,
+  const GumboNode* node
+) {
+  set_formatting_index(node, state->_active_formatting_elements.length);
+  gumbo_vector_add((void*) node, &state->_active_formatting_elements);
+  count_formatting_element(state, node, true);
+}
+
+static GumboNode* pop_formatting_element(GumboParserState* state) {
+  GumboNode* node = gumbo_vector_pop(&state->_active_formatting_elements);
+  if (node) {
+    set_formatting_index(node, -1);
+    count_formatting_element(state, node, false);
+  }
+  return node;
+}
+
+// Only used by the adoption agency algorithm, which inserts in the current
+// scope.
+static void insert_formatting_element_at (
+  GumboParserState* state,
+  GumboNode* node,
+  unsigned int index
+) {
+  gumbo_vector_insert_at(node, index, &state->_active_formatting_elements);
+  renumber_formatting_elements(state, index);
+  count_formatting_element(state, node, true);
+}
+
+static GumboNode* remove_formatting_element_at (
+  GumboParserState* state,
+  unsigned int index
+) {
+  GumboNode* node =
+    gumbo_vector_remove_at(index, &state->_active_formatting_elements);
+  set_formatting_index(node, -1);
+  renumber_formatting_elements(state, index);
+  count_formatting_element(state, node, false);
+  return node;
+}
+
+static void remove_formatting_element(GumboParserState* state, GumboNode* node) {
+  int index = element_state(node)->formatting_index;
+  assert(index >= 0);
+  remove_formatting_element_at(state, index);
+}
+
+static void replace_formatting_element (
+  GumboParserState* state,
+  unsigned int index,
+  GumboNode* node
+) {
+  GumboVector* elements = &state->_active_formatting_elements;
+  const GumboNode* old_node = elements->data[index];
+  // The replacement is always a clone, so it's counted in the same bucket.
+  element_state(node)->formatting_bucket =
+    element_state(old_node)->formatting_bucket;
+  set_formatting_index(old_node, -1);
+  set_formatting_index(node, index);
+  elements->data[index] = node;
+}
+
 static GumboNode* pop_current_node(GumboParser* parser) {
   GumboParserState* state = parser->_parser_state;
   maybe_flush_text_node_buffer(parser);
@@ -993,6 +1490,9 @@ static GumboNode* pop_current_node(GumboParser* parser) {
     assert(state->_open_elements.length == 0);
     return NULL;
   }
+  element_state(current_node)->open_index = -1;
+  tag_stack_changed_at(state, state->_open_elements.length);
+  count_open_element(state, current_node, -1);
   assert (
     current_node->type == GUMBO_NODE_ELEMENT
     || current_node->type == GUMBO_NODE_TEMPLATE
@@ -1023,6 +1523,7 @@ static GumboNode* pop_current_node(GumboParser* parser) {
   if (!is_closed_body_or_html_tag) {
     record_end_of_element(state->_current_token, &current_node->v.element);
   }
+  report_node(parser, current_node, true);
   return current_node;
 }
 
@@ -1032,13 +1533,15 @@ static void append_comment_node (
   const GumboToken* token
 ) {
   maybe_flush_text_node_buffer(parser);
-  GumboNode* comment = create_node(GUMBO_NODE_COMMENT);
+  GumboNode* comment = create_node(parser, GUMBO_NODE_COMMENT);
   comment->type = GUMBO_NODE_COMMENT;
   comment->parse_flags = GUMBO_INSERTION_NORMAL;
   comment->v.text.text = token->v.text;
+  comment->v.text.text_length = strlen(token->v.text);
   comment->v.text.original_text = token->original_text;
   comment->v.text.start_pos = token->position;
   append_node(node, comment);
+  report_node(parser, comment, false);
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#clear-the-stack-back-to-a-table-row-context
@@ -1072,9 +1575,8 @@ static GumboNode* create_element(GumboParser* parser, GumboTag tag) {
   // XXX: This will fail for creating fragments with an element with tag
   // GUMBO_TAG_UNKNOWN
   assert(tag != GUMBO_TAG_UNKNOWN);
-  GumboNode* node = create_node(GUMBO_NODE_ELEMENT);
+  GumboNode* node = create_node(parser, GUMBO_NODE_ELEMENT);
   GumboElement* element = &node->v.element;
-  gumbo_vector_init(1, &element->children);
   gumbo_vector_init(0, &element->attributes);
   element->tag = tag;
   element->name = gumbo_normalized_tagname(tag);
@@ -1091,6 +1593,7 @@ static GumboNode* create_element(GumboParser* parser, GumboTag tag) {
 
 // Constructs an element from the given start tag token.
 static GumboNode* create_element_from_token (
+  GumboParser* parser,
   GumboToken* token,
   GumboNamespaceEnum tag_namespace
 ) {
@@ -1106,9 +1609,8 @@ static GumboNode* create_element_from_token (
     : GUMBO_NODE_ELEMENT
   ;
 
-  GumboNode* node = create_node(type);
+  GumboNode* node = create_node(parser, type);
   GumboElement* element = &node->v.element;
-  gumbo_vector_init(1, &element->children);
   element->attributes = start_tag->attributes;
   element->tag = start_tag->tag;
   element->name = start_tag->name ? start_tag->name : gumbo_normalized_tagname(start_tag->tag);
@@ -1121,6 +1623,9 @@ static GumboNode* create_element_from_token (
   element->start_pos = token->position;
   element->original_end_tag = kGumboEmptyString;
   element->end_pos = kGumboEmptySourcePosition;
+  if (parser->_options->index_attributes) {
+    gumbo_index_attributes(element);
+  }
 
   // The element takes ownership of the attributes and name from the token, so
   // any allocated-memory fields should be nulled out.
@@ -1150,7 +1655,8 @@ static void insert_element (
   }
   InsertionLocation location = get_appropriate_insertion_location(parser, NULL);
   insert_node(node, location);
-  gumbo_vector_add((void*) node, &state->_open_elements);
+  push_open_element(state, node);
+  report_node(parser, node, false);
 }
 
 // Convenience method that combines create_element_from_token and
@@ -1160,7 +1666,11 @@ static GumboNode* insert_element_from_token (
   GumboParser* parser,
   GumboToken* token
 ) {
-  GumboNode* element = create_element_from_token(token, GUMBO_NAMESPACE_HTML);
+  GumboNode* element = create_element_from_token (
+    parser,
+    token,
+    GUMBO_NAMESPACE_HTML
+  );
   insert_element(parser, element, false);
   gumbo_debug (
     "Inserting <%s> element (@%p) from token.\n",
@@ -1197,14 +1707,15 @@ static GumboNode* insert_foreign_element (
   GumboNamespaceEnum tag_namespace
 ) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
-  GumboNode* element = create_element_from_token(token, tag_namespace);
+  GumboNode* element = create_element_from_token(parser, token, tag_namespace);
   insert_element(parser, element, false);
   if (
     token_has_attribute(token, "xmlns")
     && !attribute_matches_case_sensitive (
       &token->v.start_tag.attributes,
       "xmlns",
-      kLegalXmlns[tag_namespace]
+      kLegalXmlns[tag_namespace],
+      strlen(kLegalXmlns[tag_namespace])
     )
   ) {
     // TODO(jdtang): Since there're multiple possible error codes here, we
@@ -1216,7 +1727,8 @@ static GumboNode* insert_foreign_element (
     && !attribute_matches_case_sensitive (
       &token->v.start_tag.attributes,
       "xmlns:xlink",
-      "http://www.w3.org/1999/xlink"
+      "http://www.w3.org/1999/xlink",
+      sizeof("http://www.w3.org/1999/xlink") - 1
     )
   ) {
     parser_add_parse_error(parser, token);
@@ -1237,10 +1749,17 @@ static void insert_text_token(GumboParser* parser, GumboToken* token) {
     buffer_state->_start_original_text = token->original_text.data;
     buffer_state->_start_position = token->position;
   }
-  gumbo_string_buffer_append_codepoint (
-    token->v.character,
-    &buffer_state->_buffer
-  );
+  if (token->is_character_run) {
+    gumbo_string_buffer_append_string (
+      &token->original_text,
+      &buffer_state->_buffer
+    );
+  } else {
+    gumbo_string_buffer_append_codepoint (
+      token->v.character,
+      &buffer_state->_buffer
+    );
+  }
   if (token->type == GUMBO_TOKEN_CHARACTER) {
     buffer_state->_type = GUMBO_NODE_TEXT;
   } else if (token->type == GUMBO_TOKEN_CDATA) {
@@ -1283,6 +1802,33 @@ static bool find_last_anchor_index(GumboParser* parser, int* anchor_index) {
   return false;
 }
 
+static uint32_t hash_bytes(uint32_t hash, const char* data, size_t length) {
+  // FNV-1a.
+  for (size_t i = 0; i < length; ++i) {
+    hash = (hash ^ (unsigned char) data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// A hash of everything the Noah's Ark clause compares: the element's
+// qualified name and its attributes, in any order.
+static uint32_t element_signature(const GumboElement* element) {
+  uint32_t signature =
+    (element->tag * 3u + element->tag_namespace) * 2654435761u;
+  if (element->tag == GUMBO_TAG_UNKNOWN) {
+    signature =
+      hash_bytes(signature, element->name, strlen(element->name));
+  }
+  const GumboVector* attributes = &element->attributes;
+  for (unsigned int i = 0; i < attributes->length; ++i) {
+    const GumboAttribute* attr = attributes->data[i];
+    uint32_t hash = hash_bytes(2166136261u, attr->name, strlen(attr->name));
+    hash = hash_bytes(hash ^ 0xFF, attr->value, attr->value_length);
+    signature += hash;
+  }
+  return signature;
+}
+
 // Counts the number of open formatting elements in the list of active
 // formatting elements (after the last active scope marker) that have a specific
 // tag. If this is > 0, then earliest_matching_index will be filled in with the
@@ -1293,6 +1839,7 @@ static int count_formatting_elements_of_tag (
   int* earliest_matching_index
 ) {
   const GumboElement* desired_element = &desired_node->v.element;
+  uint32_t signature = element_state(desired_node)->signature;
   GumboVector* elements = &parser->_parser_state->_active_formatting_elements;
   int num_identical_elements = 0;
   for (int i = elements->length; --i >= 0;) {
@@ -1302,7 +1849,8 @@ static int count_formatting_elements_of_tag (
     }
     assert(node->type == GUMBO_NODE_ELEMENT);
     if (
-      node_qualified_tagname_is (
+      element_state(node)->signature == signature
+      && node_qualified_tagname_is (
         node,
         desired_element->tag_namespace,
         desired_element->tag,
@@ -1323,61 +1871,61 @@ static void add_formatting_element(GumboParser* parser, const GumboNode* node) {
     node == &kActiveFormattingScopeMarker
     || node->type == GUMBO_NODE_ELEMENT
   );
-  GumboVector* elements = &parser->_parser_state->_active_formatting_elements;
+  GumboParserState* state = parser->_parser_state;
   if (node == &kActiveFormattingScopeMarker) {
     gumbo_debug("Adding a scope marker.\n");
-  } else {
-    gumbo_debug("Adding a formatting element.\n");
+    push_formatting_element(state, node);
+    return;
   }
-
-  // Hunt for identical elements.
-  int earliest_identical_element = elements->length;
-  int num_identical_elements = count_formatting_elements_of_tag (
-    parser,
-    node,
-    &earliest_identical_element
-  );
-
-  // Noah's Ark clause: if there're at least 3, remove the earliest.
-  if (num_identical_elements >= 3) {
-    gumbo_debug (
-      "Noah's ark clause: removing element at %d.\n",
-      earliest_identical_element
+  gumbo_debug("Adding a formatting element.\n");
+  uint32_t signature = element_signature(&node->v.element);
+  element_state(node)->signature = signature;
+
+  // Hunt for identical elements, unless there can't be three of them.
+  unsigned int bucket = formatting_bucket(state, signature);
+  if (state->_formatting_bucket_counts[bucket] >= 3) {
+    int earliest_identical_element = state->_active_formatting_elements.length;
+    int num_identical_elements = count_formatting_elements_of_tag (
+      parser,
+      node,
+      &earliest_identical_element
     );
-    gumbo_vector_remove_at(earliest_identical_element, elements);
-  }
 
-  gumbo_vector_add((void*) node, elements);
-}
-
-static bool is_open_element(const GumboParser* parser, const GumboNode* node) {
-  const GumboVector* open_elements = &parser->_parser_state->_open_elements;
-  for (unsigned int i = 0; i < open_elements->length; ++i) {
-    if (open_elements->data[i] == node) {
-      return true;
+    // Noah's Ark clause: if there're at least 3, remove the earliest.
+    if (num_identical_elements >= 3) {
+      gumbo_debug (
+        "Noah's ark clause: removing element at %d.\n",
+        earliest_identical_element
+      );
+      add_closed_node (
+        parser,
+        remove_formatting_element_at(state, earliest_identical_element)
+      );
     }
   }
-  return false;
+
+  push_formatting_element(state, node);
 }
 
 // Clones attributes, tags, etc. of a node, but does not copy the content. The
 // clone shares no structure with the original node: all owned strings and
 // values are fresh copies.
 static GumboNode* clone_node (
+  GumboParser* parser,
   GumboNode* node,
   GumboParseFlags reason
 ) {
   assert(node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE);
-  GumboNode* new_node = gumbo_alloc(sizeof(GumboNode));
-  *new_node = *node;
-  new_node->parent = NULL;
-  new_node->index_within_parent = -1;
+  GumboNode* new_node = create_node(parser, node->type);
+  element_state(new_node)->signature = element_state(node)->signature;
+  GumboElement* element = &new_node->v.element;
+  GumboVector children = element->children;
+  *element = node->v.element;
+  element->children = children;
   // Clear the GUMBO_INSERTION_IMPLICIT_END_TAG flag, as the cloned node may
   // have a separate end tag.
-  new_node->parse_flags &= ~GUMBO_INSERTION_IMPLICIT_END_TAG;
+  new_node->parse_flags = node->parse_flags & ~GUMBO_INSERTION_IMPLICIT_END_TAG;
   new_node->parse_flags |= reason | GUMBO_INSERTION_BY_PARSER;
-  GumboElement* element = &new_node->v.element;
-  gumbo_vector_init(1, &element->children);
 
   const GumboVector* old_attributes = &node->v.element.attributes;
   gumbo_vector_init(old_attributes->length, &element->attributes);
@@ -1385,10 +1933,15 @@ static GumboNode* clone_node (
     const GumboAttribute* old_attr = old_attributes->data[i];
     GumboAttribute* attr = gumbo_alloc(sizeof(GumboAttribute));
     *attr = *old_attr;
-    attr->name = gumbo_strdup(old_attr->name);
-    attr->value = gumbo_strdup(old_attr->value);
+    if (gumbo_attribute_owns_value(old_attr)) {
+      attr->value = gumbo_strdup(old_attr->value);
+    }
     gumbo_vector_add(attr, &element->attributes);
   }
+  element->attribute_index = NULL;
+  if (parser->_options->index_attributes) {
+    gumbo_index_attributes(element);
+  }
   return new_node;
 }
 
@@ -1397,6 +1950,7 @@ static GumboNode* clone_node (
 // mess of GOTOs in the spec to reasonably structured programming.
 // https://github.com/html5lib/html5lib-python/blob/master/html5lib/treebuilders/base.py
 static void reconstruct_active_formatting_elements(GumboParser* parser) {
+  COUNT_STAT(parser, formatting_reconstructions);
   GumboVector* elements = &parser->_parser_state->_active_formatting_elements;
   // Step 1
   if (elements->length == 0) {
@@ -1408,7 +1962,7 @@ static void reconstruct_active_formatting_elements(GumboParser* parser) {
   GumboNode* element = elements->data[i];
   if (
     element == &kActiveFormattingScopeMarker
-    || is_open_element(parser, element)
+    || is_open_element(element)
   ) {
     return;
   }
@@ -1424,7 +1978,7 @@ static void reconstruct_active_formatting_elements(GumboParser* parser) {
     element = elements->data[--i];
   } while (
     element != &kActiveFormattingScopeMarker
-    && !is_open_element(parser, element)
+    && !is_open_element(element)
   );
 
   ++i;
@@ -1440,6 +1994,7 @@ static void reconstruct_active_formatting_elements(GumboParser* parser) {
     element = elements->data[i];
     assert(element != &kActiveFormattingScopeMarker);
     GumboNode* clone = clone_node (
+      parser,
       element,
       GUMBO_INSERTION_RECONSTRUCTED_FORMATTING_ELEMENT
     );
@@ -1447,13 +2002,12 @@ static void reconstruct_active_formatting_elements(GumboParser* parser) {
     InsertionLocation location =
         get_appropriate_insertion_location(parser, NULL);
     insert_node(clone, location);
-    gumbo_vector_add (
-      (void*) clone,
-      &parser->_parser_state->_open_elements
-    );
+    push_open_element(parser->_parser_state, clone);
+    report_node(parser, clone, false);
 
     // Step 10.
-    elements->data[i] = clone;
+    replace_formatting_element(parser->_parser_state, i, clone);
+    add_closed_node(parser, element);
     gumbo_debug (
       "Reconstructed %s element at %u.\n",
       gumbo_normalized_tagname(clone->v.element.tag),
@@ -1463,11 +2017,13 @@ static void reconstruct_active_formatting_elements(GumboParser* parser) {
 }
 
 static void clear_active_formatting_elements(GumboParser* parser) {
-  GumboVector* elements = &parser->_parser_state->_active_formatting_elements;
   int num_elements_cleared = 0;
-  const GumboNode* node;
+  GumboNode* node;
   do {
-    node = gumbo_vector_pop(elements);
+    node = pop_formatting_element(parser->_parser_state);
+    if (node && node != &kActiveFormattingScopeMarker) {
+      add_closed_node(parser, node);
+    }
     ++num_elements_cleared;
   } while (node && node != &kActiveFormattingScopeMarker);
   gumbo_debug (
@@ -1526,7 +2082,19 @@ static bool has_an_element_in_specific_scope (
   bool negate,
   const TagSet* tags
 ) {
-  const GumboVector* open_elements = &parser->_parser_state->_open_elements;
+  const GumboParserState* state = parser->_parser_state;
+  bool is_open = false;
+  for (int j = 0; j < expected_size; ++j) {
+    if (state->_open_html_element_counts[expected[j]] > 0) {
+      is_open = true;
+      break;
+    }
+  }
+  if (!is_open) {
+    return false;
+  }
+
+  const GumboVector* open_elements = &state->_open_elements;
   for (int i = open_elements->length; --i >= 0;) {
     const GumboNode* node = open_elements->data[i];
     if (node->type != GUMBO_NODE_ELEMENT && node->type != GUMBO_NODE_TEMPLATE) {
@@ -1863,6 +2431,7 @@ static void maybe_implicitly_close_list_tag (
 }
 
 static void merge_attributes (
+  GumboParser* parser,
   GumboToken* token,
   GumboNode* node
 ) {
@@ -1873,7 +2442,7 @@ static void merge_attributes (
 
   for (unsigned int i = 0; i < token_attr->length; ++i) {
     GumboAttribute* attr = token_attr->data[i];
-    if (!gumbo_get_attribute(node_attr, attr->name)) {
+    if (!gumbo_element_get_attribute(&node->v.element, attr->name)) {
       // Ownership of the attribute is transferred by this gumbo_vector_add,
       // so it has to be nulled out of the original token so it doesn't get
       // double-deleted.
@@ -1881,6 +2450,9 @@ static void merge_attributes (
       token_attr->data[i] = NULL;
     }
   }
+  if (parser->_options->index_attributes) {
+    gumbo_index_attributes(&node->v.element);
+  }
   // When attributes are merged, it means the token has been ignored and merged
   // with another token, so we need to free its memory. The attributes that are
   // transferred need to be nulled-out in the vector above so that they aren't
@@ -1902,10 +2474,14 @@ const char* gumbo_normalize_svg_tagname(const GumboStringPiece* tag) {
   return replacement ? replacement->to : NULL;
 }
 
+static const char* intern_name(GumboParser* parser, const char* name) {
+  return gumbo_intern(parser->_output->names, name, strlen(name));
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#adjust-foreign-attributes
 // This destructively modifies any matching attributes on the token and sets the
 // namespace appropriately.
-static void adjust_foreign_attributes(GumboToken* token) {
+static void adjust_foreign_attributes(GumboParser* parser, GumboToken* token) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
   const GumboVector* attributes = &token->v.start_tag.attributes;
   for (unsigned int i = 0, n = attributes->length; i < n; ++i) {
@@ -1917,15 +2493,14 @@ static void adjust_foreign_attributes(GumboToken* token) {
     if (!entry) {
       continue;
     }
-    gumbo_free((void*) attr->name);
     attr->attr_namespace = entry->attr_namespace;
-    attr->name = gumbo_strdup(entry->local_name);
+    attr->name = intern_name(parser, entry->local_name);
   }
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-main-inforeign
 // This adjusts svg tags.
-static void adjust_svg_tag(GumboToken* token) {
+static void adjust_svg_tag(GumboParser* parser, GumboToken* token) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
   if (token->v.start_tag.tag == GUMBO_TAG_FOREIGNOBJECT) {
     assert(token->v.start_tag.name == NULL);
@@ -1937,15 +2512,14 @@ static void adjust_svg_tag(GumboToken* token) {
       strlen(token->v.start_tag.name)
     );
     if (replacement) {
-      // This cast is safe because we allocated this memory and we'll free it.
-      strcpy((char *)token->v.start_tag.name, replacement->to);
+      token->v.start_tag.name = intern_name(parser, replacement->to);
     }
   }
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#adjust-svg-attributes
 // This destructively modifies any matching attributes on the token.
-static void adjust_svg_attributes(GumboToken* token) {
+static void adjust_svg_attributes(GumboParser* parser, GumboToken* token) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
   const GumboVector* attributes = &token->v.start_tag.attributes;
   for (unsigned int i = 0, n = attributes->length; i < n; i++) {
@@ -1957,15 +2531,14 @@ static void adjust_svg_attributes(GumboToken* token) {
     if (!replacement) {
       continue;
     }
-    gumbo_free((void*) attr->name);
-    attr->name = gumbo_strdup(replacement->to);
+    attr->name = intern_name(parser, replacement->to);
   }
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#adjust-mathml-attributes
 // Note that this may destructively modify the token with the new attribute
 // value.
-static void adjust_mathml_attributes(GumboToken* token) {
+static void adjust_mathml_attributes(GumboParser* parser, GumboToken* token) {
   assert(token->type == GUMBO_TOKEN_START_TAG);
   GumboAttribute* attr = gumbo_get_attribute (
     &token->v.start_tag.attributes,
@@ -1974,8 +2547,7 @@ static void adjust_mathml_attributes(GumboToken* token) {
   if (!attr) {
     return;
   }
-  gumbo_free((void*) attr->name);
-  attr->name = gumbo_strdup("definitionURL");
+  attr->name = intern_name(parser, "definitionURL");
 }
 
 static bool doctype_matches (
@@ -2022,10 +2594,21 @@ static void remove_from_parent(GumboNode* node) {
     // the common ancestor at the end of the adoption agency algorithm.
     return;
   }
-  assert(node->parent->type == GUMBO_NODE_ELEMENT);
-  GumboVector* children = &node->parent->v.element.children;
-  int index = gumbo_vector_index_of(children, node);
-  assert(index != -1);
+  GumboVector* children;
+  if (node->parent->type == GUMBO_NODE_DOCUMENT) {
+    // Only comments are ever removed from the document (by
+    // release_closed_nodes).
+    assert(node->type == GUMBO_NODE_COMMENT);
+    children = &node->parent->v.document.children;
+  } else {
+    assert (
+      node->parent->type == GUMBO_NODE_ELEMENT
+      || node->parent->type == GUMBO_NODE_TEMPLATE
+    );
+    children = &node->parent->v.element.children;
+  }
+  unsigned int index = node->index_within_parent;
+  assert(index < children->length && children->data[index] == node);
 
   gumbo_vector_remove_at(index, children);
   node->parent = NULL;
@@ -2036,6 +2619,74 @@ static void remove_from_parent(GumboNode* node) {
   }
 }
 
+// Returns true if tree construction may still look at the node or anything in
+// its subtree, which must then be kept around.
+static bool is_node_in_use(GumboParser* parser, const GumboNode* node) {
+  GumboParserState* state = parser->_parser_state;
+  if (
+    node->type == GUMBO_NODE_DOCUMENT
+    || node == parser->_output->root
+    || node == state->_head_element
+    || node == state->_form_element
+    || gumbo_vector_index_of(&state->_closed_nodes, node) != -1
+    || (
+      (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE)
+      && (
+        is_open_element(node)
+        || element_state(node)->formatting_index >= 0
+      )
+    )
+  ) {
+    return true;
+  }
+  if (node->type == GUMBO_NODE_ELEMENT || node->type == GUMBO_NODE_TEMPLATE) {
+    const GumboVector* children = &node->v.element.children;
+    for (unsigned int i = 0; i < children->length; ++i) {
+      if (is_node_in_use(parser, children->data[i])) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// With GumboOptions.callbacks, frees the nodes queued by add_closed_node once
+// they're no longer in use, along with any ancestors that were only being kept
+// for their sake. Called between tokens, since the token handlers hold on to
+// nodes that they've just popped.
+static void release_closed_nodes(GumboParser* parser) {
+  GumboVector* closed_nodes = &parser->_parser_state->_closed_nodes;
+  while (closed_nodes->length > 0) {
+    GumboNode* node = gumbo_vector_pop(closed_nodes);
+    while (!is_node_in_use(parser, node)) {
+      GumboNode* parent = node->parent;
+      remove_from_parent(node);
+      destroy_node(node);
+      if (!parent) {
+        break;
+      }
+      node = parent;
+    }
+  }
+}
+
+// Drops any queued closed nodes in the given subtree, which is about to be
+// destroyed.
+static void forget_closed_nodes(GumboParser* parser, const GumboNode* root) {
+  GumboVector* closed_nodes = &parser->_parser_state->_closed_nodes;
+  for (unsigned int i = 0; i < closed_nodes->length;) {
+    const GumboNode* node = closed_nodes->data[i];
+    while (node && node != root) {
+      node = node->parent;
+    }
+    if (node) {
+      gumbo_vector_remove_at(i, closed_nodes);
+    } else {
+      ++i;
+    }
+  }
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#an-introduction-to-error-handling-and-strange-cases-in-the-parser
 // Also described in the "in body" handling for end formatting tags.
 static bool adoption_agency_algorithm (
@@ -2045,15 +2696,13 @@ static bool adoption_agency_algorithm (
 ) {
   GumboParserState* state = parser->_parser_state;
   gumbo_debug("Entering adoption agency algorithm.\n");
+  COUNT_STAT(parser, adoption_agency_runs);
   // Step 1.
   GumboNode* current_node = get_current_node(parser);
   if (
     current_node->v.element.tag_namespace == GUMBO_NAMESPACE_HTML
     && current_node->v.element.tag == subject
-    && -1 == gumbo_vector_index_of (
-      &state->_active_formatting_elements,
-      current_node
-    )
+    && element_state(current_node)->formatting_index == -1
   ) {
     pop_current_node(parser);
     return false;
@@ -2073,10 +2722,8 @@ static bool adoption_agency_algorithm (
       if (node_html_tag_is(current_node, subject)) {
         // Found it.
         formatting_node = current_node;
-        formatting_node_in_open_elements = gumbo_vector_index_of (
-          &state->_open_elements,
-          formatting_node
-        );
+        formatting_node_in_open_elements =
+          element_state(formatting_node)->open_index;
         gumbo_debug (
           "Formatting element of tag %s at %d.\n",
           gumbo_normalized_tagname(subject),
@@ -2097,10 +2744,8 @@ static bool adoption_agency_algorithm (
     if (formatting_node_in_open_elements == -1) {
       gumbo_debug("Formatting node not on stack of open elements.\n");
       parser_add_parse_error(parser, token);
-      gumbo_vector_remove (
-        formatting_node,
-        &state->_active_formatting_elements
-      );
+      remove_formatting_element(state, formatting_node);
+      add_closed_node(parser, formatting_node);
       return false;
     }
 
@@ -2141,10 +2786,7 @@ static bool adoption_agency_algorithm (
       }
       // And the formatting element itself.
       pop_current_node(parser);
-      gumbo_vector_remove (
-        formatting_node,
-        &state->_active_formatting_elements
-      );
+      remove_formatting_element(state, formatting_node);
       return false;
     }
     assert(!node_html_tag_is(furthest_block, GUMBO_TAG_HTML));
@@ -2154,7 +2796,7 @@ static bool adoption_agency_algorithm (
     // Elements may be moved and reparented by this algorithm, so
     // common_ancestor is not necessarily the same as formatting_node->parent.
     GumboNode* common_ancestor = state->_open_elements.data [
-      gumbo_vector_index_of(&state->_open_elements, formatting_node) - 1
+      element_state(formatting_node)->open_index - 1
     ];
     gumbo_debug (
       "Common ancestor tag = %s, furthest block tag = %s.\n",
@@ -2163,24 +2805,21 @@ static bool adoption_agency_algorithm (
     );
 
     // Step 12.
-    int bookmark = 1 + gumbo_vector_index_of (
-      &state->_active_formatting_elements,
-      formatting_node
-    );
+    int bookmark = 1 + element_state(formatting_node)->formatting_index;
     gumbo_debug("Bookmark at %d.\n", bookmark);
     // Step 13.
     GumboNode* node = furthest_block;
     GumboNode* last_node = furthest_block;
     // Must be stored explicitly, in case node is removed from the stack of open
     // elements, to handle step 9.4.
-    int saved_node_index = gumbo_vector_index_of(&state->_open_elements, node);
+    int saved_node_index = element_state(node)->open_index;
     assert(saved_node_index > 0);
     // Step 13.1.
     for (int j = 0;;) {
       // Step 13.2.
       ++j;
       // Step 13.3.
-      int node_index = gumbo_vector_index_of(&state->_open_elements, node);
+      int node_index = element_state(node)->open_index;
       gumbo_debug (
         "Current index: %d, last index: %d.\n",
         node_index,
@@ -2198,17 +2837,11 @@ static bool adoption_agency_algorithm (
         // Step 13.4.
         break;
       }
-      int formatting_index = gumbo_vector_index_of (
-        &state->_active_formatting_elements,
-        node
-      );
+      int formatting_index = element_state(node)->formatting_index;
       if (j > 3 && formatting_index != -1) {
         // Step 13.5.
         gumbo_debug("Removing formatting element at %d.\n", formatting_index);
-        gumbo_vector_remove_at (
-          formatting_index,
-          &state->_active_formatting_elements
-        );
+        remove_formatting_element_at(state, formatting_index);
         // Removing the element shifts all indices over by one, so we may need
         // to move the bookmark.
         if (formatting_index < bookmark) {
@@ -2219,17 +2852,23 @@ static bool adoption_agency_algorithm (
       }
       if (formatting_index == -1) {
         // Step 13.6.
-        gumbo_vector_remove_at(node_index, &state->_open_elements);
+        remove_open_element_at(state, node_index);
+        report_node(parser, node, true);
         continue;
       }
       // Step 13.7.
       // "common ancestor as the intended parent" doesn't actually mean insert
       // it into the common ancestor; that happens below.
-      node = clone_node(node, GUMBO_INSERTION_ADOPTION_AGENCY_CLONED);
+      report_node(parser, node, true);
+      node = clone_node (
+        parser,
+        node,
+        GUMBO_INSERTION_ADOPTION_AGENCY_CLONED
+      );
       assert(formatting_index >= 0);
-      state->_active_formatting_elements.data[formatting_index] = node;
+      replace_formatting_element(state, formatting_index, node);
       assert(node_index >= 0);
-      state->_open_elements.data[node_index] = node;
+      replace_open_element(state, node_index, node);
       // Step 13.8.
       if (last_node == furthest_block) {
         bookmark = formatting_index + 1;
@@ -2260,27 +2899,27 @@ static bool adoption_agency_algorithm (
       gumbo_normalized_tagname(location.target->v.element.tag)
     );
     insert_node(last_node, location);
+    // The clones made in step 13.7 are only now part of the tree, each one the
+    // sole child of the next, so they're reported from the outermost in.
+    for (
+      GumboNode* clone = last_node;
+      clone != furthest_block;
+      clone = clone->v.element.children.data[0]
+    ) {
+      assert(clone->v.element.children.length == 1);
+      report_node(parser, clone, false);
+    }
 
     // Step 15.
     GumboNode* new_formatting_node = clone_node (
+      parser,
       formatting_node,
       GUMBO_INSERTION_ADOPTION_AGENCY_CLONED
     );
     formatting_node->parse_flags |= GUMBO_INSERTION_IMPLICIT_END_TAG;
 
-    // Step 16. Instead of appending nodes one-by-one, we swap the children
-    // vector of furthest_block with the empty children of new_formatting_node,
-    // reducing memory traffic and allocations. We still have to reset their
-    // parent pointers, though.
-    GumboVector temp = new_formatting_node->v.element.children;
-    new_formatting_node->v.element.children = furthest_block->v.element.children;
-    furthest_block->v.element.children = temp;
-
-    temp = new_formatting_node->v.element.children;
-    for (unsigned int i = 0; i < temp.length; ++i) {
-      GumboNode* child = temp.data[i];
-      child->parent = new_formatting_node;
-    }
+    // Step 16.
+    move_children(furthest_block, new_formatting_node);
 
     // Step 17.
     append_node(furthest_block, new_formatting_node);
@@ -2289,10 +2928,7 @@ static bool adoption_agency_algorithm (
     // If the formatting node was before the bookmark, it may shift over all
     // indices after it, so we need to explicitly find the index and possibly
     // adjust the bookmark.
-    int formatting_node_index = gumbo_vector_index_of (
-      &state->_active_formatting_elements,
-      formatting_node
-    );
+    int formatting_node_index = element_state(formatting_node)->formatting_index;
     assert(formatting_node_index != -1);
     if (formatting_node_index < bookmark) {
       gumbo_debug (
@@ -2301,31 +2937,19 @@ static bool adoption_agency_algorithm (
       );
       --bookmark;
     }
-    gumbo_vector_remove_at (
-      formatting_node_index,
-      &state->_active_formatting_elements
-    );
+    remove_formatting_element_at(state, formatting_node_index);
     assert(bookmark >= 0);
     assert((unsigned int) bookmark <= state->_active_formatting_elements.length);
-    gumbo_vector_insert_at (
-      new_formatting_node,
-      bookmark,
-      &state->_active_formatting_elements
-    );
+    insert_formatting_element_at(state, new_formatting_node, bookmark);
 
     // Step 19.
-    gumbo_vector_remove(formatting_node, &state->_open_elements);
-    int insert_at = 1 + gumbo_vector_index_of (
-      &state->_open_elements,
-      furthest_block
-    );
+    remove_open_element(state, formatting_node);
+    report_node(parser, formatting_node, true);
+    int insert_at = 1 + element_state(furthest_block)->open_index;
     assert(insert_at >= 0);
     assert((unsigned int) insert_at <= state->_open_elements.length);
-    gumbo_vector_insert_at (
-      new_formatting_node,
-      insert_at,
-      &state->_open_elements
-    );
+    insert_open_element_at(state, new_formatting_node, insert_at);
+    report_node(parser, new_formatting_node, false);
   }  // Step 20.
   return true;
 }
@@ -2653,9 +3277,9 @@ static bool handle_after_head(GumboParser* parser, GumboToken* token) {
     // This must be flushed before we push the head element on, as there may be
     // pending character tokens that should be attached to the root.
     maybe_flush_text_node_buffer(parser);
-    gumbo_vector_add(state->_head_element, &state->_open_elements);
+    push_open_element(state, state->_head_element);
     bool result = handle_in_head(parser, token);
-    gumbo_vector_remove(state->_head_element, &state->_open_elements);
+    remove_open_element(state, state->_head_element);
     return result;
   } else if (tag_is(token, kEndTag, GUMBO_TAG_TEMPLATE)) {
     return handle_in_head(parser, token);
@@ -2677,10 +3301,208 @@ static bool handle_after_head(GumboParser* parser, GumboToken* token) {
   }
 }
 
+// The "any other end tag" case of the in body insertion mode.
+static bool handle_any_other_end_tag(GumboParser* parser, GumboToken* token) {
+  GumboParserState* state = parser->_parser_state;
+  assert(token->type == GUMBO_TOKEN_END_TAG);
+  GumboTag end_tag = token->v.end_tag.tag;
+  const char *end_tagname = token->v.end_tag.name;
+  assert(state->_open_elements.length > 0);
+  assert(node_html_tag_is(state->_open_elements.data[0], GUMBO_TAG_HTML));
+  // Walk up the stack of open elements until we find one that either:
+  // a) Matches the tag name we saw
+  // b) Is in the "special" category.
+  // If we see a), implicitly close everything up to and including it. If we
+  // see b), then record a parse error, don't close anything (except the
+  // implied end tags) and ignore the end tag token.
+  for (int i = state->_open_elements.length; --i >= 0;) {
+    const GumboNode* node = state->_open_elements.data[i];
+    if (node_qualified_tagname_is(node, GUMBO_NAMESPACE_HTML, end_tag, end_tagname)) {
+      generate_implied_end_tags(parser, end_tag);
+      // TODO(jdtang): Do I need to add a parse error here?  The condition in
+      // the spec seems like it's the inverse of the loop condition above, and
+      // so would never fire.
+      // sfc: Yes, an error is needed here.
+      // <!DOCTYPE><body><sarcasm><foo></sarcasm> is an example.
+      // foo is the "current node" but sarcasm is node.
+      // XXX: Write a test for this.
+      if (node != get_current_node(parser))
+        parser_add_parse_error(parser, token);
+      while (node != pop_current_node(parser))
+        ;  // Pop everything.
+      return true;
+    } else if (is_special_node(node)) {
+      parser_add_parse_error(parser, token);
+      ignore_token(parser);
+      return false;
+    }
+  }
+  // <html> is in the special category, so we should never get here.
+  assert(0);
+  return false;
+}
+
+// What handle_in_body does with a start or end tag, looked up by tag so that
+// common tags skip the long chain of special cases. Tags not listed are
+// IN_BODY_SPECIAL, and go through the chain.
+typedef enum {
+  IN_BODY_SPECIAL,
+  // "Any other start tag" and "any other end tag".
+  IN_BODY_ORDINARY,
+  // Start tags that close a <p> element and are inserted ("address",
+  // "article", ...), and end tags that close the element if it's in scope.
+  IN_BODY_BLOCK,
+  // Start tags for formatting elements other than <a> and <nobr>, and end
+  // tags that run the adoption agency algorithm.
+  IN_BODY_FORMATTING,
+} InBodyTagAction;
+
+#define IN_BODY(tag, action) [GUMBO_TAG_##tag] = IN_BODY_##action
+
+static const uint8_t kInBodyStartTags[GUMBO_TAG_LAST + 1] = {
+  IN_BODY(ADDRESS, BLOCK), IN_BODY(ARTICLE, BLOCK), IN_BODY(ASIDE, BLOCK),
+  IN_BODY(BLOCKQUOTE, BLOCK), IN_BODY(CENTER, BLOCK), IN_BODY(DETAILS, BLOCK),
+  IN_BODY(DIALOG, BLOCK), IN_BODY(DIR, BLOCK), IN_BODY(DIV, BLOCK),
+  IN_BODY(DL, BLOCK), IN_BODY(FIELDSET, BLOCK), IN_BODY(FIGCAPTION, BLOCK),
+  IN_BODY(FIGURE, BLOCK), IN_BODY(FOOTER, BLOCK), IN_BODY(HEADER, BLOCK),
+  IN_BODY(HGROUP, BLOCK), IN_BODY(MENU, BLOCK), IN_BODY(MAIN, BLOCK),
+  IN_BODY(NAV, BLOCK), IN_BODY(OL, BLOCK), IN_BODY(P, BLOCK),
+  IN_BODY(SECTION, BLOCK), IN_BODY(SUMMARY, BLOCK), IN_BODY(UL, BLOCK),
+
+  IN_BODY(B, FORMATTING), IN_BODY(BIG, FORMATTING), IN_BODY(CODE, FORMATTING),
+  IN_BODY(EM, FORMATTING), IN_BODY(FONT, FORMATTING), IN_BODY(I, FORMATTING),
+  IN_BODY(S, FORMATTING), IN_BODY(SMALL, FORMATTING),
+  IN_BODY(STRIKE, FORMATTING), IN_BODY(STRONG, FORMATTING),
+  IN_BODY(TT, FORMATTING), IN_BODY(U, FORMATTING),
+
+  IN_BODY(ABBR, ORDINARY), IN_BODY(ACRONYM, ORDINARY),
+  IN_BODY(ANNOTATION_XML, ORDINARY), IN_BODY(AUDIO, ORDINARY),
+  IN_BODY(BDI, ORDINARY), IN_BODY(BDO, ORDINARY), IN_BODY(BLINK, ORDINARY),
+  IN_BODY(CANVAS, ORDINARY), IN_BODY(CITE, ORDINARY), IN_BODY(DATA, ORDINARY),
+  IN_BODY(DATALIST, ORDINARY), IN_BODY(DEL, ORDINARY), IN_BODY(DESC, ORDINARY),
+  IN_BODY(DFN, ORDINARY), IN_BODY(FOREIGNOBJECT, ORDINARY),
+  IN_BODY(INS, ORDINARY), IN_BODY(KBD, ORDINARY), IN_BODY(LABEL, ORDINARY),
+  IN_BODY(LEGEND, ORDINARY), IN_BODY(MALIGNMARK, ORDINARY),
+  IN_BODY(MAP, ORDINARY), IN_BODY(MARK, ORDINARY), IN_BODY(MENUITEM, ORDINARY),
+  IN_BODY(METER, ORDINARY), IN_BODY(MGLYPH, ORDINARY), IN_BODY(MI, ORDINARY),
+  IN_BODY(MN, ORDINARY), IN_BODY(MO, ORDINARY), IN_BODY(MS, ORDINARY),
+  IN_BODY(MTEXT, ORDINARY), IN_BODY(MULTICOL, ORDINARY),
+  IN_BODY(NEXTID, ORDINARY), IN_BODY(NOSCRIPT, ORDINARY),
+  IN_BODY(OUTPUT, ORDINARY), IN_BODY(PROGRESS, ORDINARY), IN_BODY(Q, ORDINARY),
+  IN_BODY(RUBY, ORDINARY), IN_BODY(SAMP, ORDINARY), IN_BODY(SPACER, ORDINARY),
+  IN_BODY(SPAN, ORDINARY), IN_BODY(SUB, ORDINARY), IN_BODY(SUP, ORDINARY),
+  IN_BODY(TIME, ORDINARY), IN_BODY(UNKNOWN, ORDINARY), IN_BODY(VAR, ORDINARY),
+  IN_BODY(VIDEO, ORDINARY),
+};
+
+static const uint8_t kInBodyEndTags[GUMBO_TAG_LAST + 1] = {
+  IN_BODY(ADDRESS, BLOCK), IN_BODY(ARTICLE, BLOCK), IN_BODY(ASIDE, BLOCK),
+  IN_BODY(BLOCKQUOTE, BLOCK), IN_BODY(BUTTON, BLOCK), IN_BODY(CENTER, BLOCK),
+  IN_BODY(DETAILS, BLOCK), IN_BODY(DIALOG, BLOCK), IN_BODY(DIR, BLOCK),
+  IN_BODY(DIV, BLOCK), IN_BODY(DL, BLOCK), IN_BODY(FIELDSET, BLOCK),
+  IN_BODY(FIGCAPTION, BLOCK), IN_BODY(FIGURE, BLOCK), IN_BODY(FOOTER, BLOCK),
+  IN_BODY(HEADER, BLOCK), IN_BODY(HGROUP, BLOCK), IN_BODY(LISTING, BLOCK),
+  IN_BODY(MAIN, BLOCK), IN_BODY(MENU, BLOCK), IN_BODY(NAV, BLOCK),
+  IN_BODY(OL, BLOCK), IN_BODY(PRE, BLOCK), IN_BODY(SECTION, BLOCK),
+  IN_BODY(SUMMARY, BLOCK), IN_BODY(UL, BLOCK),
+
+  IN_BODY(A, FORMATTING), IN_BODY(B, FORMATTING), IN_BODY(BIG, FORMATTING),
+  IN_BODY(CODE, FORMATTING), IN_BODY(EM, FORMATTING), IN_BODY(FONT, FORMATTING),
+  IN_BODY(I, FORMATTING), IN_BODY(NOBR, FORMATTING), IN_BODY(S, FORMATTING),
+  IN_BODY(SMALL, FORMATTING), IN_BODY(STRIKE, FORMATTING),
+  IN_BODY(STRONG, FORMATTING), IN_BODY(TT, FORMATTING), IN_BODY(U, FORMATTING),
+
+  IN_BODY(ABBR, ORDINARY), IN_BODY(ACRONYM, ORDINARY),
+  IN_BODY(ANNOTATION_XML, ORDINARY), IN_BODY(AREA, ORDINARY),
+  IN_BODY(AUDIO, ORDINARY), IN_BODY(BASE, ORDINARY),
+  IN_BODY(BASEFONT, ORDINARY), IN_BODY(BDI, ORDINARY), IN_BODY(BDO, ORDINARY),
+  IN_BODY(BGSOUND, ORDINARY), IN_BODY(BLINK, ORDINARY),
+  IN_BODY(CANVAS, ORDINARY), IN_BODY(CAPTION, ORDINARY),
+  IN_BODY(CITE, ORDINARY), IN_BODY(COL, ORDINARY), IN_BODY(COLGROUP, ORDINARY),
+  IN_BODY(DATA, ORDINARY), IN_BODY(DATALIST, ORDINARY), IN_BODY(DEL, ORDINARY),
+  IN_BODY(DESC, ORDINARY), IN_BODY(DFN, ORDINARY), IN_BODY(EMBED, ORDINARY),
+  IN_BODY(FOREIGNOBJECT, ORDINARY), IN_BODY(FRAME, ORDINARY),
+  IN_BODY(FRAMESET, ORDINARY), IN_BODY(HEAD, ORDINARY), IN_BODY(HR, ORDINARY),
+  IN_BODY(IFRAME, ORDINARY), IN_BODY(IMAGE, ORDINARY), IN_BODY(IMG, ORDINARY),
+  IN_BODY(INPUT, ORDINARY), IN_BODY(INS, ORDINARY), IN_BODY(KBD, ORDINARY),
+  IN_BODY(KEYGEN, ORDINARY), IN_BODY(LABEL, ORDINARY),
+  IN_BODY(LEGEND, ORDINARY), IN_BODY(LINK, ORDINARY),
+  IN_BODY(MALIGNMARK, ORDINARY), IN_BODY(MAP, ORDINARY),
+  IN_BODY(MARK, ORDINARY), IN_BODY(MATH, ORDINARY), IN_BODY(MENUITEM, ORDINARY),
+  IN_BODY(META, ORDINARY), IN_BODY(METER, ORDINARY), IN_BODY(MGLYPH, ORDINARY),
+  IN_BODY(MI, ORDINARY), IN_BODY(MN, ORDINARY), IN_BODY(MO, ORDINARY),
+  IN_BODY(MS, ORDINARY), IN_BODY(MTEXT, ORDINARY), IN_BODY(MULTICOL, ORDINARY),
+  IN_BODY(NEXTID, ORDINARY), IN_BODY(NOEMBED, ORDINARY),
+  IN_BODY(NOFRAMES, ORDINARY), IN_BODY(NOSCRIPT, ORDINARY),
+  IN_BODY(OPTGROUP, ORDINARY), IN_BODY(OPTION, ORDINARY),
+  IN_BODY(OUTPUT, ORDINARY), IN_BODY(PARAM, ORDINARY),
+  IN_BODY(PLAINTEXT, ORDINARY), IN_BODY(PROGRESS, ORDINARY),
+  IN_BODY(Q, ORDINARY), IN_BODY(RB, ORDINARY), IN_BODY(RP, ORDINARY),
+  IN_BODY(RT, ORDINARY), IN_BODY(RTC, ORDINARY), IN_BODY(RUBY, ORDINARY),
+  IN_BODY(SAMP, ORDINARY), IN_BODY(SCRIPT, ORDINARY), IN_BODY(SELECT, ORDINARY),
+  IN_BODY(SOURCE, ORDINARY), IN_BODY(SPACER, ORDINARY), IN_BODY(SPAN, ORDINARY),
+  IN_BODY(STYLE, ORDINARY), IN_BODY(SUB, ORDINARY), IN_BODY(SUP, ORDINARY),
+  IN_BODY(SVG, ORDINARY), IN_BODY(TABLE, ORDINARY), IN_BODY(TBODY, ORDINARY),
+  IN_BODY(TD, ORDINARY), IN_BODY(TEXTAREA, ORDINARY), IN_BODY(TFOOT, ORDINARY),
+  IN_BODY(TH, ORDINARY), IN_BODY(THEAD, ORDINARY), IN_BODY(TIME, ORDINARY),
+  IN_BODY(TITLE, ORDINARY), IN_BODY(TR, ORDINARY), IN_BODY(TRACK, ORDINARY),
+  IN_BODY(UNKNOWN, ORDINARY), IN_BODY(VAR, ORDINARY), IN_BODY(VIDEO, ORDINARY),
+  IN_BODY(WBR, ORDINARY), IN_BODY(XMP, ORDINARY),
+};
+
+#undef IN_BODY
+
+static InBodyTagAction in_body_tag_action(const GumboToken* token) {
+  if (token->type == GUMBO_TOKEN_START_TAG) {
+    return kInBodyStartTags[token->v.start_tag.tag];
+  } else if (token->type == GUMBO_TOKEN_END_TAG) {
+    return kInBodyEndTags[token->v.end_tag.tag];
+  }
+  return IN_BODY_SPECIAL;
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-main-inbody
 static bool handle_in_body(GumboParser* parser, GumboToken* token) {
   GumboParserState* state = parser->_parser_state;
   assert(state->_open_elements.length > 0);
+  bool is_start_tag = token->type == GUMBO_TOKEN_START_TAG;
+  switch (in_body_tag_action(token)) {
+    case IN_BODY_ORDINARY:
+      if (!is_start_tag) {
+        return handle_any_other_end_tag(parser, token);
+      }
+      reconstruct_active_formatting_elements(parser);
+      insert_element_from_token(parser, token);
+      return true;
+    case IN_BODY_BLOCK:
+      if (is_start_tag) {
+        bool result = maybe_implicitly_close_p_tag(parser, token);
+        insert_element_from_token(parser, token);
+        return result;
+      }
+      if (!has_an_element_in_scope(parser, token->v.end_tag.tag)) {
+        parser_add_parse_error(parser, token);
+        ignore_token(parser);
+        return false;
+      }
+      implicitly_close_tags (
+        parser,
+        token,
+        GUMBO_NAMESPACE_HTML,
+        token->v.end_tag.tag
+      );
+      return true;
+    case IN_BODY_FORMATTING:
+      if (!is_start_tag) {
+        return adoption_agency_algorithm(parser, token, token->v.end_tag.tag);
+      }
+      reconstruct_active_formatting_elements(parser);
+      add_formatting_element(parser, insert_element_from_token(parser, token));
+      return true;
+    case IN_BODY_SPECIAL:
+      break;
+  }
+
   if (token->type == GUMBO_TOKEN_NULL) {
     parser_add_parse_error(parser, token);
     ignore_token(parser);
@@ -2712,7 +3534,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
     }
     assert(parser->_output->root != NULL);
     assert(parser->_output->root->type == GUMBO_NODE_ELEMENT);
-    merge_attributes(token, parser->_output->root);
+    merge_attributes(parser, token, parser->_output->root);
     return false;
   } else if (
     tag_in(token, kStartTag, &(const TagSet) {
@@ -2734,7 +3556,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
       return false;
     }
     state->_frameset_ok = false;
-    merge_attributes(token, state->_open_elements.data[1]);
+    merge_attributes(parser, token, state->_open_elements.data[1]);
     return false;
   } else if (tag_is(token, kStartTag, GUMBO_TAG_FRAMESET)) {
     parser_add_parse_error(parser, token);
@@ -2761,6 +3583,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
     // elements is reconstructed afterwards. This may happen if whitespace
     // follows the </frameset>.
     clear_active_formatting_elements(parser);
+    forget_closed_nodes(parser, body_node);
 
     // Remove the body node. We may want to factor this out into a generic
     // helper, but right now this is the only code that needs to do this.
@@ -2822,18 +3645,6 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
       record_end_of_element(state->_current_token, &body->v.element);
     }
     return success;
-  } else if (
-    tag_in(token, kStartTag, &(const TagSet) {
-      TAG(ADDRESS), TAG(ARTICLE), TAG(ASIDE), TAG(BLOCKQUOTE), TAG(CENTER),
-      TAG(DETAILS), TAG(DIALOG), TAG(DIR), TAG(DIV), TAG(DL), TAG(FIELDSET),
-      TAG(FIGCAPTION), TAG(FIGURE), TAG(FOOTER), TAG(HEADER), TAG(HGROUP),
-      TAG(MENU), TAG(MAIN), TAG(NAV), TAG(OL), TAG(P), TAG(SECTION),
-      TAG(SUMMARY), TAG(UL)
-    })
-  ) {
-    bool result = maybe_implicitly_close_p_tag(parser, token);
-    insert_element_from_token(parser, token);
-    return result;
   } else if (tag_in(token, kStartTag, &heading_tags)) {
     bool result = maybe_implicitly_close_p_tag(parser, token);
     if (node_tag_in_set(get_current_node(parser), &heading_tags)) {
@@ -2896,28 +3707,6 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
     insert_element_from_token(parser, token);
     state->_frameset_ok = false;
     return true;
-  } else if (
-    tag_in(token, kEndTag, &(const TagSet) {
-      TAG(ADDRESS), TAG(ARTICLE), TAG(ASIDE), TAG(BLOCKQUOTE), TAG(BUTTON),
-      TAG(CENTER), TAG(DETAILS), TAG(DIALOG), TAG(DIR), TAG(DIV), TAG(DL),
-      TAG(FIELDSET), TAG(FIGCAPTION), TAG(FIGURE), TAG(FOOTER), TAG(HEADER),
-      TAG(HGROUP), TAG(LISTING), TAG(MAIN), TAG(MENU), TAG(NAV), TAG(OL),
-      TAG(PRE), TAG(SECTION), TAG(SUMMARY), TAG(UL)
-    })
-  ) {
-    GumboTag tag = token->v.end_tag.tag;
-    if (!has_an_element_in_scope(parser, tag)) {
-      parser_add_parse_error(parser, token);
-      ignore_token(parser);
-      return false;
-    }
-    implicitly_close_tags (
-      parser,
-      token,
-      GUMBO_NAMESPACE_HTML,
-      token->v.end_tag.tag
-    );
-    return true;
   } else if (tag_is(token, kEndTag, GUMBO_TAG_FORM)) {
     if (has_open_element(parser, GUMBO_TAG_TEMPLATE)) {
       if (!has_an_element_in_scope(parser, GUMBO_TAG_FORM)) {
@@ -2955,10 +3744,8 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
         record_end_of_element(token, &node->v.element);
       }
 
-      GumboVector* open_elements = &state->_open_elements;
-      int index = gumbo_vector_index_of(open_elements, node);
-      assert(index >= 0);
-      gumbo_vector_remove_at(index, open_elements);
+      remove_open_element(state, node);
+      report_node(parser, node, true);
       return result;
     }
   } else if (tag_is(token, kEndTag, GUMBO_TAG_P)) {
@@ -3045,26 +3832,19 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
       // we're supposed to do this. (The conditions where it might not are
       // listed in the spec.)
       if (find_last_anchor_index(parser, &last_a)) {
-        void* last_element = gumbo_vector_remove_at (
-          last_a,
-          &state->_active_formatting_elements
-        );
-        gumbo_vector_remove(last_element, &state->_open_elements);
+        GumboNode* last_element = remove_formatting_element_at(state, last_a);
+        if (is_open_element(last_element)) {
+          remove_open_element(state, last_element);
+          report_node(parser, last_element, true);
+        } else {
+          add_closed_node(parser, last_element);
+        }
       }
       success = false;
     }
     reconstruct_active_formatting_elements(parser);
     add_formatting_element(parser, insert_element_from_token(parser, token));
     return success;
-  } else if (
-    tag_in(token, kStartTag, &(const TagSet) {
-      TAG(B), TAG(BIG), TAG(CODE), TAG(EM), TAG(FONT), TAG(I), TAG(S),
-      TAG(SMALL), TAG(STRIKE), TAG(STRONG), TAG(TT), TAG(U)
-    })
-  ) {
-    reconstruct_active_formatting_elements(parser);
-    add_formatting_element(parser, insert_element_from_token(parser, token));
-    return true;
   } else if (tag_is(token, kStartTag, GUMBO_TAG_NOBR)) {
     bool result = true;
     reconstruct_active_formatting_elements(parser);
@@ -3077,14 +3857,6 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
     insert_element_from_token(parser, token);
     add_formatting_element(parser, get_current_node(parser));
     return result;
-  } else if (
-    tag_in(token, kEndTag, &(const TagSet) {
-      TAG(A), TAG(B), TAG(BIG), TAG(CODE), TAG(EM), TAG(FONT), TAG(I),
-      TAG(NOBR), TAG(S), TAG(SMALL), TAG(STRIKE), TAG(STRONG), TAG(TT),
-      TAG(U)
-    })
-  ) {
-    return adoption_agency_algorithm(parser, token, token->v.end_tag.tag);
   } else if (
     tag_in(token, kStartTag, &(const TagSet){TAG(APPLET), TAG(MARQUEE), TAG(OBJECT)})
   ) {
@@ -3244,8 +4016,8 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
     return false;
   } else if (tag_is(token, kStartTag, GUMBO_TAG_MATH)) {
     reconstruct_active_formatting_elements(parser);
-    adjust_mathml_attributes(token);
-    adjust_foreign_attributes(token);
+    adjust_mathml_attributes(parser, token);
+    adjust_foreign_attributes(parser, token);
     insert_foreign_element(parser, token, GUMBO_NAMESPACE_MATHML);
     if (token->v.start_tag.is_self_closing) {
       pop_current_node(parser);
@@ -3254,8 +4026,8 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
     return true;
   } else if (tag_is(token, kStartTag, GUMBO_TAG_SVG)) {
     reconstruct_active_formatting_elements(parser);
-    adjust_svg_attributes(token);
-    adjust_foreign_attributes(token);
+    adjust_svg_attributes(parser, token);
+    adjust_foreign_attributes(parser, token);
     insert_foreign_element(parser, token, GUMBO_NAMESPACE_SVG);
     if (token->v.start_tag.is_self_closing) {
       pop_current_node(parser);
@@ -3276,42 +4048,7 @@ static bool handle_in_body(GumboParser* parser, GumboToken* token) {
     insert_element_from_token(parser, token);
     return true;
   } else {
-    assert(token->type == GUMBO_TOKEN_END_TAG);
-    GumboTag end_tag = token->v.end_tag.tag;
-    const char *end_tagname = token->v.end_tag.name;
-    assert(state->_open_elements.length > 0);
-    assert(node_html_tag_is(state->_open_elements.data[0], GUMBO_TAG_HTML));
-    // Walk up the stack of open elements until we find one that either:
-    // a) Matches the tag name we saw
-    // b) Is in the "special" category.
-    // If we see a), implicitly close everything up to and including it. If we
-    // see b), then record a parse error, don't close anything (except the
-    // implied end tags) and ignore the end tag token.
-    for (int i = state->_open_elements.length; --i >= 0;) {
-      const GumboNode* node = state->_open_elements.data[i];
-      if (node_qualified_tagname_is(node, GUMBO_NAMESPACE_HTML, end_tag, end_tagname)) {
-        generate_implied_end_tags(parser, end_tag);
-        // TODO(jdtang): Do I need to add a parse error here?  The condition in
-        // the spec seems like it's the inverse of the loop condition above, and
-        // so would never fire.
-	// sfc: Yes, an error is needed here.
-	// <!DOCTYPE><body><sarcasm><foo></sarcasm> is an example.
-        // foo is the "current node" but sarcasm is node.
-        // XXX: Write a test for this.
-        if (node != get_current_node(parser))
-          parser_add_parse_error(parser, token);
-        while (node != pop_current_node(parser))
-          ;  // Pop everything.
-        return true;
-      } else if (is_special_node(node)) {
-        parser_add_parse_error(parser, token);
-        ignore_token(parser);
-        return false;
-      }
-    }
-    // <html> is in the special category, so we should never get here.
-    assert(0);
-    return false;
+    return handle_any_other_end_tag(parser, token);
   }
 }
 
@@ -4283,13 +5020,13 @@ static bool handle_in_foreign_content(GumboParser* parser, GumboToken* token) {
     const GumboNamespaceEnum current_namespace =
         get_adjusted_current_node(parser)->v.element.tag_namespace;
     if (current_namespace == GUMBO_NAMESPACE_MATHML) {
-      adjust_mathml_attributes(token);
+      adjust_mathml_attributes(parser, token);
     }
     if (current_namespace == GUMBO_NAMESPACE_SVG) {
-      adjust_svg_tag(token);
-      adjust_svg_attributes(token);
+      adjust_svg_tag(parser, token);
+      adjust_svg_attributes(parser, token);
     }
-    adjust_foreign_attributes(token);
+    adjust_foreign_attributes(parser, token);
     insert_foreign_element(parser, token, current_namespace);
     if (token->v.start_tag.is_self_closing) {
       pop_current_node(parser);
@@ -4342,6 +5079,40 @@ static bool handle_in_foreign_content(GumboParser* parser, GumboToken* token) {
   }
 }
 
+// Returns true if the next character token may be a run of several characters
+// (see GumboToken.is_character_run). That's only allowed in the insertion
+// modes below, which insert character and whitespace tokens into the text node
+// buffer (possibly via handle_in_body or handle_in_table) without ever
+// treating two characters differently, so that a run has exactly the same
+// effect as the sequence of characters it stands for. Tokens reprocessed in
+// another insertion mode stay within this set.
+static bool accepts_character_runs(const GumboParser* parser) {
+  const GumboParserState* state = parser->_parser_state;
+  if (state->_ignore_next_linefeed) {
+    return false;
+  }
+  const GumboNode* node = get_adjusted_current_node(parser);
+  if (!node || node->v.element.tag_namespace != GUMBO_NAMESPACE_HTML) {
+    return false;
+  }
+  switch (state->_insertion_mode) {
+    case GUMBO_INSERTION_MODE_IN_BODY:
+    case GUMBO_INSERTION_MODE_TEXT:
+    case GUMBO_INSERTION_MODE_IN_TABLE:
+    case GUMBO_INSERTION_MODE_IN_TABLE_TEXT:
+    case GUMBO_INSERTION_MODE_IN_CAPTION:
+    case GUMBO_INSERTION_MODE_IN_TABLE_BODY:
+    case GUMBO_INSERTION_MODE_IN_ROW:
+    case GUMBO_INSERTION_MODE_IN_CELL:
+    case GUMBO_INSERTION_MODE_IN_SELECT:
+    case GUMBO_INSERTION_MODE_IN_SELECT_IN_TABLE:
+    case GUMBO_INSERTION_MODE_IN_TEMPLATE:
+      return true;
+    default:
+      return false;
+  }
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#tree-construction
 static bool handle_token(GumboParser* parser, GumboToken* token) {
   if (
@@ -4472,65 +5243,126 @@ GumboOutput* gumbo_parse(const char* buffer) {
   );
 }
 
-GumboOutput* gumbo_parse_with_options (
-  const GumboOptions* options,
+// Sets up the output, tokenizer and parser state for a new parse of `buffer`.
+// Parsers created with gumbo_parser_new already have tokenizer and parser
+// state, which is reused; otherwise it's created here, in the output's arena.
+static void start_parse (
+  GumboParser* parser,
   const char* buffer,
   size_t length
 ) {
-  GumboParser parser;
-  parser._options = options;
-  output_init(&parser);
-  gumbo_tokenizer_state_init(&parser, buffer, length);
-  parser_state_init(&parser);
+  const GumboOptions* options = parser->_options;
+  if (options->stats) {
+    memset(options->stats, 0, sizeof(GumboParseStats));
+  }
+  output_init(parser);
+  if (parser->_tokenizer_state) {
+    gumbo_tokenizer_state_reset(parser, buffer, length);
+    parser_state_reset(parser);
+  } else {
+    gumbo_tokenizer_state_init(parser, buffer, length);
+    parser_state_init(parser);
+  }
+  parser->_done = false;
 
   if (options->fragment_context != GUMBO_TAG_LAST) {
     fragment_parser_init (
-      &parser,
+      parser,
       options->fragment_context,
       options->fragment_namespace
     );
   }
+}
 
-  GumboParserState* state = parser._parser_state;
-  gumbo_debug (
-    "Parsing %.*s.\n",
-    (int) length,
-    buffer
-  );
+static void count_token(GumboParseStats* stats, const GumboToken* token) {
+  switch (token->type) {
+    case GUMBO_TOKEN_DOCTYPE:
+      ++stats->tokens.doctype;
+      break;
+    case GUMBO_TOKEN_START_TAG:
+      ++stats->tokens.start_tag;
+      break;
+    case GUMBO_TOKEN_END_TAG:
+      ++stats->tokens.end_tag;
+      break;
+    case GUMBO_TOKEN_COMMENT:
+      ++stats->tokens.comment;
+      break;
+    case GUMBO_TOKEN_WHITESPACE:
+      ++stats->tokens.whitespace;
+      break;
+    case GUMBO_TOKEN_CHARACTER:
+      ++stats->tokens.character;
+      break;
+    case GUMBO_TOKEN_CDATA:
+      ++stats->tokens.cdata;
+      break;
+    case GUMBO_TOKEN_NULL:
+      ++stats->tokens.null;
+      break;
+    case GUMBO_TOKEN_EOF:
+      ++stats->tokens.eof;
+      break;
+  }
+}
+
+// Runs tree construction until the end of the input, or until the tokenizer
+// runs out of partial input (see gumbo_parser_feed).
+static void run_parser(GumboParser* parser) {
+  GumboParserState* state = parser->_parser_state;
+  GumboToken* token = &state->_token;
+  GumboParseStats* stats = parser->_options->stats;
+  double start_time = 0;
 
   // Sanity check so that infinite loops die with an assertion failure instead
   // of hanging the process before we ever get an error.
   uint_fast32_t loop_count = 0;
 
-  GumboToken token;
-  bool has_error = false;
-
   do {
     if (state->_reprocess_current_token) {
       state->_reprocess_current_token = false;
     } else {
-      GumboNode* current_node = get_current_node(&parser);
+      GumboNode* current_node = get_current_node(parser);
       gumbo_tokenizer_set_is_current_node_foreign (
-        &parser,
+        parser,
         current_node &&
           current_node->v.element.tag_namespace != GUMBO_NAMESPACE_HTML
       );
-      has_error = !gumbo_lex(&parser, &token) || has_error;
+      gumbo_tokenizer_set_emit_character_runs (
+        parser,
+        accepts_character_runs(parser)
+      );
+      if (unlikely(stats)) {
+        start_time = gumbo_monotonic_seconds();
+      }
+      bool lexed = state->_speculation
+        ? gumbo_speculation_lex(state->_speculation, parser, token)
+        : gumbo_lex(parser, token);
+      if (unlikely(stats)) {
+        stats->tokenizer_seconds += gumbo_monotonic_seconds() - start_time;
+      }
+      if (gumbo_tokenizer_needs_input(parser)) {
+        return;
+      }
+      state->_has_error = !lexed || state->_has_error;
+      if (unlikely(stats)) {
+        count_token(stats, token);
+      }
     }
 
     const char* token_type = "text";
-    switch (token.type) {
+    switch (token->type) {
       case GUMBO_TOKEN_DOCTYPE:
         token_type = "doctype";
         break;
       case GUMBO_TOKEN_START_TAG:
-        if (token.v.start_tag.tag == GUMBO_TAG_UNKNOWN)
-          token_type = token.v.start_tag.name;
+        if (token->v.start_tag.tag == GUMBO_TAG_UNKNOWN)
+          token_type = token->v.start_tag.name;
         else
-          token_type = gumbo_normalized_tagname(token.v.start_tag.tag);
+          token_type = gumbo_normalized_tagname(token->v.start_tag.tag);
         break;
       case GUMBO_TOKEN_END_TAG:
-        token_type = gumbo_normalized_tagname(token.v.end_tag.tag);
+        token_type = gumbo_normalized_tagname(token->v.end_tag.tag);
         break;
       case GUMBO_TOKEN_COMMENT:
         token_type = "comment";
@@ -4539,45 +5371,55 @@ GumboOutput* gumbo_parse_with_options (
         break;
     }
     gumbo_debug (
-      "Handling %s token @%zu:%zu in state %u.\n",
+      "Handling %s token @%u:%u in state %u.\n",
       (char*) token_type,
-      token.position.line,
-      token.position.column,
+      token->position.line,
+      token->position.column,
       state->_insertion_mode
     );
 
-    state->_current_token = &token;
+    state->_current_token = token;
     state->_self_closing_flag_acknowledged = false;
 
-    has_error = !handle_token(&parser, &token) || has_error;
+    GumboInsertionMode mode = state->_insertion_mode;
+    if (unlikely(stats)) {
+      start_time = gumbo_monotonic_seconds();
+    }
+    state->_has_error = !handle_token(parser, token) || state->_has_error;
+    release_closed_nodes(parser);
+    if (unlikely(stats)) {
+      double seconds = gumbo_monotonic_seconds() - start_time;
+      stats->tree_construction_seconds += seconds;
+      stats->insertion_mode_seconds[mode] += seconds;
+    }
 
     // Check for memory leaks when ownership is transferred from start tag
     // tokens to nodes.
     assert (
       state->_reprocess_current_token
-      || token.type != GUMBO_TOKEN_START_TAG
-      || (token.v.start_tag.attributes.data == NULL
-          && token.v.start_tag.name == NULL)
+      || token->type != GUMBO_TOKEN_START_TAG
+      || (token->v.start_tag.attributes.data == NULL
+          && token->v.start_tag.name == NULL)
     );
 
     if (!state->_reprocess_current_token) {
-      if (token.type == GUMBO_TOKEN_START_TAG &&
-          token.v.start_tag.is_self_closing &&
+      if (token->type == GUMBO_TOKEN_START_TAG &&
+          token->v.start_tag.is_self_closing &&
           !state->_self_closing_flag_acknowledged) {
-        GumboError* error = parser_add_parse_error(&parser, &token);
+        GumboError* error = parser_add_parse_error(parser, token);
         if (error)
           error->type = GUMBO_ERR_UNACKNOWLEDGED_SELF_CLOSING_TAG;
       }
-      if (token.type == GUMBO_TOKEN_END_TAG &&
-          token.v.end_tag.is_self_closing) {
-        GumboError* error = parser_add_parse_error(&parser, &token);
+      if (token->type == GUMBO_TOKEN_END_TAG &&
+          token->v.end_tag.is_self_closing) {
+        GumboError* error = parser_add_parse_error(parser, token);
         if (error)
           error->type = GUMBO_ERR_SELF_CLOSING_END_TAG;
       }
     }
 
-    if (unlikely(parser._parser_state->_open_elements.length > 400)) {
-      parser._output->status = GUMBO_STATUS_TREE_TOO_DEEP;
+    if (unlikely(state->_open_elements.length > 400)) {
+      parser->_output->status = GUMBO_STATUS_TREE_TOO_DEEP;
       gumbo_debug("Tree depth limit exceeded.\n");
       break;
     }
@@ -4586,14 +5428,41 @@ GumboOutput* gumbo_parse_with_options (
     assert(loop_count < 1000000000UL);
 
   } while (
-    (token.type != GUMBO_TOKEN_EOF || state->_reprocess_current_token)
-    && !(options->stop_on_first_error && has_error)
+    (token->type != GUMBO_TOKEN_EOF || state->_reprocess_current_token)
+    && !(parser->_options->stop_on_first_error && state->_has_error)
   );
 
-  finish_parsing(&parser);
+  parser->_done = true;
+}
+
+// Completes the tree. The tokenizer and parser state are left for the caller
+// to release or reuse.
+static void end_parse(GumboParser* parser) {
+  finish_parsing(parser);
+  release_closed_nodes(parser);
+  GumboParserState* parser_state = parser->_parser_state;
+  if (parser_state->_fragment_ctx) {
+    destroy_node(parser_state->_fragment_ctx);
+    parser_state->_fragment_ctx = NULL;
+  }
+  GumboNode* root = parser->_output->root;
+  if (parser->_options->callbacks && root) {
+    // Everything has been reported, and the parser no longer needs any of it,
+    // so the tree is cut back to its root.
+    GumboParserState* state = parser->_parser_state;
+    while (pop_formatting_element(state)) {
+    }
+    state->_head_element = NULL;
+    state->_form_element = NULL;
+    GumboVector* children = &root->v.element.children;
+    for (unsigned int i = 0; i < children->length; ++i) {
+      gumbo_vector_add(children->data[i], &state->_closed_nodes);
+    }
+    release_closed_nodes(parser);
+  }
   // For API uniformity reasons, if the doctype still has nulls, convert them to
   // empty strings.
-  GumboDocument* doc_type = &parser._output->document->v.document;
+  GumboDocument* doc_type = &parser->_output->document->v.document;
   if (doc_type->name == NULL) {
     doc_type->name = gumbo_strdup("");
   }
@@ -4603,10 +5472,255 @@ GumboOutput* gumbo_parse_with_options (
   if (doc_type->system_identifier == NULL) {
     doc_type->system_identifier = gumbo_strdup("");
   }
+}
+
+// Parses the whole of `buffer`. This leaves the output's arena, if any, as the
+// current one.
+static GumboOutput* parse_buffer (
+  GumboParser* parser,
+  const char* buffer,
+  size_t length
+) {
+  const GumboOptions* options = parser->_options;
+  GumboParseStats* previous_stats = gumbo_set_allocation_stats(options->stats);
+  start_parse(parser, buffer, length);
+  gumbo_debug (
+    "Parsing %.*s.\n",
+    (int) length,
+    buffer
+  );
+  GumboParserState* state = parser->_parser_state;
+  if (options->tokenizer_threads > 1) {
+    state->_speculation = gumbo_speculation_new(parser, buffer, length);
+  }
+  run_parser(parser);
+  if (state->_speculation) {
+    gumbo_speculation_destroy(state->_speculation);
+    state->_speculation = NULL;
+  }
+  end_parse(parser);
+
+  GumboOutput* output = parser->_output;
+  if (options->lazy_positions) {
+    output->line_index =
+      gumbo_line_index_new(buffer, length, options->tab_stop);
+    for (unsigned int i = 0; i < output->errors.length; ++i) {
+      GumboError* error = output->errors.data[i];
+      gumbo_line_index_resolve(output->line_index, &error->position);
+    }
+  }
+  gumbo_set_allocation_stats(previous_stats);
+  return output;
+}
 
+GumboOutput* gumbo_parse_with_options (
+  const GumboOptions* options,
+  const char* buffer,
+  size_t length
+) {
+  GumboParser parser;
+  parser._options = options;
+  parser._tokenizer_state = NULL;
+  parser._parser_state = NULL;
+  GumboArena* previous_arena = gumbo_set_arena(NULL);
+  GumboOutput* output = parse_buffer(&parser, buffer, length);
   parser_state_destroy(&parser);
   gumbo_tokenizer_state_destroy(&parser);
-  return parser._output;
+  gumbo_set_arena(previous_arena);
+  return output;
+}
+
+// A copy of (part of) the input made by gumbo_parser_feed. The tree points
+// into these, so they belong to the output. The newest one comes first, and is
+// the one the tokenizer is reading from.
+typedef struct GumboInternalInputBuffer {
+  struct GumboInternalInputBuffer* next;
+  size_t capacity;
+  size_t length;
+  char data[];
+} InputBuffer;
+
+static const size_t kMinInputBufferSize = 4096;
+
+static InputBuffer* new_input_buffer(size_t capacity) {
+  // Input buffers can outlive the arena being used when they're created, if
+  // a later parse installs a different one, so they always come from malloc.
+  GumboArena* arena = gumbo_set_arena(NULL);
+  InputBuffer* buffer = gumbo_alloc(sizeof(InputBuffer) + capacity);
+  gumbo_set_arena(arena);
+  buffer->next = NULL;
+  buffer->capacity = capacity;
+  buffer->length = 0;
+  return buffer;
+}
+
+// Adds a chunk to the end of the input. If it doesn't fit in the current
+// buffer, the part of the input that the tokenizer and the pending text node
+// still need is carried over to a new, larger one. Everything before that
+// stays where it is, since the tree points into it.
+static void append_input (
+  GumboParser* parser,
+  const char* chunk,
+  size_t length,
+  bool is_partial
+) {
+  GumboOutput* output = parser->_output;
+  InputBuffer* buffer = output->input_buffers;
+  const char* from = buffer->data;
+  const char* to = buffer->data;
+  if (buffer->capacity - buffer->length < length) {
+    TextNodeBufferState* text_node = &parser->_parser_state->_text_node;
+    const char* keep = gumbo_tokenizer_get_input_floor(parser);
+    if (
+      text_node->_buffer.length > 0
+      && text_node->_start_original_text < keep
+    ) {
+      keep = text_node->_start_original_text;
+    }
+    size_t carry = buffer->data + buffer->length - keep;
+    size_t capacity = 2 * (carry + length);
+    if (capacity < kMinInputBufferSize) {
+      capacity = kMinInputBufferSize;
+    }
+    InputBuffer* next = new_input_buffer(capacity);
+    memcpy(next->data, keep, carry);
+    next->length = carry;
+    next->next = buffer;
+    output->input_buffers = next;
+    if (text_node->_buffer.length > 0) {
+      text_node->_start_original_text =
+        next->data + (text_node->_start_original_text - keep);
+    }
+    from = keep;
+    to = next->data;
+    buffer = next;
+  }
+  if (length > 0) {
+    memcpy(buffer->data + buffer->length, chunk, length);
+    buffer->length += length;
+  }
+  gumbo_tokenizer_move_input (
+    parser,
+    from,
+    to,
+    buffer->data + buffer->length,
+    is_partial
+  );
+}
+
+// Starts an incremental parse. There must be no current arena.
+static void start_stream(GumboParser* parser) {
+  // There's no contiguous copy of the input to index.
+  parser->_options_copy.lazy_positions = false;
+  GumboParseStats* previous_stats =
+    gumbo_set_allocation_stats(parser->_options->stats);
+  InputBuffer* buffer = new_input_buffer(kMinInputBufferSize);
+  start_parse(parser, buffer->data, 0);
+  parser->_output->input_buffers = buffer;
+  append_input(parser, NULL, 0, true);
+  gumbo_set_allocation_stats(previous_stats);
+}
+
+// Releases the document being parsed incrementally, if there is one.
+static void discard_stream(GumboParser* parser) {
+  if (parser->_output) {
+    // Finishing the parse is the simplest way to release everything that the
+    // tokenizer and tree construction are holding on to.
+    gumbo_destroy_output(gumbo_parser_finish(parser));
+  }
+}
+
+GumboParser* gumbo_parser_new(const GumboOptions* options) {
+  GumboArena* previous_arena = gumbo_set_arena(NULL);
+  GumboParser* parser = gumbo_alloc(sizeof(GumboParser));
+  parser->_options_copy = *options;
+  parser->_lazy_positions = options->lazy_positions;
+  parser->_options = &parser->_options_copy;
+  // The tokenizer and parser state outlive each document (and its arena), so
+  // they're created here, with no arena in use.
+  gumbo_tokenizer_state_init(parser, "", 0);
+  parser_state_init(parser);
+  start_stream(parser);
+  gumbo_set_arena(previous_arena);
+  return parser;
+}
+
+void gumbo_parser_feed(GumboParser* parser, const char* chunk, size_t length) {
+  assert(parser->_output);
+  if (parser->_done || length == 0) {
+    return;
+  }
+  GumboArena* previous_arena = gumbo_set_arena(parser->_output->arena);
+  GumboParseStats* previous_stats =
+    gumbo_set_allocation_stats(parser->_options->stats);
+  append_input(parser, chunk, length, true);
+  run_parser(parser);
+  gumbo_set_allocation_stats(previous_stats);
+  gumbo_set_arena(previous_arena);
+}
+
+GumboOutput* gumbo_parser_finish(GumboParser* parser) {
+  GumboOutput* output = parser->_output;
+  assert(output);
+  GumboArena* previous_arena = gumbo_set_arena(output->arena);
+  GumboParseStats* previous_stats =
+    gumbo_set_allocation_stats(parser->_options->stats);
+  if (!parser->_done) {
+    append_input(parser, NULL, 0, false);
+    run_parser(parser);
+  }
+  end_parse(parser);
+  gumbo_set_allocation_stats(previous_stats);
+  gumbo_set_arena(previous_arena);
+  parser->_output = NULL;
+  return output;
+}
+
+void gumbo_parser_reset(GumboParser* parser) {
+  discard_stream(parser);
+  GumboArena* previous_arena = gumbo_set_arena(NULL);
+  start_stream(parser);
+  gumbo_set_arena(previous_arena);
+}
+
+GumboOutput* gumbo_parser_parse (
+  GumboParser* parser,
+  const char* buffer,
+  size_t length
+) {
+  discard_stream(parser);
+  GumboArena* previous_arena = gumbo_set_arena(NULL);
+  parser->_options_copy.lazy_positions = parser->_lazy_positions;
+  GumboOutput* output = parse_buffer(parser, buffer, length);
+  parser->_output = NULL;
+  gumbo_set_arena(previous_arena);
+  return output;
+}
+
+void gumbo_parser_destroy(GumboParser* parser) {
+  discard_stream(parser);
+  GumboArena* previous_arena = gumbo_set_arena(NULL);
+  parser_state_destroy(parser);
+  gumbo_tokenizer_state_destroy(parser);
+  gumbo_free(parser);
+  gumbo_set_arena(previous_arena);
+}
+
+void gumbo_position_resolve (
+  GumboOutput* output,
+  GumboSourcePosition* position
+) {
+  if (!output->line_index) {
+    return;
+  }
+  // The index belongs to the output, so it's grown in the output's arena.
+  GumboArena* previous_arena = gumbo_set_arena(output->arena);
+  gumbo_line_index_resolve(output->line_index, position);
+  gumbo_set_arena(previous_arena);
+}
+
+const char* gumbo_interned_name(const GumboOutput* output, const char* name) {
+  return gumbo_intern_lookup(output->names, name, strlen(name));
 }
 
 const char* gumbo_status_to_string(GumboOutputStatus status) {
@@ -4622,15 +5736,64 @@ const char* gumbo_status_to_string(GumboOutputStatus status) {
   }
 }
 
+static const char* const kInsertionModeNames[] = {
+  "initial",
+  "before html",
+  "before head",
+  "in head",
+  "in head noscript",
+  "after head",
+  "in body",
+  "text",
+  "in table",
+  "in table text",
+  "in caption",
+  "in column group",
+  "in table body",
+  "in row",
+  "in cell",
+  "in select",
+  "in select in table",
+  "in template",
+  "after body",
+  "in frameset",
+  "after frameset",
+  "after after body",
+  "after after frameset"
+};
+
+const char* gumbo_insertion_mode_name(unsigned int mode) {
+  if (mode >= GUMBO_NUM_INSERTION_MODES) {
+    return NULL;
+  }
+  return kInsertionModeNames[mode];
+}
+
 void gumbo_destroy_node(GumboNode* node) {
   destroy_node(node);
 }
 
 void gumbo_destroy_output(GumboOutput* output) {
+  InputBuffer* buffer = output->input_buffers;
+  while (buffer) {
+    InputBuffer* next = buffer->next;
+    gumbo_free(buffer);
+    buffer = next;
+  }
+  if (output->arena) {
+    gumbo_arena_destroy(output->arena);
+    gumbo_free(output);
+    return;
+  }
   destroy_node(output->document);
+  gumbo_line_index_destroy(output->line_index);
+  gumbo_intern_table_destroy(output->names);
   for (unsigned int i = 0; i < output->errors.length; ++i) {
     gumbo_error_destroy(output->errors.data[i]);
   }
   gumbo_vector_destroy(&output->errors);
+  if (output->error_arena) {
+    gumbo_arena_destroy(output->error_arena);
+  }
   gumbo_free(output);
 }
@@ -1,6 +1,9 @@
 #ifndef GUMBO_PARSER_H_
 #define GUMBO_PARSER_H_
 
+#include <stdbool.h>
+#include "gumbo.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -9,14 +12,14 @@ extern "C" {
 // threaded through basically every internal function in the library.
 
 struct GumboInternalParserState;
-struct GumboInternalOutput;
-struct GumboInternalOptions;
 struct GumboInternalTokenizerState;
 
 // An overarching struct that's threaded through (nearly) all functions in the
 // library, OOP-style. This gives each function access to the options and
-// output, along with any internal state needed for the parse.
-typedef struct GumboInternalParser {
+// output, along with any internal state needed for the parse. The GumboParser
+// typedef is in gumbo.h, since the incremental parsing API exposes it as an
+// opaque handle.
+struct GumboInternalParser {
   // Settings for this parse run.
   const struct GumboInternalOptions* _options;
 
@@ -25,14 +28,31 @@ typedef struct GumboInternalParser {
 
   // The internal tokenizer state, defined as a pointer to avoid a cyclic
   // dependency on html5tokenizer.h. The main parse routine is responsible for
-  // initializing this on parse start, and destroying it on parse end.
-  // End-users will never see a non-garbage value in this pointer.
+  // initializing this on parse start, and destroying it on parse end (or when
+  // a parser created with gumbo_parser_new is destroyed). End-users will never
+  // see a non-garbage value in this pointer.
   struct GumboInternalTokenizerState* _tokenizer_state;
 
-  // The internal parser state. Initialized on parse start and destroyed on
-  // parse end; end-users will never see a non-garbage value in this pointer.
+  // The internal parser state, with the same lifetime as _tokenizer_state;
+  // end-users will never see a non-garbage value in this pointer.
   struct GumboInternalParserState* _parser_state;
-} GumboParser;
+
+  // Set once tree construction has stopped, either at the end of the input or
+  // early because of stop_on_first_error or the tree depth limit. Any input
+  // fed after that is ignored.
+  bool _done;
+
+  // The remaining fields are only used by parsers created with
+  // gumbo_parser_new, which keep their tokenizer and parser state from one
+  // document to the next. For those, _output is NULL between documents.
+
+  // A copy of the caller's options, which _options points to. Its
+  // lazy_positions is turned off for incremental parses.
+  GumboOptions _options_copy;
+
+  // The caller's lazy_positions option, for gumbo_parser_parse.
+  bool _lazy_positions;
+};
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,214 @@
+#include <assert.h>
+#include <stdbool.h>
+#include "position.h"
+#include "utf8.h"
+#include "util.h"
+
+// The most bytes a column is worked out from, past the nearest checkpoint or
+// line start. This keeps resolving positions on long (say, minified) lines
+// from being quadratic.
+#define CHECKPOINT_INTERVAL 256
+
+// The column of the character at a given offset.
+typedef struct {
+  size_t offset;
+  size_t column;
+} ColumnCheckpoint;
+
+struct GumboInternalLineIndex {
+  const char* source;
+  size_t length;
+  int tab_stop;
+  // Offset of the first character of each line, in increasing order. NULL
+  // until the first call to gumbo_line_index_resolve.
+  size_t* line_starts;
+  size_t num_lines;
+  // A checkpoint at least every CHECKPOINT_INTERVAL bytes, in increasing
+  // order, from the start of the source up to the furthest position
+  // resolved so far. The last one is where the next resolution past it
+  // carries on from.
+  ColumnCheckpoint* checkpoints;
+  size_t num_checkpoints;
+  size_t checkpoint_capacity;
+};
+
+GumboLineIndex* gumbo_line_index_new (
+  const char* source,
+  size_t length,
+  int tab_stop
+) {
+  GumboLineIndex* index = gumbo_alloc(sizeof(GumboLineIndex));
+  index->source = source;
+  index->length = length;
+  index->tab_stop = tab_stop;
+  index->line_starts = NULL;
+  index->num_lines = 0;
+  index->checkpoints = NULL;
+  index->num_checkpoints = 0;
+  index->checkpoint_capacity = 0;
+  return index;
+}
+
+void gumbo_line_index_destroy(GumboLineIndex* index) {
+  if (!index) {
+    return;
+  }
+  gumbo_free(index->line_starts);
+  gumbo_free(index->checkpoints);
+  gumbo_free(index);
+}
+
+// A line ends at every LF, and at every CR that isn't the first half of a
+// CRLF pair, since the input stream preprocessing turns those into LFs.
+static void build_line_starts(GumboLineIndex* index) {
+  const char* source = index->source;
+  size_t length = index->length;
+  size_t capacity = 64;
+  index->line_starts = gumbo_alloc(capacity * sizeof(size_t));
+  index->line_starts[0] = 0;
+  index->num_lines = 1;
+  for (size_t i = 0; i < length; ++i) {
+    bool is_line_end =
+      source[i] == '\n'
+      || (source[i] == '\r' && (i + 1 == length || source[i + 1] != '\n'));
+    if (!is_line_end) {
+      continue;
+    }
+    if (index->num_lines == capacity) {
+      index->line_starts = gumbo_realloc (
+        index->line_starts,
+        capacity * sizeof(size_t),
+        2 * capacity * sizeof(size_t)
+      );
+      capacity *= 2;
+    }
+    index->line_starts[index->num_lines++] = i + 1;
+  }
+}
+
+static void add_checkpoint (
+  GumboLineIndex* index,
+  size_t offset,
+  size_t column
+) {
+  if (!index->checkpoints) {
+    // Like the index, this comes out of the output's arena when it has one.
+    index->checkpoint_capacity = 16;
+    index->checkpoints =
+      gumbo_alloc(index->checkpoint_capacity * sizeof(ColumnCheckpoint));
+  } else if (index->num_checkpoints == index->checkpoint_capacity) {
+    index->checkpoints = gumbo_realloc (
+      index->checkpoints,
+      index->checkpoint_capacity * sizeof(ColumnCheckpoint),
+      2 * index->checkpoint_capacity * sizeof(ColumnCheckpoint)
+    );
+    index->checkpoint_capacity *= 2;
+  }
+  ColumnCheckpoint* checkpoint = &index->checkpoints[index->num_checkpoints++];
+  checkpoint->offset = offset;
+  checkpoint->column = column;
+}
+
+// Returns the column of the character after the one at `c`, which is in
+// column `column`. Columns count characters rather than bytes, and this walks
+// the source the same way the Utf8Iterator does.
+static size_t next_column (
+  const GumboLineIndex* index,
+  const char* c,
+  size_t column
+) {
+  const char* end = index->source + index->length;
+  if (*c == '\n' || (*c == '\r' && (c + 1 == end || c[1] != '\n'))) {
+    return 1;
+  }
+  if (*c == '\t') {
+    return ((column / index->tab_stop) + 1) * index->tab_stop;
+  }
+  // The only CR that can appear within a line is the first half of a CRLF,
+  // which the iterator skips.
+  return *c == '\r' ? column : column + 1;
+}
+
+// Extends the checkpoints at least as far as `offset`.
+static void add_checkpoints_to(GumboLineIndex* index, size_t offset) {
+  if (!index->checkpoints) {
+    add_checkpoint(index, 0, 1);
+  }
+  const ColumnCheckpoint* last =
+    &index->checkpoints[index->num_checkpoints - 1];
+  const char* source = index->source;
+  const char* end = source + index->length;
+  const char* c = source + last->offset;
+  size_t column = last->column;
+  size_t last_offset = last->offset;
+  while (c < end && (size_t) (c - source) < offset) {
+    column = next_column(index, c, column);
+    c += utf8_char_width(c, end);
+    if ((size_t) (c - source) - last_offset >= CHECKPOINT_INTERVAL) {
+      last_offset = c - source;
+      add_checkpoint(index, last_offset, column);
+    }
+  }
+  if ((size_t) (c - source) > last_offset) {
+    // The furthest point walked to, so that resolving positions in order
+    // never walks the same bytes twice.
+    add_checkpoint(index, c - source, column);
+  }
+}
+
+void gumbo_line_index_resolve (
+  GumboLineIndex* index,
+  GumboSourcePosition* position
+) {
+  if (!index->line_starts) {
+    build_line_starts(index);
+  }
+  size_t offset = position->offset;
+  assert(offset <= index->length);
+
+  // Find the last line starting at or before the offset.
+  size_t low = 0;
+  size_t high = index->num_lines;
+  while (high - low > 1) {
+    size_t mid = low + (high - low) / 2;
+    if (index->line_starts[mid] <= offset) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  position->line = low + 1;
+
+  // Start from the last checkpoint at or before the offset, or from the start
+  // of the line if that's later.
+  add_checkpoints_to(index, offset);
+  low = 0;
+  high = index->num_checkpoints;
+  while (high - low > 1) {
+    size_t mid = low + (high - low) / 2;
+    if (index->checkpoints[mid].offset <= offset) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  const ColumnCheckpoint* checkpoint = &index->checkpoints[low];
+  size_t line_start = index->line_starts[position->line - 1];
+  size_t start = line_start;
+  size_t column = 1;
+  if (checkpoint->offset >= line_start) {
+    start = checkpoint->offset;
+    column = checkpoint->column;
+  }
+
+  const char* end = index->source + index->length;
+  const char* target = index->source + offset;
+  for (
+    const char* c = index->source + start;
+    c < target;
+    c += utf8_char_width(c, end)
+  ) {
+    column = next_column(index, c, column);
+  }
+  position->column = column;
+}
@@ -0,0 +1,36 @@
+#ifndef GUMBO_POSITION_H_
+#define GUMBO_POSITION_H_
+
+#include <stddef.h>
+#include "gumbo.h"
+#include "macros.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maps byte offsets in a source buffer back to line and column numbers, for
+// outputs parsed with GumboOptions.lazy_positions. The table of line starts
+// is only built the first time a position is resolved.
+typedef struct GumboInternalLineIndex GumboLineIndex;
+
+GumboLineIndex* gumbo_line_index_new (
+  const char* source,
+  size_t length,
+  int tab_stop
+) XMALLOC;
+
+void gumbo_line_index_destroy(GumboLineIndex* index);
+
+// Fills in the line and column of `position` from its offset, exactly as
+// they would have been computed while parsing.
+void gumbo_line_index_resolve (
+  GumboLineIndex* index,
+  GumboSourcePosition* position
+) NONNULL_ARGS;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUMBO_POSITION_H_
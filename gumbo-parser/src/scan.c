@@ -0,0 +1,321 @@
+#include <stdint.h>
+#include <string.h>
+#include "scan.h"
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define HAVE_SSE2 1
+# include <emmintrin.h>
+#endif
+
+// AVX2 can't be assumed even on x86-64, so it's compiled separately with the
+// target attribute and only used if the CPU reports support for it.
+#if defined(HAVE_SSE2) && (GNUC_AT_LEAST(4, 9) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__i386__))
+# define HAVE_AVX2 1
+# include <immintrin.h>
+#endif
+
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+// Bit (1 << mode) is set for each GumboScanMode whose set contains the byte.
+static const uint16_t kScanSets[256] = {
+  0x002, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x19F, 0x19F, 0x000, 0x19F, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x19F, 0x3FF, 0x13F, 0x3FF, 0x3FF, 0x3FF, 0x07E, 0x0BF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3F7, 0x3FF, 0x39F,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x1B2, 0x1BF, 0x19F, 0x3FF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF,
+  0x1FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF,
+  0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+  0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+};
+
+// The vector scanners treat every byte below `limit` (compared as signed, so
+// this includes every byte with the high bit set) as special unless it's one
+// of the `allowed` ones, treat DEL as special, and check up to seven more
+// special bytes that depend on the mode. A check that a mode doesn't need is
+// given a byte that is already special (DEL) or, for `allowed`, one that is
+// already allowed (tab).
+typedef struct {
+  char limit;
+  char allowed[4];
+  char special[7];
+} ScanParams;
+
+static ScanParams scan_params(GumboScanMode mode) {
+  ScanParams params = {
+    .limit = ' ',
+    .allowed = {'\t', '\n', '\f', '\t'},
+    .special = {0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F},
+  };
+  switch (mode) {
+    case GUMBO_SCAN_DATA:
+      params.special[0] = '<';
+      params.special[1] = '&';
+      break;
+    case GUMBO_SCAN_ASCII:
+      params.allowed[3] = '\0';
+      break;
+    case GUMBO_SCAN_RAWTEXT:
+      params.special[0] = '<';
+      break;
+    case GUMBO_SCAN_SCRIPT_ESCAPED:
+      params.special[0] = '<';
+      params.special[1] = '-';
+      break;
+    case GUMBO_SCAN_PLAINTEXT:
+      break;
+    case GUMBO_SCAN_TAG_NAME:
+      // Whitespace ends names and unquoted values, so no control character
+      // is allowed and the space is special too.
+      params.limit = '!';
+      memset(params.allowed, 0x7F, sizeof params.allowed);
+      params.special[0] = '/';
+      params.special[1] = '>';
+      break;
+    case GUMBO_SCAN_ATTR_NAME:
+      params.limit = '!';
+      memset(params.allowed, 0x7F, sizeof params.allowed);
+      params.special[0] = '/';
+      params.special[1] = '>';
+      params.special[2] = '=';
+      params.special[3] = '"';
+      params.special[4] = '\'';
+      params.special[5] = '<';
+      break;
+    case GUMBO_SCAN_ATTR_VALUE_DOUBLE_QUOTED:
+      params.special[0] = '"';
+      params.special[1] = '&';
+      break;
+    case GUMBO_SCAN_ATTR_VALUE_SINGLE_QUOTED:
+      params.special[0] = '\'';
+      params.special[1] = '&';
+      break;
+    case GUMBO_SCAN_ATTR_VALUE_UNQUOTED:
+      params.limit = '!';
+      memset(params.allowed, 0x7F, sizeof params.allowed);
+      params.special[0] = '&';
+      params.special[1] = '>';
+      params.special[2] = '<';
+      params.special[3] = '=';
+      params.special[4] = '"';
+      params.special[5] = '\'';
+      params.special[6] = '`';
+      break;
+  }
+  return params;
+}
+
+static const char* scan_scalar (
+  const char* p,
+  const char* end,
+  GumboScanMode mode
+) {
+  const uint16_t bit = 1 << mode;
+  while (p < end && (kScanSets[(unsigned char) *p] & bit)) {
+    ++p;
+  }
+  return p;
+}
+
+#ifdef HAVE_SSE2
+static inline unsigned int count_trailing_zeros(unsigned int mask) {
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return index;
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+static const char* scan_sse2 (
+  const char* p,
+  const char* end,
+  GumboScanMode mode
+) {
+  const ScanParams params = scan_params(mode);
+  const __m128i limit = _mm_set1_epi8(params.limit);
+  __m128i allowed[4];
+  for (int i = 0; i < 4; ++i) {
+    allowed[i] = _mm_set1_epi8(params.allowed[i]);
+  }
+  __m128i special[7];
+  for (int i = 0; i < 7; ++i) {
+    special[i] = _mm_set1_epi8(params.special[i]);
+  }
+  const __m128i del = _mm_set1_epi8(0x7F);
+  while (end - p >= 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*) p);
+    // The signed comparison catches both control characters and every byte
+    // with the high bit set.
+    __m128i ctrl = _mm_cmplt_epi8(v, limit);
+    __m128i ok_ctrl = _mm_or_si128 (
+      _mm_or_si128 (
+        _mm_cmpeq_epi8(v, allowed[0]),
+        _mm_cmpeq_epi8(v, allowed[1])
+      ),
+      _mm_or_si128 (
+        _mm_cmpeq_epi8(v, allowed[2]),
+        _mm_cmpeq_epi8(v, allowed[3])
+      )
+    );
+    __m128i found = _mm_or_si128 (
+      _mm_andnot_si128(ok_ctrl, ctrl),
+      _mm_cmpeq_epi8(v, del)
+    );
+    // Written out rather than looped over, which -Os would leave rolled.
+    found = _mm_or_si128 (
+      found,
+      _mm_or_si128 (
+        _mm_or_si128 (
+          _mm_or_si128 (
+            _mm_cmpeq_epi8(v, special[0]),
+            _mm_cmpeq_epi8(v, special[1])
+          ),
+          _mm_or_si128 (
+            _mm_cmpeq_epi8(v, special[2]),
+            _mm_cmpeq_epi8(v, special[3])
+          )
+        ),
+        _mm_or_si128 (
+          _mm_or_si128 (
+            _mm_cmpeq_epi8(v, special[4]),
+            _mm_cmpeq_epi8(v, special[5])
+          ),
+          _mm_cmpeq_epi8(v, special[6])
+        )
+      )
+    );
+    unsigned int mask = (unsigned int) _mm_movemask_epi8(found);
+    if (mask) {
+      return p + count_trailing_zeros(mask);
+    }
+    p += 16;
+  }
+  return scan_scalar(p, end, mode);
+}
+#endif // HAVE_SSE2
+
+#ifdef HAVE_AVX2
+__attribute__((__target__("avx2")))
+static const char* scan_avx2 (
+  const char* p,
+  const char* end,
+  GumboScanMode mode
+) {
+  const ScanParams params = scan_params(mode);
+  const __m256i limit = _mm256_set1_epi8(params.limit);
+  __m256i allowed[4];
+  for (int i = 0; i < 4; ++i) {
+    allowed[i] = _mm256_set1_epi8(params.allowed[i]);
+  }
+  __m256i special[7];
+  for (int i = 0; i < 7; ++i) {
+    special[i] = _mm256_set1_epi8(params.special[i]);
+  }
+  const __m256i del = _mm256_set1_epi8(0x7F);
+  while (end - p >= 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*) p);
+    // AVX2 only has a signed greater-than, so this is v < limit (signed).
+    __m256i ctrl = _mm256_cmpgt_epi8(limit, v);
+    __m256i ok_ctrl = _mm256_or_si256 (
+      _mm256_or_si256 (
+        _mm256_cmpeq_epi8(v, allowed[0]),
+        _mm256_cmpeq_epi8(v, allowed[1])
+      ),
+      _mm256_or_si256 (
+        _mm256_cmpeq_epi8(v, allowed[2]),
+        _mm256_cmpeq_epi8(v, allowed[3])
+      )
+    );
+    __m256i found = _mm256_or_si256 (
+      _mm256_andnot_si256(ok_ctrl, ctrl),
+      _mm256_cmpeq_epi8(v, del)
+    );
+    found = _mm256_or_si256 (
+      found,
+      _mm256_or_si256 (
+        _mm256_or_si256 (
+          _mm256_or_si256 (
+            _mm256_cmpeq_epi8(v, special[0]),
+            _mm256_cmpeq_epi8(v, special[1])
+          ),
+          _mm256_or_si256 (
+            _mm256_cmpeq_epi8(v, special[2]),
+            _mm256_cmpeq_epi8(v, special[3])
+          )
+        ),
+        _mm256_or_si256 (
+          _mm256_or_si256 (
+            _mm256_cmpeq_epi8(v, special[4]),
+            _mm256_cmpeq_epi8(v, special[5])
+          ),
+          _mm256_cmpeq_epi8(v, special[6])
+        )
+      )
+    );
+    unsigned int mask = (unsigned int) _mm256_movemask_epi8(found);
+    if (mask) {
+      return p + __builtin_ctz(mask);
+    }
+    p += 32;
+  }
+  return scan_sse2(p, end, mode);
+}
+#endif // HAVE_AVX2
+
+size_t gumbo_scan_text (
+  const char* start,
+  const char* end,
+  GumboScanMode mode
+) {
+  const char* p = start;
+  if (mode >= GUMBO_SCAN_TAG_NAME) {
+    // Names and attribute values are usually short enough that checking them
+    // a byte at a time is quicker than setting up the vector comparisons.
+    const char* block_end = end - p > 16 ? p + 16 : end;
+    p = scan_scalar(p, block_end, mode);
+    if (p < block_end || p == end) {
+      return p - start;
+    }
+  }
+#if defined(HAVE_AVX2)
+  if (__builtin_cpu_supports("avx2")) {
+    p = scan_avx2(p, end, mode);
+  } else {
+    p = scan_sse2(p, end, mode);
+  }
+#elif defined(HAVE_SSE2)
+  p = scan_sse2(p, end, mode);
+#else
+  p = scan_scalar(p, end, mode);
+#endif
+  return p - start;
+}
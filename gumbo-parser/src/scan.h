@@ -0,0 +1,63 @@
+#ifndef GUMBO_SCAN_H_
+#define GUMBO_SCAN_H_
+
+#include <stddef.h>
+#include "macros.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The sets of bytes gumbo_scan_text can skip over. Every set is limited to
+// ASCII and excludes CR, so the caller is responsible
+// for updating the source position (see utf8iterator_skip_ascii).
+typedef enum {
+  // Bytes the data state passes straight through to a character token:
+  // anything other than '<', '&', NUL, CR, non-ASCII bytes and the control
+  // characters that are parse errors.
+  GUMBO_SCAN_DATA,
+  // Bytes that decode to themselves without any preprocessing or parse
+  // error: as above, but including '<', '&' and NUL.
+  GUMBO_SCAN_ASCII,
+  // Bytes the RAWTEXT and script data states pass straight through: as for
+  // GUMBO_SCAN_DATA, but including '&'.
+  GUMBO_SCAN_RAWTEXT,
+  // Bytes the script data escaped and double escaped states pass straight
+  // through: as for GUMBO_SCAN_RAWTEXT, but not '-'.
+  GUMBO_SCAN_SCRIPT_ESCAPED,
+  // Bytes the PLAINTEXT state passes straight through: as for
+  // GUMBO_SCAN_RAWTEXT, but including '<'.
+  GUMBO_SCAN_PLAINTEXT,
+  // Bytes the tag name state appends to the name, other than uppercase
+  // letters, which it lowercases: anything printable other than '/' and '>'.
+  GUMBO_SCAN_TAG_NAME,
+  // Bytes the attribute name state appends to the name without a parse
+  // error: as for GUMBO_SCAN_TAG_NAME, but not '=', '"', '\'' or '<'.
+  GUMBO_SCAN_ATTR_NAME,
+  // Bytes the double-quoted attribute value state appends to the value: as
+  // for GUMBO_SCAN_DATA, but including '<' and not '"'.
+  GUMBO_SCAN_ATTR_VALUE_DOUBLE_QUOTED,
+  // As above, for single-quoted values.
+  GUMBO_SCAN_ATTR_VALUE_SINGLE_QUOTED,
+  // Bytes the unquoted attribute value state appends to the value without a
+  // parse error: anything printable other than '&', '>', '<', '=', '"', '\''
+  // and '`'.
+  GUMBO_SCAN_ATTR_VALUE_UNQUOTED,
+} GumboScanMode;
+
+// Returns the length of the longest prefix of [start, end) consisting only of
+// bytes in the given set.
+//
+// Uses SSE2 or AVX2 where available, chosen at run time for AVX2, and falls
+// back to a table lookup per byte.
+size_t gumbo_scan_text (
+  const char* start,
+  const char* end,
+  GumboScanMode mode
+) PURE;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUMBO_SCAN_H_
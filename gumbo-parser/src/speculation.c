@@ -0,0 +1,406 @@
+// POSIX threads aren't part of C99.
+#define _POSIX_C_SOURCE 200112L
+
+#include <string.h>
+#include "speculation.h"
+#include "arena.h"
+#include "error.h"
+#include "gumbo.h"
+#include "intern.h"
+#include "macros.h"
+#include "parser.h"
+#include "util.h"
+#include "vector.h"
+
+#if HAVE_PTHREADS
+# include <pthread.h>
+#endif
+
+// Splitting costs a thread and a tokenizer per chunk, and every chunk boundary
+// is a point where the speculative tokens may not line up with the real ones,
+// so chunks are kept large.
+static const size_t kMinChunkSize = 256 * 1024;
+
+typedef struct {
+  GumboToken token;
+  // Where the token starts and where the next one does.
+  const char* start;
+  const char* end;
+  GumboSourcePosition end_pos;
+  // The token's errors, as indices into its chunk's errors.
+  unsigned int first_error;
+  unsigned int end_error;
+  // What gumbo_lex returned.
+  bool lexed;
+  // Set if the speculative tokenizer was between tokens (see
+  // gumbo_tokenizer_is_between_tokens) both before and after lexing the
+  // token. Only then can the real tokenizer take the token, and carry on
+  // from its end.
+  bool seekable;
+} SpeculativeToken;
+
+typedef struct {
+  const struct GumboInternalSpeculation* speculation;
+  // The chunk starts just after a newline, and is tokenized up to the first
+  // token boundary at or after `end`.
+  const char* start;
+  const char* end;
+#if HAVE_PTHREADS
+  pthread_t thread;
+#endif
+  bool started;
+  bool joined;
+  // The chunk's own allocator, when the output has one. Its memory is handed
+  // over to the output's arena when the chunk is joined.
+  GumboArena* arena;
+  // Only the errors and names of this are used. Names are re-interned in the
+  // real output as tokens are taken.
+  GumboOutput output;
+  SpeculativeToken* tokens;
+  size_t num_tokens;
+  size_t capacity;
+  // The first token the real tokenizer hasn't taken or passed yet.
+  size_t next;
+} Chunk;
+
+struct GumboInternalSpeculation {
+  GumboOptions options;
+  const char* buffer;
+  size_t length;
+  GumboArena* output_arena;
+  Chunk* chunks;
+  unsigned int num_chunks;
+  // The chunk the real tokenizer is in, or is heading for.
+  unsigned int current;
+};
+
+// Returns the point just after the first newline at or after `from` that is
+// followed by something that looks like the start of a tag, or NULL if there
+// isn't one. The start of a line is a good guess for a point that isn't
+// inside a tag, and a tag is where the data state is most likely.
+static const char* find_split(const char* from, const char* end) {
+  const char* p = from;
+  while ((p = memchr(p, '\n', end - p)) && end - p >= 3) {
+    ++p;
+    if (p[0] == '<') {
+      char c = p[1] | 0x20;
+      if ((c >= 'a' && c <= 'z') || p[1] == '/' || p[1] == '!') {
+        return p;
+      }
+    }
+  }
+  return NULL;
+}
+
+static SpeculativeToken* add_token(Chunk* chunk) {
+  if (chunk->num_tokens == chunk->capacity) {
+    // The array is released as soon as the parse ends, so it's kept out of
+    // the arena.
+    GumboArena* arena = gumbo_set_arena(NULL);
+    size_t capacity = chunk->capacity ? 2 * chunk->capacity : 256;
+    chunk->tokens = gumbo_realloc (
+      chunk->tokens,
+      chunk->capacity * sizeof(SpeculativeToken),
+      capacity * sizeof(SpeculativeToken)
+    );
+    chunk->capacity = capacity;
+    gumbo_set_arena(arena);
+  }
+  return &chunk->tokens[chunk->num_tokens++];
+}
+
+static void* tokenize_chunk(void* arg) {
+  Chunk* chunk = arg;
+  const GumboSpeculation* speculation = chunk->speculation;
+  gumbo_set_arena(chunk->arena);
+
+  GumboParser parser;
+  parser._options = &speculation->options;
+  parser._output = &chunk->output;
+  parser._parser_state = NULL;
+  gumbo_tokenizer_state_init (
+    &parser,
+    speculation->buffer,
+    speculation->length
+  );
+  // Any error here is about the first character of the whole input.
+  GumboVector* errors = &chunk->output.errors;
+  while (errors->length > 0) {
+    gumbo_remove_last_error(&parser);
+  }
+  unsigned int line = speculation->options.lazy_positions ? 0 : 1;
+  GumboSourcePosition position = {
+    .line = line,
+    .column = line,
+    .offset = chunk->start - speculation->buffer
+  };
+  gumbo_tokenizer_seek(&parser, chunk->start, &position);
+
+  bool between_tokens = true;
+  const char* start = chunk->start;
+  for (;;) {
+    // Character runs are the real tokenizer's choice, and a run can only be
+    // taken if it would be emitting them too; so runs are only lexed where
+    // they could be taken at all.
+    gumbo_tokenizer_set_emit_character_runs(&parser, between_tokens);
+    SpeculativeToken* token = add_token(chunk);
+    token->start = start;
+    token->first_error = errors->length;
+    token->lexed = gumbo_lex(&parser, &token->token);
+    token->end_error = errors->length;
+    token->seekable = between_tokens;
+    between_tokens = gumbo_tokenizer_is_between_tokens(&parser);
+    token->seekable = token->seekable && between_tokens;
+    start = gumbo_tokenizer_get_token_start(&parser, &token->end_pos);
+    token->end = start;
+    if (
+      token->token.type == GUMBO_TOKEN_EOF
+      || (between_tokens && start >= chunk->end)
+    ) {
+      break;
+    }
+  }
+  gumbo_tokenizer_state_destroy(&parser);
+  return NULL;
+}
+
+GumboSpeculation* gumbo_speculation_new (
+  GumboParser* parser,
+  const char* buffer,
+  size_t length
+) {
+  const GumboOptions* options = parser->_options;
+  unsigned int num_chunks = options->tokenizer_threads;
+  if (num_chunks > length / kMinChunkSize) {
+    num_chunks = length / kMinChunkSize;
+  }
+#if !HAVE_PTHREADS
+  num_chunks = 1;
+#endif
+  if (num_chunks < 2) {
+    return NULL;
+  }
+
+  // The first chunk is the real tokenizer's, so it isn't in the list.
+  GumboArena* output_arena = gumbo_set_arena(NULL);
+  GumboSpeculation* speculation = gumbo_alloc(sizeof(GumboSpeculation));
+  speculation->options = *options;
+  speculation->buffer = buffer;
+  speculation->length = length;
+  speculation->output_arena = output_arena;
+  speculation->chunks = gumbo_alloc((num_chunks - 1) * sizeof(Chunk));
+  speculation->num_chunks = 0;
+  speculation->current = 0;
+
+  const char* end = buffer + length;
+  const char* previous = buffer;
+  for (unsigned int i = 1; i < num_chunks; ++i) {
+    const char* from = buffer + (length / num_chunks) * i;
+    const char* start = find_split(from > previous ? from : previous, end);
+    if (!start) {
+      break;
+    }
+    Chunk* chunk = &speculation->chunks[speculation->num_chunks++];
+    memset(chunk, 0, sizeof(Chunk));
+    chunk->speculation = speculation;
+    chunk->start = start;
+    chunk->end = end;
+    if (speculation->num_chunks > 1) {
+      chunk[-1].end = start;
+    }
+    chunk->arena = output_arena ? gumbo_arena_new() : NULL;
+    gumbo_set_arena(chunk->arena);
+    gumbo_vector_init(5, &chunk->output.errors);
+    // Without an arena, the errors get one of their own when there are any.
+    chunk->output.error_arena = chunk->arena;
+    chunk->output.names = gumbo_intern_table_new();
+    gumbo_set_arena(NULL);
+    previous = start;
+  }
+  if (speculation->num_chunks == 0) {
+    gumbo_free(speculation->chunks);
+    gumbo_free(speculation);
+    gumbo_set_arena(output_arena);
+    return NULL;
+  }
+
+  // Every chunk's end is known before any thread starts.
+#if HAVE_PTHREADS
+  for (unsigned int i = 0; i < speculation->num_chunks; ++i) {
+    Chunk* chunk = &speculation->chunks[i];
+    // A chunk whose thread can't be started is left without tokens.
+    chunk->started =
+      !pthread_create(&chunk->thread, NULL, tokenize_chunk, chunk);
+  }
+#endif
+  gumbo_set_arena(output_arena);
+  return speculation;
+}
+
+static void join_chunk(GumboSpeculation* speculation, Chunk* chunk) {
+  if (chunk->joined) {
+    return;
+  }
+#if HAVE_PTHREADS
+  if (chunk->started) {
+    pthread_join(chunk->thread, NULL);
+  }
+#endif
+  chunk->joined = true;
+  if (chunk->arena) {
+    // From here on, the chunk's tokens may end up in the tree.
+    gumbo_arena_adopt(speculation->output_arena, chunk->arena);
+    chunk->arena = NULL;
+  }
+}
+
+static void destroy_errors (
+  Chunk* chunk,
+  unsigned int first_error,
+  unsigned int end_error
+) {
+  GumboVector* errors = &chunk->output.errors;
+  for (unsigned int i = first_error; i < end_error; ++i) {
+    if (errors->data[i]) {
+      gumbo_error_destroy(errors->data[i]);
+      errors->data[i] = NULL;
+    }
+  }
+}
+
+static void shift_position(GumboSourcePosition* position, unsigned int lines) {
+  position->line += lines;
+}
+
+// Hands a speculative token over to the real tokenizer, which then carries on
+// from the end of it. Its positions are relative to the start of its chunk,
+// which is `line_delta` lines before the real one.
+static bool take_token (
+  GumboParser* parser,
+  Chunk* chunk,
+  SpeculativeToken* token,
+  unsigned int line_delta,
+  GumboToken* output
+) {
+  *output = token->token;
+  shift_position(&output->position, line_delta);
+  GumboInternTable* names = parser->_output->names;
+  if (output->type == GUMBO_TOKEN_START_TAG) {
+    GumboTokenStartTag* start_tag = &output->v.start_tag;
+    if (start_tag->name) {
+      start_tag->name =
+        gumbo_intern(names, start_tag->name, strlen(start_tag->name));
+    }
+    for (unsigned int i = 0; i < start_tag->attributes.length; ++i) {
+      GumboAttribute* attr = start_tag->attributes.data[i];
+      attr->name = gumbo_intern(names, attr->name, strlen(attr->name));
+      shift_position(&attr->name_start, line_delta);
+      shift_position(&attr->name_end, line_delta);
+      shift_position(&attr->value_start, line_delta);
+      shift_position(&attr->value_end, line_delta);
+    }
+  } else if (output->type == GUMBO_TOKEN_END_TAG && output->v.end_tag.name) {
+    const char* name = output->v.end_tag.name;
+    output->v.end_tag.name = gumbo_intern(names, name, strlen(name));
+  }
+
+  // The errors are copied into the output's own error arena; the chunk's is
+  // released with the chunk. What an error owns moves with it.
+  GumboVector* errors = &chunk->output.errors;
+  for (unsigned int i = token->first_error; i < token->end_error; ++i) {
+    GumboError* error = gumbo_add_error(parser);
+    if (!error) {
+      break;
+    }
+    *error = *(GumboError*) errors->data[i];
+    shift_position(&error->position, line_delta);
+    errors->data[i] = NULL;
+  }
+  destroy_errors(chunk, token->first_error, token->end_error);
+
+  GumboSourcePosition end_pos = token->end_pos;
+  shift_position(&end_pos, line_delta);
+  gumbo_tokenizer_seek(parser, token->end, &end_pos);
+  gumbo_tokenizer_note_token(parser, output);
+  return token->lexed;
+}
+
+static void discard_token(Chunk* chunk, SpeculativeToken* token) {
+  gumbo_token_destroy(&token->token);
+  destroy_errors(chunk, token->first_error, token->end_error);
+}
+
+bool gumbo_speculation_lex (
+  GumboSpeculation* speculation,
+  GumboParser* parser,
+  GumboToken* output
+) {
+  if (!gumbo_tokenizer_is_between_tokens(parser)) {
+    return gumbo_lex(parser, output);
+  }
+  GumboSourcePosition position;
+  const char* start = gumbo_tokenizer_get_token_start(parser, &position);
+  while (speculation->current < speculation->num_chunks) {
+    Chunk* chunk = &speculation->chunks[speculation->current];
+    if (start < chunk->start) {
+      break;
+    }
+    join_chunk(speculation, chunk);
+    while (
+      chunk->next < chunk->num_tokens
+      && chunk->tokens[chunk->next].start < start
+    ) {
+      discard_token(chunk, &chunk->tokens[chunk->next++]);
+    }
+    if (chunk->next < chunk->num_tokens) {
+      SpeculativeToken* token = &chunk->tokens[chunk->next];
+      if (
+        token->start != start
+        || !token->seekable
+        || !gumbo_tokenizer_would_emit(parser, &token->token)
+      ) {
+        break;
+      }
+      ++chunk->next;
+      unsigned int line_delta = position.line - token->token.position.line;
+      return take_token(parser, chunk, token, line_delta, output);
+    }
+    ++speculation->current;
+  }
+  return gumbo_lex(parser, output);
+}
+
+void gumbo_speculation_destroy(GumboSpeculation* speculation) {
+  GumboArena* previous_arena = gumbo_set_arena(speculation->output_arena);
+  for (unsigned int i = 0; i < speculation->num_chunks; ++i) {
+    Chunk* chunk = &speculation->chunks[i];
+#if HAVE_PTHREADS
+    if (chunk->started && !chunk->joined) {
+      pthread_join(chunk->thread, NULL);
+    }
+#endif
+    if (chunk->arena) {
+      // Never joined, so nothing in it was used.
+      gumbo_arena_destroy(chunk->arena);
+      continue;
+    }
+    for (size_t j = chunk->next; j < chunk->num_tokens; ++j) {
+      gumbo_token_destroy(&chunk->tokens[j].token);
+    }
+    destroy_errors(chunk, 0, chunk->output.errors.length);
+    gumbo_vector_destroy(&chunk->output.errors);
+    gumbo_intern_table_destroy(chunk->output.names);
+    // With an arena, the errors were in the chunk's, which the output's has
+    // taken over.
+    if (!speculation->output_arena && chunk->output.error_arena) {
+      gumbo_arena_destroy(chunk->output.error_arena);
+    }
+  }
+  gumbo_set_arena(NULL);
+  for (unsigned int i = 0; i < speculation->num_chunks; ++i) {
+    gumbo_free(speculation->chunks[i].tokens);
+  }
+  gumbo_free(speculation->chunks);
+  gumbo_free(speculation);
+  gumbo_set_arena(previous_arena);
+}
@@ -0,0 +1,49 @@
+#ifndef GUMBO_SPECULATION_H_
+#define GUMBO_SPECULATION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "tokenizer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct GumboInternalParser;
+
+// Speculative tokenization of a large document on several threads (see
+// GumboOptions.tokenizer_threads). The input is split into chunks at likely
+// tag boundaries, and every chunk but the first is tokenized ahead of time on
+// a thread of its own, from the data state. As the real tokenizer reaches
+// each chunk, its tokens are used in place of lexing whenever the real
+// tokenizer is between tokens at the same point in the input and would lex
+// the same token there; everywhere else, it lexes as usual.
+typedef struct GumboInternalSpeculation GumboSpeculation;
+
+// Starts tokenizing `buffer`, which the parser's tokenizer has just been set
+// up to parse in full, on `parser->_options->tokenizer_threads` threads.
+// Returns NULL if the buffer is too small to be worth splitting, or threads
+// aren't available. The output's arena, if any, must be current.
+GumboSpeculation* gumbo_speculation_new (
+  struct GumboInternalParser* parser,
+  const char* buffer,
+  size_t length
+);
+
+// A drop-in replacement for gumbo_lex that uses the speculative tokens where
+// possible.
+bool gumbo_speculation_lex (
+  GumboSpeculation* speculation,
+  struct GumboInternalParser* parser,
+  GumboToken* output
+);
+
+// Waits for every thread to finish, and releases the tokens that weren't
+// used.
+void gumbo_speculation_destroy(GumboSpeculation* speculation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUMBO_SPECULATION_H_
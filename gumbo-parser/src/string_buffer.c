@@ -32,7 +32,7 @@ static void maybe_resize_string_buffer (
     new_capacity *= 2;
   }
   if (new_capacity != buffer->capacity) {
-    buffer->data = gumbo_realloc(buffer->data, new_capacity);
+    buffer->data = gumbo_realloc(buffer->data, buffer->capacity, new_capacity);
     buffer->capacity = new_capacity;
   }
 }
@@ -45,6 +45,7 @@
 */
 
 #include <assert.h>
+#include <stdint.h>
 #include <string.h>
 #include "tokenizer.h"
 #include "ascii.h"
@@ -52,7 +53,9 @@
 #include "char_ref.h"
 #include "error.h"
 #include "gumbo.h"
+#include "intern.h"
 #include "parser.h"
+#include "scan.h"
 #include "string_buffer.h"
 #include "token_type.h"
 #include "tokenizer_states.h"
@@ -60,6 +63,15 @@
 #include "util.h"
 #include "vector.h"
 
+// gumbo_lex jumps from each state's handler straight to the next one's with
+// computed gotos, where the compiler supports them. Defining
+// GUMBO_SWITCH_DISPATCH selects the portable switch instead (see
+// build/benchmark/bench_switch in the Makefile).
+#if (GNUC_AT_LEAST(3, 0) || defined(__clang__)) \
+    && !defined(GUMBO_SWITCH_DISPATCH)
+# define USE_COMPUTED_GOTO 1
+#endif
+
 // Compared against _script_data_buffer to determine if we're in
 // double-escaped script mode.
 static const GumboStringPiece kScriptTag = {.data = "script", .length = 6};
@@ -86,8 +98,8 @@ typedef struct GumboInternalTagState {
   GumboTag _tag;
 
   // The current tag name. It's set at the same time that _tag is set if _tag
-  // is set to GUMBO_TAG_UNKNOWN.
-  char *_name;
+  // is set to GUMBO_TAG_UNKNOWN. Interned (see intern.h).
+  const char* _name;
 
   // The starting location of the text in the buffer.
   GumboSourcePosition _start_pos;
@@ -98,6 +110,14 @@ typedef struct GumboInternalTagState {
   // values are filled in by operating on _attributes.data[attributes.length-1].
   GumboVector /* GumboAttribute */ _attributes;
 
+  // Once a tag has kMinAttributeSetSize attributes, duplicates are found with
+  // this open-addressing hash set of their (interned) names rather than by
+  // searching _attributes. Each slot holds one more than the attribute's index
+  // in _attributes, or 0 if it's empty. The set is rebuilt for each tag that
+  // needs it, and its memory is kept for the next one.
+  unsigned int* _attribute_set;
+  unsigned int _attribute_set_capacity;
+
   // If true, the next attribute value to be finished should be dropped. This
   // happens if a duplicate attribute name is encountered - we want to consume
   // the attribute value, but shouldn't overwrite the existing value.
@@ -142,6 +162,15 @@ typedef struct GumboInternalTokenizerState {
   // text tokens emitted will be GUMBO_TOKEN_CDATA.
   bool _is_in_cdata;
 
+  // A flag indicating whether the parser is able to handle runs of several
+  // characters in a single token (see GumboToken.is_character_run). This is
+  // set by gumbo_tokenizer_set_emit_character_runs before each token.
+  bool _emit_character_runs;
+
+  // Set when gumbo_lex stopped at the end of partial input without producing
+  // a token.
+  bool _needs_input;
+
   // Certain states (notably character references) may emit two character tokens
   // at once, but the contract for lex() fills in only one token at a time. The
   // extra character is buffered here, and then this is checked on entry to
@@ -324,6 +353,37 @@ static int ensure_lowercase(int c) {
   return gumbo_ascii_tolower(c);
 }
 
+// The most input any state looks ahead by before deciding what to do, apart
+// from character references: a complete UTF-8 sequence, a CR and the LF that
+// may follow it, or the keywords matched by utf8iterator_maybe_consume_match.
+#define MAX_LOOKAHEAD 16
+
+// Returns true if the tokenizer can safely consume the current character.
+// With partial input, that requires any lookahead to be available already.
+static bool has_lookahead(const Utf8Iterator* input, int c) {
+  if (likely(!input->_is_partial)) {
+    return true;
+  }
+  const char* start = utf8iterator_get_char_pointer(input);
+  const char* end = utf8iterator_get_end_pointer(input);
+  if (end - start < MAX_LOOKAHEAD) {
+    return false;
+  }
+  if (c == '&') {
+    // A character reference is an optional '#' followed by letters and
+    // digits, and the decoder has to see what comes after them.
+    const char* p = start + 1;
+    if (*p == '#') {
+      ++p;
+    }
+    while (p < end && (is_alpha(*p) || (unsigned) (*p - '0') < 10)) {
+      ++p;
+    }
+    return end - p >= MAX_LOOKAHEAD;
+  }
+  return true;
+}
+
 static GumboTokenType get_char_token_type(bool is_in_cdata, int c) {
   if (is_in_cdata && c > 0) {
     return GUMBO_TOKEN_CDATA;
@@ -496,6 +556,7 @@ static void finish_doctype_system_id(GumboParser* parser) {
 static void emit_char(GumboParser* parser, int c, GumboToken* output) {
   output->type = get_char_token_type(parser->_tokenizer_state->_is_in_cdata, c);
   output->v.character = c;
+  output->is_character_run = false;
   finish_token(parser, output);
 }
 
@@ -523,6 +584,129 @@ static bool emit_current_char(GumboParser* parser, GumboToken* output) {
   return RETURN_SUCCESS;
 }
 
+// Returns the number of bytes in the UTF-8 encoding of a code point.
+static size_t utf8_encoded_length(int c) {
+  return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+}
+
+// Returns true if the code point under the cursor starts at `expected` and
+// appears in the input exactly as it was decoded, i.e. it wasn't produced by
+// skipping or converting a carriage return, or by replacing an invalid byte
+// sequence. Character runs refer to the original text rather than to a copy of
+// the decoded characters, so they can only be made of such code points.
+static bool is_verbatim_char(const Utf8Iterator* input, const char* expected) {
+  const char* start = utf8iterator_get_char_pointer(input);
+  int c = utf8iterator_current(input);
+  if (start != expected) {
+    return false;
+  }
+  if (c < 0x80) {
+    return (unsigned char) *start == c;
+  }
+  return
+    c != kUtf8ReplacementChar
+    || (
+      utf8iterator_get_end_pointer(input) - start >= 3
+      && !memcmp(start, "\xEF\xBF\xBD", 3)
+    )
+  ;
+}
+
+// Returns true if the `length` bytes at `text` are all HTML whitespace.
+static bool is_all_whitespace(const char* text, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    switch (text[i]) {
+      case '\t':
+      case '\n':
+      case '\f':
+      case ' ':
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+// Returns true if `c` needs no special handling in the states that `mode`
+// scans text for (see GumboScanMode).
+static bool is_run_char(GumboScanMode mode, int c) {
+  if (c == '\0' || c == -1) {
+    return false;
+  }
+  switch (mode) {
+    case GUMBO_SCAN_DATA:
+      return c != '&' && c != '<';
+    case GUMBO_SCAN_RAWTEXT:
+      return c != '<';
+    case GUMBO_SCAN_SCRIPT_ESCAPED:
+      return c != '<' && c != '-';
+    case GUMBO_SCAN_PLAINTEXT:
+      return true;
+    default:
+      assert(false && "not a tokenizer state's scan mode");
+      return false;
+  }
+}
+
+// Writes out the current input character, and any following characters that
+// the current state would just emit unchanged, as a single character run
+// token. `mode` is the set of bytes the state passes through: the data and
+// RCDATA states use GUMBO_SCAN_DATA, the RAWTEXT and script data states
+// GUMBO_SCAN_RAWTEXT, and so on. Falls back to emitting a single character
+// token if the parser can't handle runs or if the current character can't
+// start one.
+// Always returns RETURN_SUCCESS.
+static StateResult emit_character_run (
+  GumboParser* parser,
+  GumboScanMode mode,
+  GumboToken* output
+) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  Utf8Iterator* input = &tokenizer->_input;
+  int c = utf8iterator_current(input);
+  if (
+    !tokenizer->_emit_character_runs
+    || !is_run_char(mode, c)
+    || !is_verbatim_char(input, tokenizer->_token_start)
+  ) {
+    return emit_current_char(parser, output);
+  }
+
+  output->type = GUMBO_TOKEN_WHITESPACE;
+  output->v.character = c;
+  output->is_character_run = true;
+  const char* end = utf8iterator_get_end_pointer(input);
+  const char* next;
+  do {
+    const char* start = utf8iterator_get_char_pointer(input);
+    size_t length = gumbo_scan_text(start, end, mode);
+    next = start + length;
+    if (length > 0) {
+      // Plain ASCII: skip the whole block at once.
+      if (
+        output->type == GUMBO_TOKEN_WHITESPACE
+        && !is_all_whitespace(start, length)
+      ) {
+        output->type = GUMBO_TOKEN_CHARACTER;
+      }
+      utf8iterator_skip_ascii(input, length);
+    } else {
+      if (get_char_token_type(false, c) != GUMBO_TOKEN_WHITESPACE) {
+        output->type = GUMBO_TOKEN_CHARACTER;
+      }
+      next += utf8_encoded_length(c);
+      utf8iterator_next(input);
+    }
+    c = utf8iterator_current(input);
+  } while (is_run_char(mode, c) && is_verbatim_char(input, next));
+
+  // The iterator is already positioned on the character following the run.
+  tokenizer->_reconsume_current_input = true;
+  finish_token(parser, output);
+  return RETURN_SUCCESS;
+}
+
 // Writes out a doctype token, copying it from the tokenizer state.
 static void emit_doctype(GumboParser* parser, GumboToken* output) {
   output->type = GUMBO_TOKEN_DOCTYPE;
@@ -703,6 +887,56 @@ static void append_char_to_tag_buffer (
   gumbo_string_buffer_append_codepoint(codepoint, buffer);
 }
 
+// Appends the current input character to the current tag buffer along with
+// any following characters that the current state would append unchanged,
+// lowercased if `lowercase` is set. `mode` is the set of bytes the state
+// passes through (see GumboScanMode), and reinitilize_position_on_first is as
+// for append_char_to_tag_buffer, which this falls back to if the current
+// character can't start a span. The iterator is left on the character after
+// the span, to be reconsumed.
+// Always returns NEXT_CHAR.
+static StateResult append_span_to_tag_buffer (
+  GumboParser* parser,
+  GumboScanMode mode,
+  bool lowercase,
+  bool reinitilize_position_on_first
+) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  Utf8Iterator* input = &tokenizer->_input;
+  int c = utf8iterator_current(input);
+  const char* start = utf8iterator_get_char_pointer(input);
+  size_t length = 0;
+  if (c >= 0 && c < 0x80 && (unsigned char) *start == c) {
+    length = gumbo_scan_text(start, utf8iterator_get_end_pointer(input), mode);
+  }
+  if (length == 0) {
+    append_char_to_tag_buffer (
+      parser,
+      lowercase ? ensure_lowercase(c) : c,
+      reinitilize_position_on_first
+    );
+    return NEXT_CHAR;
+  }
+
+  GumboStringBuffer* buffer = &tokenizer->_tag_state._buffer;
+  if (buffer->length == 0 && reinitilize_position_on_first) {
+    reset_tag_buffer_start_point(parser);
+  }
+  gumbo_string_buffer_reserve(buffer->length + length, buffer);
+  char* dest = buffer->data + buffer->length;
+  if (lowercase) {
+    for (size_t i = 0; i < length; ++i) {
+      dest[i] = gumbo_ascii_tolower((unsigned char) start[i]);
+    }
+  } else {
+    memcpy(dest, start, length);
+  }
+  buffer->length += length;
+  utf8iterator_skip_ascii(input, length);
+  tokenizer->_reconsume_current_input = true;
+  return NEXT_CHAR;
+}
+
 // (Re-)initialize the tag buffer. This also resets the original_text pointer
 // and _start_pos field to point to the current position.
 static void initialize_tag_buffer(GumboParser* parser) {
@@ -729,11 +963,12 @@ static void start_new_tag(GumboParser* parser, bool is_start_tag) {
 
   assert(tag_state->_name == NULL);
   assert(tag_state->_attributes.data == NULL);
-  // Initial size chosen by statistical analysis of a corpus of 60k webpages.
-  // 99.5% of elements have 0 attributes, 93% of the remainder have 1. These
-  // numbers are a bit higher for more modern websites (eg. ~45% = 0, ~40% = 1
-  // for the HTML5 Spec), but still have basically 99% of nodes with <= 2 attrs.
-  gumbo_vector_init(1, &tag_state->_attributes);
+  // Statistical analysis of a corpus of 60k webpages found that 99.5% of
+  // elements have 0 attributes, 93% of the remainder have 1. These numbers are
+  // a bit higher for more modern websites (eg. ~45% = 0, ~40% = 1 for the HTML5
+  // Spec), so the vector is only allocated once the first attribute is added,
+  // and end tags never allocate one.
+  gumbo_vector_init(0, &tag_state->_attributes);
   tag_state->_drop_next_attr_value = false;
   tag_state->_is_start_tag = is_start_tag;
   tag_state->_is_self_closing = false;
@@ -747,6 +982,34 @@ static void copy_over_tag_buffer(GumboParser* parser, const char** output) {
   *output = gumbo_string_buffer_to_string(&tag_state->_buffer);
 }
 
+// Sets the value of the attribute to the contents of the tag buffer. With
+// GumboOptions.zero_copy_text, a value that's identical to its source text
+// (less the opening quote) points into the source instead of being copied.
+static void copy_over_attribute_value (
+  GumboParser* parser,
+  GumboAttribute* attr
+) {
+  const GumboStringBuffer* buffer =
+    &parser->_tokenizer_state->_tag_state._buffer;
+  attr->value_length = buffer->length;
+  if (parser->_options->zero_copy_text) {
+    const char* source = attr->original_value.data;
+    size_t length = attr->original_value.length;
+    if (length > 0 && (*source == '"' || *source == '\'')) {
+      ++source;
+      --length;
+    }
+    if (
+      buffer->length <= length
+      && !memcmp(source, buffer->data, buffer->length)
+    ) {
+      attr->value = source;
+      return;
+    }
+  }
+  copy_over_tag_buffer(parser, &attr->value);
+}
+
 // Fills in:
 // * The original_text GumboStringPiece with the portion of the original
 // buffer that corresponds to the tag buffer.
@@ -792,10 +1055,7 @@ static void finish_tag_name(GumboParser* parser) {
   size_t length = tag_state->_buffer.length;
   tag_state->_tag = gumbo_tagn_enum(data, length);
   if (tag_state->_tag == GUMBO_TAG_UNKNOWN) {
-    char *name = gumbo_alloc(length + 1);
-    memcpy(name, data, length);
-    name[length] = 0;
-    tag_state->_name = name;
+    tag_state->_name = gumbo_intern(parser->_output->names, data, length);
   }
   reinitialize_tag_buffer(parser);
 }
@@ -807,19 +1067,100 @@ static void add_duplicate_attr_error (
   int new_index
 ) {
   GumboError* error = gumbo_add_error(parser);
-  if (!error) {
-    return;
-  }
-  GumboTagState* tag_state = &parser->_tokenizer_state->_tag_state;
-  error->type = GUMBO_ERR_DUPLICATE_ATTR;
-  error->position = tag_state->_start_pos;
-  error->original_text = tag_state->_original_text;
-  error->v.duplicate_attr.original_index = original_index;
-  error->v.duplicate_attr.new_index = new_index;
-  copy_over_tag_buffer(parser, &error->v.duplicate_attr.name);
+  if (error) {
+    GumboTagState* tag_state = &parser->_tokenizer_state->_tag_state;
+    error->type = GUMBO_ERR_DUPLICATE_ATTR;
+    error->position = tag_state->_start_pos;
+    error->original_text = tag_state->_original_text;
+    error->v.duplicate_attr.original_index = original_index;
+    error->v.duplicate_attr.new_index = new_index;
+    copy_over_tag_buffer(parser, &error->v.duplicate_attr.name);
+  }
+  // The duplicate's name must be dropped even when the error isn't recorded,
+  // or it would be prepended to the next attribute's.
   reinitialize_tag_buffer(parser);
 }
 
+// Below this many attributes, searching them is as quick as the hash set.
+static const unsigned int kMinAttributeSetSize = 8;
+
+// Names are interned, so they can be hashed by address. Fibonacci hashing
+// mixes the low bits, which are all that differ between nearby names, into the
+// high ones.
+static size_t hash_attribute_name(const char* name) {
+  return ((uint64_t) (uintptr_t) name * UINT64_C(0x9E3779B97F4A7C15)) >> 32;
+}
+
+// Returns the slot in the attribute set that holds `name`, or the empty slot
+// where it belongs.
+static unsigned int* find_attribute_slot (
+  const GumboTagState* tag_state,
+  const char* name
+) {
+  size_t mask = tag_state->_attribute_set_capacity - 1;
+  const GumboVector* attributes = &tag_state->_attributes;
+  for (size_t i = hash_attribute_name(name) & mask; ; i = (i + 1) & mask) {
+    unsigned int* slot = &tag_state->_attribute_set[i];
+    if (*slot == 0) {
+      return slot;
+    }
+    const GumboAttribute* attr = attributes->data[*slot - 1];
+    if (attr->name == name) {
+      return slot;
+    }
+  }
+}
+
+// Rebuilds the attribute set from _attributes, with room for at least
+// `min_capacity` slots. It's never more than half full.
+static void rebuild_attribute_set (
+  GumboTagState* tag_state,
+  size_t min_capacity
+) {
+  size_t capacity = tag_state->_attribute_set_capacity;
+  if (capacity < min_capacity) {
+    capacity = capacity ? capacity : 32;
+    while (capacity < min_capacity) {
+      capacity *= 2;
+    }
+    // Kept out of the arena of the document being parsed, which the
+    // tokenizer can outlive.
+    GumboArena* arena = gumbo_set_arena(NULL);
+    gumbo_free(tag_state->_attribute_set);
+    tag_state->_attribute_set = gumbo_alloc(capacity * sizeof(unsigned int));
+    gumbo_set_arena(arena);
+    tag_state->_attribute_set_capacity = capacity;
+  }
+  memset(tag_state->_attribute_set, 0, capacity * sizeof(unsigned int));
+  const GumboVector* attributes = &tag_state->_attributes;
+  for (unsigned int i = 0; i < attributes->length; ++i) {
+    const GumboAttribute* attr = attributes->data[i];
+    *find_attribute_slot(tag_state, attr->name) = i + 1;
+  }
+}
+
+// Returns the index in the current tag's attributes of the one named `name`
+// (an interned string), or -1 if there isn't one.
+static int find_attribute_name(GumboTagState* tag_state, const char* name) {
+  const GumboVector* attributes = &tag_state->_attributes;
+  if (attributes->length < kMinAttributeSetSize) {
+    for (unsigned int i = 0; i < attributes->length; ++i) {
+      const GumboAttribute* attr = attributes->data[i];
+      if (attr->name == name) {
+        return i;
+      }
+    }
+    return -1;
+  }
+  // The set is started afresh as each tag reaches the threshold, and then kept
+  // up to date by finish_attribute_name.
+  if (attributes->length == kMinAttributeSetSize) {
+    rebuild_attribute_set(tag_state, 4 * kMinAttributeSetSize);
+  }
+  unsigned int slot = *find_attribute_slot(tag_state, name);
+  return (int) slot - 1;
+}
+
 // Creates a new attribute in the current tag, copying the current tag buffer to
 // the attribute's name. The attribute's value starts out as the empty string
 // (following the "Boolean attributes" section of the spec) and is only
@@ -831,44 +1172,51 @@ static bool finish_attribute_name(GumboParser* parser) {
   GumboTagState* tag_state = &tokenizer->_tag_state;
   // May've been set by a previous attribute without a value; reset it here.
   tag_state->_drop_next_attr_value = false;
-  assert(tag_state->_attributes.data);
-  assert(tag_state->_attributes.capacity);
 
+  const char* name = gumbo_intern (
+    parser->_output->names,
+    tag_state->_buffer.data,
+    tag_state->_buffer.length
+  );
   GumboVector* /* GumboAttribute* */ attributes = &tag_state->_attributes;
-  for (unsigned int i = 0; i < attributes->length; ++i) {
-    GumboAttribute* attr = attributes->data[i];
-    if (
-      strlen(attr->name) == tag_state->_buffer.length
-      && 0 == memcmp (
-        attr->name,
-        tag_state->_buffer.data,
-        tag_state->_buffer.length
-      )
-    ) {
-      // Identical attribute; bail.
-      add_duplicate_attr_error(parser, i, attributes->length);
-      tag_state->_drop_next_attr_value = true;
-      return false;
-    }
+  int duplicate = find_attribute_name(tag_state, name);
+  if (duplicate >= 0) {
+    // Identical attribute; bail.
+    add_duplicate_attr_error(parser, duplicate, attributes->length);
+    tag_state->_drop_next_attr_value = true;
+    return false;
   }
 
   GumboAttribute* attr = gumbo_alloc(sizeof(GumboAttribute));
   attr->attr_namespace = GUMBO_ATTR_NAMESPACE_NONE;
-  copy_over_tag_buffer(parser, &attr->name);
+  attr->name = name;
   copy_over_original_tag_text (
     parser,
     &attr->original_name,
     &attr->name_start,
     &attr->name_end
   );
-  attr->value = gumbo_strdup("");
   copy_over_original_tag_text (
     parser,
     &attr->original_value,
     &attr->name_start,
     &attr->name_end
   );
+  // Until a value is seen, it's empty and sits at the end of the name.
+  attr->value_start = attr->name_end;
+  attr->value_end = attr->name_end;
+  attr->value = parser->_options->zero_copy_text
+    ? attr->original_value.data
+    : gumbo_strdup("");
+  attr->value_length = 0;
   gumbo_vector_add(attr, attributes);
+  if (attributes->length > kMinAttributeSetSize) {
+    if (2 * attributes->length > tag_state->_attribute_set_capacity) {
+      rebuild_attribute_set(tag_state, 2 * tag_state->_attribute_set_capacity);
+    } else {
+      *find_attribute_slot(tag_state, name) = attributes->length;
+    }
+  }
   reinitialize_tag_buffer(parser);
   return true;
 }
@@ -887,10 +1235,12 @@ static void finish_attribute_value(GumboParser* parser) {
 
   GumboAttribute* attr =
       tag_state->_attributes.data[tag_state->_attributes.length - 1];
-  gumbo_free((void*) attr->value);
-  copy_over_tag_buffer(parser, &attr->value);
+  if (gumbo_attribute_owns_value(attr)) {
+    gumbo_free((void*) attr->value);
+  }
   copy_over_original_tag_text(
       parser, &attr->original_value, &attr->value_start, &attr->value_end);
+  copy_over_attribute_value(parser, attr);
   reinitialize_tag_buffer(parser);
 }
 
@@ -910,20 +1260,36 @@ void gumbo_tokenizer_state_init (
 ) {
   GumboTokenizerState* tokenizer = gumbo_alloc(sizeof(GumboTokenizerState));
   parser->_tokenizer_state = tokenizer;
+  gumbo_string_buffer_init(&tokenizer->_temporary_buffer);
+  gumbo_string_buffer_init(&tokenizer->_script_data_buffer);
+  tokenizer->_tag_state._attribute_set = NULL;
+  tokenizer->_tag_state._attribute_set_capacity = 0;
+  gumbo_tokenizer_state_reset(parser, text, text_length);
+}
+
+void gumbo_tokenizer_state_reset (
+  GumboParser* parser,
+  const char* text,
+  size_t text_length
+) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
   gumbo_tokenizer_set_state(parser, GUMBO_LEX_DATA);
   tokenizer->_reconsume_current_input = false;
   tokenizer->_is_current_node_foreign = false;
   tokenizer->_is_in_cdata = false;
+  tokenizer->_emit_character_runs = false;
+  tokenizer->_needs_input = false;
+  tokenizer->_tag_state._original_text = text;
   tokenizer->_tag_state._last_start_tag = GUMBO_TAG_LAST;
   tokenizer->_tag_state._name = NULL;
 
   tokenizer->_buffered_emit_char = kGumboNoChar;
-  gumbo_string_buffer_init(&tokenizer->_temporary_buffer);
+  gumbo_string_buffer_clear(&tokenizer->_temporary_buffer);
   tokenizer->_temporary_buffer_emit = NULL;
 
   mark_tag_state_as_empty(&tokenizer->_tag_state);
 
-  gumbo_string_buffer_init(&tokenizer->_script_data_buffer);
+  gumbo_string_buffer_clear(&tokenizer->_script_data_buffer);
   tokenizer->_token_start = text;
   utf8iterator_init(parser, text, text_length, &tokenizer->_input);
   utf8iterator_get_position(&tokenizer->_input, &tokenizer->_token_start_pos);
@@ -939,6 +1305,7 @@ void gumbo_tokenizer_state_destroy(GumboParser* parser) {
   gumbo_string_buffer_destroy(&tokenizer->_script_data_buffer);
   assert(tokenizer->_tag_state._name == NULL);
   assert(tokenizer->_tag_state._attributes.data == NULL);
+  gumbo_free(tokenizer->_tag_state._attribute_set);
   gumbo_free(tokenizer);
 }
 
@@ -959,6 +1326,13 @@ void gumbo_tokenizer_set_is_current_node_foreign (
   parser->_tokenizer_state->_is_current_node_foreign = is_foreign;
 }
 
+void gumbo_tokenizer_set_emit_character_runs (
+  GumboParser* parser,
+  bool emit
+) {
+  parser->_tokenizer_state->_emit_character_runs = emit;
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#data-state
 static StateResult handle_data_state (
   GumboParser* parser,
@@ -984,7 +1358,7 @@ static StateResult handle_data_state (
       emit_char(parser, c, output);
       return RETURN_ERROR;
     default:
-      return emit_current_char(parser, output);
+      return emit_character_run(parser, GUMBO_SCAN_DATA, output);
   }
 }
 
@@ -1021,7 +1395,7 @@ static StateResult handle_rcdata_state (
     case -1:
       return emit_eof(parser, output);
     default:
-      return emit_current_char(parser, output);
+      return emit_character_run(parser, GUMBO_SCAN_DATA, output);
   }
 }
 
@@ -1054,7 +1428,7 @@ static StateResult handle_rawtext_state (
     case -1:
       return emit_eof(parser, output);
     default:
-      return emit_current_char(parser, output);
+      return emit_character_run(parser, GUMBO_SCAN_RAWTEXT, output);
   }
 }
 
@@ -1076,7 +1450,7 @@ static StateResult handle_script_state (
     case -1:
       return emit_eof(parser, output);
     default:
-      return emit_current_char(parser, output);
+      return emit_character_run(parser, GUMBO_SCAN_RAWTEXT, output);
   }
 }
 
@@ -1093,7 +1467,7 @@ static StateResult handle_plaintext_state (
     case -1:
       return emit_eof(parser, output);
     default:
-      return emit_current_char(parser, output);
+      return emit_character_run(parser, GUMBO_SCAN_PLAINTEXT, output);
   }
 }
 
@@ -1198,8 +1572,7 @@ static StateResult handle_tag_name_state (
       gumbo_tokenizer_set_state(parser, GUMBO_LEX_DATA);
       return NEXT_CHAR;
     default:
-      append_char_to_tag_buffer(parser, ensure_lowercase(c), true);
-      return NEXT_CHAR;
+      return append_span_to_tag_buffer(parser, GUMBO_SCAN_TAG_NAME, true, true);
   }
 }
 
@@ -1491,7 +1864,7 @@ static StateResult handle_script_escaped_state (
       tokenizer_add_parse_error(parser, GUMBO_ERR_SCRIPT_EOF);
       return emit_eof(parser, output);
     default:
-      return emit_current_char(parser, output);
+      return emit_character_run(parser, GUMBO_SCAN_SCRIPT_ESCAPED, output);
   }
 }
 
@@ -1698,7 +2071,7 @@ static StateResult handle_script_double_escaped_state (
       gumbo_tokenizer_set_state(parser, GUMBO_LEX_DATA);
       return NEXT_CHAR;
     default:
-      return emit_current_char(parser, output);
+      return emit_character_run(parser, GUMBO_SCAN_SCRIPT_ESCAPED, output);
   }
 }
 
@@ -1896,8 +2269,12 @@ static StateResult handle_attr_name_state (
       tokenizer_add_parse_error(parser, GUMBO_ERR_ATTR_NAME_INVALID);
     // Fall through.
     default:
-      append_char_to_tag_buffer(parser, ensure_lowercase(c), true);
-      return NEXT_CHAR;
+      return append_span_to_tag_buffer (
+        parser,
+        GUMBO_SCAN_ATTR_NAME,
+        true,
+        true
+      );
   }
 }
 
@@ -2025,8 +2402,12 @@ static StateResult handle_attr_value_double_quoted_state (
       tokenizer->_reconsume_current_input = true;
       return NEXT_CHAR;
     default:
-      append_char_to_tag_buffer(parser, c, false);
-      return NEXT_CHAR;
+      return append_span_to_tag_buffer (
+        parser,
+        GUMBO_SCAN_ATTR_VALUE_DOUBLE_QUOTED,
+        false,
+        false
+      );
   }
 }
 
@@ -2057,8 +2438,12 @@ static StateResult handle_attr_value_single_quoted_state (
       tokenizer->_reconsume_current_input = true;
       return NEXT_CHAR;
     default:
-      append_char_to_tag_buffer(parser, c, false);
-      return NEXT_CHAR;
+      return append_span_to_tag_buffer (
+        parser,
+        GUMBO_SCAN_ATTR_VALUE_SINGLE_QUOTED,
+        false,
+        false
+      );
   }
 }
 
@@ -2104,8 +2489,12 @@ static StateResult handle_attr_value_unquoted_state (
       tokenizer_add_parse_error(parser, GUMBO_ERR_ATTR_UNQUOTED_EQUALS);
     // Fall through.
     default:
-      append_char_to_tag_buffer(parser, c, true);
-      return NEXT_CHAR;
+      return append_span_to_tag_buffer (
+        parser,
+        GUMBO_SCAN_ATTR_VALUE_UNQUOTED,
+        false,
+        true
+      );
   }
 }
 
@@ -2228,7 +2617,15 @@ static StateResult handle_bogus_comment_state (
   int c,
   GumboToken* output
 ) {
-  while (c != '>' && c != -1) {
+  while (c != '>') {
+    if (!has_lookahead(&tokenizer->_input, c)) {
+      // Partial input ran out; carry on from here once there's more.
+      tokenizer->_reconsume_current_input = true;
+      return NEXT_CHAR;
+    }
+    if (c == -1) {
+      break;
+    }
     if (c == '\0') {
       tokenizer_add_parse_error(parser, GUMBO_ERR_UTF8_NULL);
       c = 0xFFFD;
@@ -3140,17 +3537,35 @@ typedef StateResult (*GumboLexerStateFunction) (
   GumboToken* output
 );
 
-static GumboLexerStateFunction dispatch_table[] = {
-  handle_data_state,
+// The states that most of the input goes through, whose handlers gumbo_lex
+// calls directly so that they can be inlined into it.
+#define FOR_EACH_HOT_STATE(X) \
+  X(GUMBO_LEX_DATA, handle_data_state) \
+  X(GUMBO_LEX_TAG_OPEN, handle_tag_open_state) \
+  X(GUMBO_LEX_END_TAG_OPEN, handle_end_tag_open_state) \
+  X(GUMBO_LEX_TAG_NAME, handle_tag_name_state) \
+  X(GUMBO_LEX_BEFORE_ATTR_NAME, handle_before_attr_name_state) \
+  X(GUMBO_LEX_ATTR_NAME, handle_attr_name_state) \
+  X(GUMBO_LEX_AFTER_ATTR_NAME, handle_after_attr_name_state) \
+  X(GUMBO_LEX_BEFORE_ATTR_VALUE, handle_before_attr_value_state) \
+  X(GUMBO_LEX_ATTR_VALUE_DOUBLE_QUOTED, handle_attr_value_double_quoted_state) \
+  X(GUMBO_LEX_ATTR_VALUE_SINGLE_QUOTED, handle_attr_value_single_quoted_state) \
+  X(GUMBO_LEX_ATTR_VALUE_UNQUOTED, handle_attr_value_unquoted_state) \
+  X(GUMBO_LEX_AFTER_ATTR_VALUE_QUOTED, handle_after_attr_value_quoted_state) \
+  X(GUMBO_LEX_SELF_CLOSING_START_TAG, handle_self_closing_start_tag_state)
+// The handlers for every other state, indexed by state. The hot ones are
+// left out, so that their only caller is gumbo_lex.
+static const GumboLexerStateFunction dispatch_table[] = {
+  NULL, // GUMBO_LEX_DATA
   handle_char_ref_in_data_state,
   handle_rcdata_state,
   handle_char_ref_in_rcdata_state,
   handle_rawtext_state,
   handle_script_state,
   handle_plaintext_state,
-  handle_tag_open_state,
-  handle_end_tag_open_state,
-  handle_tag_name_state,
+  NULL, // GUMBO_LEX_TAG_OPEN
+  NULL, // GUMBO_LEX_END_TAG_OPEN
+  NULL, // GUMBO_LEX_TAG_NAME
   handle_rcdata_lt_state,
   handle_rcdata_end_tag_open_state,
   handle_rcdata_end_tag_name_state,
@@ -3174,16 +3589,16 @@ static GumboLexerStateFunction dispatch_table[] = {
   handle_script_double_escaped_dash_dash_state,
   handle_script_double_escaped_lt_state,
   handle_script_double_escaped_end_state,
-  handle_before_attr_name_state,
-  handle_attr_name_state,
-  handle_after_attr_name_state,
-  handle_before_attr_value_state,
-  handle_attr_value_double_quoted_state,
-  handle_attr_value_single_quoted_state,
-  handle_attr_value_unquoted_state,
+  NULL, // GUMBO_LEX_BEFORE_ATTR_NAME
+  NULL, // GUMBO_LEX_ATTR_NAME
+  NULL, // GUMBO_LEX_AFTER_ATTR_NAME
+  NULL, // GUMBO_LEX_BEFORE_ATTR_VALUE
+  NULL, // GUMBO_LEX_ATTR_VALUE_DOUBLE_QUOTED
+  NULL, // GUMBO_LEX_ATTR_VALUE_SINGLE_QUOTED
+  NULL, // GUMBO_LEX_ATTR_VALUE_UNQUOTED
   handle_char_ref_in_attr_value_state,
-  handle_after_attr_value_quoted_state,
-  handle_self_closing_start_tag_state,
+  NULL, // GUMBO_LEX_AFTER_ATTR_VALUE_QUOTED
+  NULL, // GUMBO_LEX_SELF_CLOSING_START_TAG
   handle_bogus_comment_state,
   handle_markup_declaration_state,
   handle_comment_start_state,
@@ -3211,6 +3626,123 @@ static GumboLexerStateFunction dispatch_table[] = {
   handle_cdata_state
 };
 
+const char* gumbo_tokenizer_get_input_floor(const GumboParser* parser) {
+  const GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  const char* floor = tokenizer->_token_start;
+  if (tokenizer->_tag_state._original_text < floor) {
+    floor = tokenizer->_tag_state._original_text;
+  }
+  if (tokenizer->_input._mark < floor) {
+    floor = tokenizer->_input._mark;
+  }
+  if (tokenizer->_input._start < floor) {
+    floor = tokenizer->_input._start;
+  }
+  return floor;
+}
+
+void gumbo_tokenizer_move_input (
+  GumboParser* parser,
+  const char* from,
+  const char* to,
+  const char* end,
+  bool is_partial
+) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  Utf8Iterator* input = &tokenizer->_input;
+  assert(from <= gumbo_tokenizer_get_input_floor(parser));
+  GumboSourcePosition before;
+  utf8iterator_get_position(input, &before);
+  tokenizer->_token_start = to + (tokenizer->_token_start - from);
+  tokenizer->_tag_state._original_text =
+    to + (tokenizer->_tag_state._original_text - from);
+  utf8iterator_move_input(input, from, to, end, is_partial);
+
+  GumboSourcePosition after;
+  utf8iterator_get_position(input, &after);
+  if (
+    after.offset != before.offset
+    && before.offset == tokenizer->_token_start_pos.offset
+  ) {
+    // Reading an incomplete character again skipped a carriage return, which
+    // is done before the token start is recorded when the whole input is
+    // available. At the very start of the input, that's done by
+    // gumbo_tokenizer_state_init, which leaves the pointer where it was.
+    if (tokenizer->_token_start_pos.offset != 0) {
+      tokenizer->_token_start = utf8iterator_get_char_pointer(input);
+    }
+    tokenizer->_token_start_pos = after;
+  }
+}
+
+bool gumbo_tokenizer_needs_input(const GumboParser* parser) {
+  return parser->_tokenizer_state->_needs_input;
+}
+
+bool gumbo_tokenizer_is_between_tokens(const GumboParser* parser) {
+  const GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  const GumboStringBuffer* buffer = &tokenizer->_temporary_buffer;
+  return
+    tokenizer->_state == GUMBO_LEX_DATA
+    && tokenizer->_buffered_emit_char == kGumboNoChar
+    && (
+      !tokenizer->_temporary_buffer_emit
+      || tokenizer->_temporary_buffer_emit >= buffer->data + buffer->length
+    )
+  ;
+}
+
+const char* gumbo_tokenizer_get_token_start (
+  const GumboParser* parser,
+  GumboSourcePosition* position
+) {
+  const GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  *position = tokenizer->_token_start_pos;
+  return tokenizer->_token_start;
+}
+
+void gumbo_tokenizer_seek (
+  GumboParser* parser,
+  const char* to,
+  const GumboSourcePosition* position
+) {
+  GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  assert(tokenizer->_buffered_emit_char == kGumboNoChar);
+  tokenizer->_temporary_buffer_emit = NULL;
+  utf8iterator_seek(&tokenizer->_input, to, position);
+  tokenizer->_token_start = to;
+  tokenizer->_token_start_pos = *position;
+}
+
+bool gumbo_tokenizer_would_emit(GumboParser* parser, const GumboToken* token) {
+  const GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  if (!gumbo_tokenizer_is_between_tokens(parser)) {
+    return false;
+  }
+  bool is_text =
+    token->type == GUMBO_TOKEN_CHARACTER
+    || token->type == GUMBO_TOKEN_WHITESPACE;
+  if (is_text && token->is_character_run && !tokenizer->_emit_character_runs) {
+    return false;
+  }
+  // In foreign content this would have started a CDATA section.
+  static const char kCdataStart[] = "<![CDATA[";
+  const size_t length = sizeof(kCdataStart) - 1;
+  return !(
+    tokenizer->_is_current_node_foreign
+    && token->type == GUMBO_TOKEN_COMMENT
+    && token->original_text.length >= length
+    && !memcmp(token->original_text.data, kCdataStart, length)
+  );
+}
+
+void gumbo_tokenizer_note_token(GumboParser* parser, const GumboToken* token) {
+  if (token->type == GUMBO_TOKEN_START_TAG) {
+    parser->_tokenizer_state->_tag_state._last_start_tag =
+      token->v.start_tag.tag;
+  }
+}
+
 bool gumbo_lex(GumboParser* parser, GumboToken* output) {
   // Because of the spec requirements that...
   //
@@ -3227,6 +3759,7 @@ bool gumbo_lex(GumboParser* parser, GumboToken* output) {
   // are responsible for changing state (eg. flushing the chardata buffer,
   // reading the next input character) to avoid an infinite loop.
   GumboTokenizerState* tokenizer = parser->_tokenizer_state;
+  tokenizer->_needs_input = false;
 
   if (tokenizer->_buffered_emit_char != kGumboNoChar) {
     tokenizer->_reconsume_current_input = true;
@@ -3243,28 +3776,108 @@ bool gumbo_lex(GumboParser* parser, GumboToken* output) {
     return true;
   }
 
-  while (1) {
-    assert(!tokenizer->_temporary_buffer_emit);
-    assert(tokenizer->_buffered_emit_char == kGumboNoChar);
-    int c = utf8iterator_current(&tokenizer->_input);
-    GumboTokenizerEnum state = tokenizer->_state;
-    gumbo_debug("Lexing character '%c' (%d) in state %u.\n", c, c, state);
-    StateResult result = dispatch_table[state](parser, tokenizer, c, output);
-    // We need to clear reconsume_current_input before returning to prevent
-    // certain infinite loop states.
-    bool should_advance = !tokenizer->_reconsume_current_input;
-    tokenizer->_reconsume_current_input = false;
+  Utf8Iterator* input = &tokenizer->_input;
+  StateResult result;
+  int c;
+
+#ifdef USE_COMPUTED_GOTO
+  // Every state jumps to cold_state, except for the hot ones, which override
+  // that with their own labels.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Woverride-init"
+  static const void* const kStateLabels[GUMBO_LEX_CDATA + 1] = {
+    [0 ... GUMBO_LEX_CDATA] = &&cold_state,
+#define STATE_LABEL(state, handler) [state] = &&state##_label,
+    FOR_EACH_HOT_STATE(STATE_LABEL)
+#undef STATE_LABEL
+  };
+#pragma GCC diagnostic pop
+#endif
 
-    if (result == RETURN_SUCCESS) {
-      return true;
-    } else if (result == RETURN_ERROR) {
-      return false;
-    }
+  // Reads the current character and jumps to the current state's handler.
+  // With computed gotos, every hot state has a copy of this jump of its own,
+  // so that the transitions out of each state are predicted separately.
+#ifdef USE_COMPUTED_GOTO
+#define DISPATCH() \
+  do { \
+    assert(!tokenizer->_temporary_buffer_emit); \
+    assert(tokenizer->_buffered_emit_char == kGumboNoChar); \
+    c = utf8iterator_current(input); \
+    if (unlikely(!has_lookahead(input, c))) { \
+      goto needs_input; \
+    } \
+    gumbo_debug( \
+      "Lexing character '%c' (%d) in state %u.\n", c, c, tokenizer->_state \
+    ); \
+    goto *kStateLabels[tokenizer->_state]; \
+  } while (0)
+#else
+#define DISPATCH() goto next_char
+#endif
 
-    if (should_advance) {
-      utf8iterator_next(&tokenizer->_input);
-    }
+  // Returns the token or error from a handler, or moves on to the next
+  // character, unless the handler asked for this one to be reconsumed. The
+  // flag is cleared either way, to avoid reconsuming the same character
+  // forever.
+#define FINISH_STATE() \
+  do { \
+    bool should_advance = !tokenizer->_reconsume_current_input; \
+    tokenizer->_reconsume_current_input = false; \
+    if (result == RETURN_SUCCESS) { \
+      return true; \
+    } else if (result == RETURN_ERROR) { \
+      return false; \
+    } \
+    if (should_advance) { \
+      utf8iterator_next_inline(input); \
+    } \
+    DISPATCH(); \
+  } while (0)
+
+#ifdef USE_COMPUTED_GOTO
+  DISPATCH();
+
+#define HOT_STATE(state, handler) \
+  state##_label: \
+    result = handler(parser, tokenizer, c, output); \
+    FINISH_STATE();
+  FOR_EACH_HOT_STATE(HOT_STATE)
+#undef HOT_STATE
+
+cold_state:
+  result = dispatch_table[tokenizer->_state](parser, tokenizer, c, output);
+  FINISH_STATE();
+#else
+next_char:
+  assert(!tokenizer->_temporary_buffer_emit);
+  assert(tokenizer->_buffered_emit_char == kGumboNoChar);
+  c = utf8iterator_current(input);
+  if (unlikely(!has_lookahead(input, c))) {
+    goto needs_input;
+  }
+  gumbo_debug(
+    "Lexing character '%c' (%d) in state %u.\n", c, c, tokenizer->_state
+  );
+  switch (tokenizer->_state) {
+#define HOT_STATE(state, handler) \
+    case state: \
+      result = handler(parser, tokenizer, c, output); \
+      break;
+    FOR_EACH_HOT_STATE(HOT_STATE)
+#undef HOT_STATE
+    default:
+      result = dispatch_table[tokenizer->_state](parser, tokenizer, c, output);
+      break;
   }
+  FINISH_STATE();
+#endif
+
+#undef FINISH_STATE
+#undef DISPATCH
+
+needs_input:
+  tokenizer->_needs_input = true;
+  return true;
 }
 
 void gumbo_token_destroy(GumboToken* token) {
@@ -3285,13 +3898,7 @@ void gumbo_token_destroy(GumboToken* token) {
         }
       }
       gumbo_free((void*) token->v.start_tag.attributes.data);
-      if (token->v.start_tag.tag == GUMBO_TAG_UNKNOWN)
-        gumbo_free(token->v.start_tag.name);
       return;
-    case GUMBO_TOKEN_END_TAG:
-      if (token->v.end_tag.tag == GUMBO_TAG_UNKNOWN)
-        gumbo_free(token->v.end_tag.name);
-      break;
     case GUMBO_TOKEN_COMMENT:
       gumbo_free((void*) token->v.text);
       return;
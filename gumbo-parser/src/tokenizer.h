@@ -33,8 +33,8 @@ typedef struct GumboInternalTokenDocType {
 // Struct containing all information pertaining to start tag tokens.
 typedef struct GumboInternalTokenStartTag {
   GumboTag tag;
-  // NULL unless tag is GUMBO_TAG_UNKNOWN
-  char *name;
+  // NULL unless tag is GUMBO_TAG_UNKNOWN. Interned (see intern.h).
+  const char* name;
   GumboVector /* GumboAttribute */ attributes;
   bool is_self_closing;
 } GumboTokenStartTag;
@@ -42,8 +42,8 @@ typedef struct GumboInternalTokenStartTag {
 // Struct containing all information pertaining to end tag tokens.
 typedef struct GumboInternalTokenEndTag {
   GumboTag tag;
-  // NULL unless tag is GUMBO_TAG_UNKNOWN
-  char *name;
+  // NULL unless tag is GUMBO_TAG_UNKNOWN. Interned (see intern.h).
+  const char* name;
   bool is_self_closing;
 } GumboTokenEndTag;
 
@@ -61,6 +61,12 @@ typedef struct GumboInternalToken {
     const char* text;  // For comments.
     int character;     // For character, whitespace, null, and EOF tokens.
   } v;
+  // Set on character and whitespace tokens that stand for a whole run of text
+  // rather than just v.character (which is then its first code point). The
+  // text of a run never needs decoding, so it is exactly original_text. A run
+  // is a GUMBO_TOKEN_WHITESPACE token only if it's all whitespace. Runs are
+  // only emitted after gumbo_tokenizer_set_emit_character_runs(parser, true).
+  bool is_character_run;
 } GumboToken;
 
 // Initializes the tokenizer state within the GumboParser object, setting up a
@@ -71,6 +77,15 @@ void gumbo_tokenizer_state_init (
   size_t text_length
 );
 
+// Sets up a parse of the specified text with a tokenizer state that has
+// already been initialized, and has reached the end of its previous input.
+// The state's buffers keep the capacity they had.
+void gumbo_tokenizer_state_reset (
+  struct GumboInternalParser* parser,
+  const char* text,
+  size_t text_length
+);
+
 // Destroys the tokenizer state within the GumboParser object, freeing any
 // dynamically-allocated structures within it.
 void gumbo_tokenizer_state_destroy(struct GumboInternalParser* parser);
@@ -92,9 +107,84 @@ void gumbo_tokenizer_set_is_current_node_foreign (
   bool is_foreign
 );
 
+// Flags whether the parser can currently handle character run tokens, which
+// is only the case in insertion modes that treat every character of a run the
+// same way.
+void gumbo_tokenizer_set_emit_character_runs (
+  struct GumboInternalParser* parser,
+  bool emit
+);
+
+// Returns the earliest point in the input that the tokenizer may still need to
+// look at, or refer to in the original_text of a token. Everything before it
+// can be left behind when the input is moved (see gumbo_tokenizer_move_input).
+const char* gumbo_tokenizer_get_input_floor (
+  const struct GumboInternalParser* parser
+);
+
+// Points the tokenizer at a new copy of its input, for incremental parsing.
+// Everything from `from` (which must be no later than the input floor) to the
+// old end of the input must have been copied to `to`, and the new input ends
+// at `end`. If `is_partial` is set, more input may be added later.
+void gumbo_tokenizer_move_input (
+  struct GumboInternalParser* parser,
+  const char* from,
+  const char* to,
+  const char* end,
+  bool is_partial
+);
+
+// Returns true if the last call to gumbo_lex stopped without producing a token
+// because it had consumed all the input available so far. Only partial input
+// can run out like this; see gumbo_tokenizer_move_input.
+bool gumbo_tokenizer_needs_input(const struct GumboInternalParser* parser);
+
+// The remaining functions let tokens lexed speculatively by another tokenizer
+// over the same input (see speculation.h) stand in for tokens this one would
+// have lexed.
+
+// Returns true if the tokenizer is in the data state, with nothing left over
+// from the last token, so that the next token is lexed from scratch starting
+// at gumbo_tokenizer_get_token_start.
+bool gumbo_tokenizer_is_between_tokens(
+  const struct GumboInternalParser* parser
+);
+
+// Returns the point in the input where the next token starts, and fills in
+// its position.
+const char* gumbo_tokenizer_get_token_start (
+  const struct GumboInternalParser* parser,
+  GumboSourcePosition* position
+);
+
+// Moves the tokenizer to the start of a token at `to`, keeping its current
+// state. It must not have a character reference's second code point left to
+// emit.
+void gumbo_tokenizer_seek (
+  struct GumboInternalParser* parser,
+  const char* to,
+  const GumboSourcePosition* position
+);
+
+// Returns true if `token`, lexed from the data state by a tokenizer emitting
+// character runs outside of foreign content, starting at this tokenizer's
+// token start, is the token this tokenizer would emit there now.
+bool gumbo_tokenizer_would_emit (
+  struct GumboInternalParser* parser,
+  const GumboToken* token
+);
+
+// Updates the tokenizer for a token that was taken from elsewhere in place of
+// the one it would have lexed, as if it had lexed it itself.
+void gumbo_tokenizer_note_token (
+  struct GumboInternalParser* parser,
+  const GumboToken* token
+);
+
 // Lexes a single token from the specified buffer, filling the output with the
 // parsed GumboToken data structure. Returns true for a successful
-// tokenization, false if a parse error occurs.
+// tokenization, false if a parse error occurs. When the input is partial, the
+// output may instead be left untouched if gumbo_tokenizer_needs_input.
 //
 // Example:
 //   struct GumboInternalParser parser;
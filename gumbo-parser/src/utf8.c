@@ -25,6 +25,7 @@
 #include "gumbo.h"
 #include "parser.h"
 #include "ascii.h"
+#include "scan.h"
 #include "vector.h"
 
 const int kUtf8ReplacementChar = 0xFFFD;
@@ -117,6 +118,13 @@ static void add_error(Utf8Iterator* iter, GumboErrorType type) {
 // When this method returns, iter->_width and iter->_current will be set
 // appropriately, as well as any error flags.
 static void read_char(Utf8Iterator* iter) {
+  if (likely(iter->_start < iter->_ascii_end)) {
+    assert(iter->_start >= iter->_ascii_start);
+    iter->_current = (unsigned char) *iter->_start;
+    iter->_width = 1;
+    return;
+  }
+
   if (iter->_start >= iter->_end) {
     // No input left to consume; emit an EOF and set width = 0.
     iter->_current = -1;
@@ -124,6 +132,21 @@ static void read_char(Utf8Iterator* iter) {
     return;
   }
 
+  // Most input is ASCII, so validate as much of it as possible in one go and
+  // read it through the fast path above. Anything the scan stops at (CR,
+  // invalid code points and non-ASCII characters) goes through the decoder.
+  if ((unsigned char) *iter->_start < 0x80) {
+    size_t length =
+      gumbo_scan_text(iter->_start, iter->_end, GUMBO_SCAN_ASCII);
+    if (length > 0) {
+      iter->_ascii_start = iter->_start;
+      iter->_ascii_end = iter->_start + length;
+      iter->_current = (unsigned char) *iter->_start;
+      iter->_width = 1;
+      return;
+    }
+  }
+
   uint32_t code_point = 0;
   uint32_t state = UTF8_ACCEPT;
   for (const char* c = iter->_start; c < iter->_end; ++c) {
@@ -138,6 +161,9 @@ static void read_char(Utf8Iterator* iter) {
       if (code_point == '\r') {
         assert(iter->_width == 1);
         const char* next = c + 1;
+        if (next == iter->_end && iter->_is_partial) {
+          break;
+        }
         if (next < iter->_end && *next == '\n') {
           // Advance the iter, as if the carriage return didn't exist.
           ++iter->_start;
@@ -165,7 +191,13 @@ static void read_char(Utf8Iterator* iter) {
     }
   }
   // If we got here without exiting early, then we've reached the end of the
-  // iterator. Add an error for truncated input, set the width to consume the
+  // iterator. If more input is on its way, the character isn't complete yet.
+  if (iter->_is_partial) {
+    iter->_current = -1;
+    iter->_width = 0;
+    return;
+  }
+  // Otherwise, add an error for truncated input, set the width to consume the
   // rest of the iterator, and emit a replacement character. The next time we
   // enter this method, it will detect that there's no input to consume and
   // output an EOF.
@@ -174,8 +206,25 @@ static void read_char(Utf8Iterator* iter) {
   add_error(iter, GUMBO_ERR_UTF8_TRUNCATED);
 }
 
+size_t utf8_char_width(const char* c, const char* end) {
+  uint32_t code_point = 0;
+  uint32_t state = UTF8_ACCEPT;
+  for (const char* p = c; p < end; ++p) {
+    decode(&state, &code_point, (uint32_t)(unsigned char) (*p));
+    if (state == UTF8_ACCEPT) {
+      return p - c + 1;
+    } else if (state == UTF8_REJECT) {
+      return p - c + (p == c);
+    }
+  }
+  return end - c;
+}
+
 static void update_position(Utf8Iterator* iter) {
   iter->_pos.offset += iter->_width;
+  if (!iter->_track_lines) {
+    return;
+  }
   if (iter->_current == '\n') {
     ++iter->_pos.line;
     iter->_pos.column = 1;
@@ -209,9 +258,15 @@ void utf8iterator_init (
 ) {
   iter->_start = source;
   iter->_end = source + source_length;
-  iter->_pos.line = 1;
-  iter->_pos.column = 1;
+  iter->_ascii_start = source;
+  iter->_ascii_end = source;
+  iter->_track_lines = !parser->_options->lazy_positions;
+  iter->_pos.line = iter->_track_lines ? 1 : 0;
+  iter->_pos.column = iter->_track_lines ? 1 : 0;
   iter->_pos.offset = 0;
+  iter->_is_partial = false;
+  iter->_mark = source;
+  iter->_mark_pos = iter->_pos;
   iter->_parser = parser;
   read_char(iter);
 }
@@ -224,6 +279,79 @@ void utf8iterator_next(Utf8Iterator* iter) {
   read_char(iter);
 }
 
+void utf8iterator_skip_ascii(Utf8Iterator* iter, size_t length) {
+  const char* p = iter->_start;
+  const char* end = p + length;
+  assert(length > 0 && end <= iter->_end);
+  iter->_pos.offset += length;
+  if (!iter->_track_lines) {
+    iter->_start = end;
+    read_char(iter);
+    return;
+  }
+  // Only the text after the last newline affects the column.
+  const char* newline;
+  while ((newline = memchr(p, '\n', end - p))) {
+    ++iter->_pos.line;
+    iter->_pos.column = 1;
+    p = newline + 1;
+  }
+  if (!memchr(p, '\t', end - p)) {
+    iter->_pos.column += end - p;
+  } else {
+    int tab_stop = iter->_parser->_options->tab_stop;
+    for (; p < end; ++p) {
+      assert((unsigned char) *p < 0x80 && *p != '\r');
+      if (*p == '\t') {
+        iter->_pos.column = ((iter->_pos.column / tab_stop) + 1) * tab_stop;
+      } else {
+        ++iter->_pos.column;
+      }
+    }
+  }
+  iter->_start = end;
+  read_char(iter);
+}
+
+void utf8iterator_move_input (
+  Utf8Iterator* iter,
+  const char* from,
+  const char* to,
+  const char* end,
+  bool is_partial
+) {
+  assert(iter->_start >= from && iter->_mark >= from);
+  iter->_start = to + (iter->_start - from);
+  iter->_mark = to + (iter->_mark - from);
+  // The validated block is rescanned, now that it may extend further.
+  iter->_ascii_start = iter->_start;
+  iter->_ascii_end = iter->_start;
+  iter->_end = end;
+  iter->_is_partial = is_partial;
+  if (iter->_current == -1) {
+    read_char(iter);
+  }
+}
+
+void utf8iterator_seek (
+  Utf8Iterator* iter,
+  const char* to,
+  const GumboSourcePosition* position
+) {
+  iter->_start = to;
+  iter->_mark = to;
+  iter->_pos = *position;
+  iter->_mark_pos = *position;
+  iter->_ascii_start = to;
+  iter->_ascii_end = to;
+  GumboVector* errors = &iter->_parser->_output->errors;
+  unsigned int num_errors = errors->length;
+  read_char(iter);
+  while (errors->length > num_errors) {
+    gumbo_remove_last_error(iter->_parser);
+  }
+}
+
 int utf8iterator_current(const Utf8Iterator* iter) {
   return iter->_current;
 }
@@ -276,6 +404,11 @@ void utf8iterator_mark(Utf8Iterator* iter) {
 void utf8iterator_reset(Utf8Iterator* iter) {
   iter->_start = iter->_mark;
   iter->_pos = iter->_mark_pos;
+  // The validated block may start after the mark.
+  if (iter->_start < iter->_ascii_start) {
+    iter->_ascii_start = iter->_start;
+    iter->_ascii_end = iter->_start;
+  }
   read_char(iter);
 }
 
@@ -43,6 +43,11 @@ typedef struct GumboInternalUtf8Iterator {
   // Points past the end of the iter, like a past-the-end iterator in the STL.
   const char* _end;
 
+  // Delimit a block of ASCII text known to decode to itself with no errors
+  // (see GUMBO_SCAN_ASCII). Characters inside it are read without decoding.
+  const char* _ascii_start;
+  const char* _ascii_end;
+
   // The code point under the cursor.
   int _current;
 
@@ -52,6 +57,17 @@ typedef struct GumboInternalUtf8Iterator {
   // The SourcePosition for the current location.
   GumboSourcePosition _pos;
 
+  // Whether line and column numbers are kept up to date, or just the offset
+  // (see GumboOptions.lazy_positions).
+  bool _track_lines;
+
+  // Whether more input may still be appended after _end (see
+  // gumbo_parser_feed). If so, a character that might continue past _end
+  // (an incomplete UTF-8 sequence, or a CR that might be followed by LF) is
+  // read as -1 with a width of 0 and no error, and is read again once the
+  // input has been extended.
+  bool _is_partial;
+
   // The SourcePosition for the mark.
   GumboSourcePosition _mark_pos;
 
@@ -64,6 +80,11 @@ typedef struct GumboInternalUtf8Iterator {
 // forbidden by the HTML5 spec, such as NUL bytes and undefined control chars.
 bool utf8_is_invalid_code_point(int c) CONST_FN;
 
+// Returns the number of bytes the iterator consumes for the character
+// starting at `c`, treating invalid and truncated sequences the same way.
+// `end` is the end of the whole input.
+size_t utf8_char_width(const char* c, const char* end) PURE;
+
 // Initializes a new Utf8Iterator from the given byte buffer. The source does
 // not have to be NUL-terminated, but the length must be passed in explicitly.
 void utf8iterator_init (
@@ -76,6 +97,50 @@ void utf8iterator_init (
 // Advances the current position by one code point.
 void utf8iterator_next(Utf8Iterator* iter);
 
+// The same as utf8iterator_next, but handles the most common case inline:
+// moving between two characters of a run of ASCII that's already been
+// validated, from a character other than LF or tab (which move the position
+// to a new line or tab stop).
+static inline void utf8iterator_next_inline(Utf8Iterator* iter) {
+  const char* next = iter->_start + 1;
+  int c = iter->_current;
+  if (likely(next < iter->_ascii_end && c != '\n' && c != '\t')) {
+    ++iter->_pos.offset;
+    if (iter->_track_lines) {
+      ++iter->_pos.column;
+    }
+    iter->_start = next;
+    iter->_current = (unsigned char) *next;
+    return;
+  }
+  utf8iterator_next(iter);
+}
+
+// Advances the iterator past the next `length` bytes, which must be ASCII
+// characters other than CR, as if utf8iterator_next had been called once for
+// each of them. The bytes are not checked for invalid code points.
+void utf8iterator_skip_ascii(Utf8Iterator* iter, size_t length);
+
+// Points the iterator at a new copy of its input. Everything from `from` to
+// the old end of the input must have been copied to `to`, and the new input
+// ends at `end`. If the current character was incomplete, it's read again.
+void utf8iterator_move_input (
+  Utf8Iterator* iter,
+  const char* from,
+  const char* to,
+  const char* end,
+  bool is_partial
+);
+
+// Moves the iterator to `to`, which must be the start of a character that's
+// at `position`. The character is expected to have been read before, so any
+// error in it isn't reported again.
+void utf8iterator_seek (
+  Utf8Iterator* iter,
+  const char* to,
+  const GumboSourcePosition* position
+);
+
 // Returns the current code point as an integer.
 int utf8iterator_current(const Utf8Iterator* iter);
 
@@ -15,13 +15,53 @@
  limitations under the License.
 */
 
+// clock_gettime(2) isn't part of C99.
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "util.h"
 #include "gumbo.h"
 
+// The arena used for the parse currently running on this thread, if any.
+static THREAD_LOCAL GumboArena* current_arena = NULL;
+
+// The statistics of the parse currently running on this thread, if they were
+// asked for.
+static THREAD_LOCAL GumboParseStats* allocation_stats = NULL;
+
+GumboArena* gumbo_set_arena(GumboArena* arena) {
+  GumboArena* previous = current_arena;
+  current_arena = arena;
+  return previous;
+}
+
+GumboParseStats* gumbo_set_allocation_stats(GumboParseStats* stats) {
+  GumboParseStats* previous = allocation_stats;
+  allocation_stats = stats;
+  return previous;
+}
+
+double gumbo_monotonic_seconds(void) {
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+#else
+  return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
 void* gumbo_alloc(size_t size) {
+  if (unlikely(allocation_stats)) {
+    ++allocation_stats->allocations;
+    allocation_stats->bytes_allocated += size;
+  }
+  if (current_arena) {
+    return gumbo_arena_alloc(current_arena, size);
+  }
   void* ptr = malloc(size);
   if (unlikely(ptr == NULL)) {
     perror(__func__);
@@ -30,8 +70,15 @@ void* gumbo_alloc(size_t size) {
   return ptr;
 }
 
-void* gumbo_realloc(void* ptr, size_t size) {
-  ptr = realloc(ptr, size);
+void* gumbo_realloc(void* ptr, size_t old_size, size_t new_size) {
+  if (unlikely(allocation_stats) && new_size > old_size) {
+    ++allocation_stats->allocations;
+    allocation_stats->bytes_allocated += new_size - old_size;
+  }
+  if (current_arena && gumbo_arena_owns(current_arena, ptr)) {
+    return gumbo_arena_realloc(current_arena, ptr, old_size, new_size);
+  }
+  ptr = realloc(ptr, new_size);
   if (unlikely(ptr == NULL)) {
     perror(__func__);
     abort();
@@ -40,6 +87,10 @@ void* gumbo_realloc(void* ptr, size_t size) {
 }
 
 void gumbo_free(void* ptr) {
+  if (current_arena && gumbo_arena_owns(current_arena, ptr)) {
+    gumbo_arena_free(current_arena, ptr);
+    return;
+  }
   free(ptr);
 }
 
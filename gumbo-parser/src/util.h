@@ -3,6 +3,8 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include "arena.h"
+#include "gumbo.h"
 #include "macros.h"
 
 #ifdef __cplusplus
@@ -17,9 +19,27 @@ extern "C" {
 char* gumbo_strdup(const char* str) XMALLOC NONNULL_ARGS;
 
 void* gumbo_alloc(size_t size) XMALLOC;
-void* gumbo_realloc(void* ptr, size_t size) RETURNS_NONNULL;
+void* gumbo_realloc (
+  void* ptr,
+  size_t old_size,
+  size_t new_size
+) RETURNS_NONNULL;
 void gumbo_free(void* ptr);
 
+// Makes `arena` the allocator used by gumbo_alloc() on the calling thread,
+// until replaced by another call. Pass NULL to go back to malloc(3). Memory
+// that was allocated before the arena was installed is still resized and
+// freed with the system allocator. Returns the previously installed arena.
+GumboArena* gumbo_set_arena(GumboArena* arena);
+
+// Makes gumbo_alloc() and gumbo_realloc() on the calling thread add what they
+// allocate to `stats` (see GumboParseStats.allocations), until replaced by
+// another call. Pass NULL to stop counting. Returns the previous stats.
+GumboParseStats* gumbo_set_allocation_stats(GumboParseStats* stats);
+
+// Returns the time in seconds from some fixed point, for measuring intervals.
+double gumbo_monotonic_seconds(void);
+
 // Debug wrapper for printf
 void gumbo_debug(const char* format, ...) PRINTF(1);
 
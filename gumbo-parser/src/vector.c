@@ -46,9 +46,10 @@ void gumbo_vector_destroy(GumboVector* vector) {
 static void enlarge_vector_if_full(GumboVector* vector) {
   if (vector->length >= vector->capacity) {
     if (vector->capacity) {
+      size_t old_num_bytes = sizeof(void*) * vector->capacity;
       vector->capacity *= 2;
       size_t num_bytes = sizeof(void*) * vector->capacity;
-      vector->data = gumbo_realloc(vector->data, num_bytes);
+      vector->data = gumbo_realloc(vector->data, old_num_bytes, num_bytes);
     } else {
       // 0-capacity vector; no previous array to deallocate.
       vector->capacity = 2;
@@ -0,0 +1,80 @@
+#include <stdint.h>
+#include <string.h>
+#include "arena.h"
+#include "gtest/gtest.h"
+#include "util.h"
+
+namespace {
+
+class GumboArenaTest : public ::testing::Test {
+ protected:
+  GumboArenaTest() : arena_(gumbo_arena_new()) {}
+
+  ~GumboArenaTest() { gumbo_arena_destroy(arena_); }
+
+  GumboArena* arena_;
+};
+
+TEST_F(GumboArenaTest, AllocationsAreAlignedAndOwned) {
+  char* a = static_cast<char*>(gumbo_arena_alloc(arena_, 3));
+  void* b = gumbo_arena_alloc(arena_, sizeof(void*));
+  EXPECT_NE(static_cast<void*>(a), b);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(b) % sizeof(void*));
+  EXPECT_TRUE(gumbo_arena_owns(arena_, a));
+  EXPECT_TRUE(gumbo_arena_owns(arena_, b));
+
+  int on_stack;
+  EXPECT_FALSE(gumbo_arena_owns(arena_, &on_stack));
+  EXPECT_FALSE(gumbo_arena_owns(arena_, NULL));
+}
+
+TEST_F(GumboArenaTest, FreeLastAllocationIsReused) {
+  void* a = gumbo_arena_alloc(arena_, 16);
+  gumbo_arena_free(arena_, a);
+  EXPECT_EQ(a, gumbo_arena_alloc(arena_, 16));
+}
+
+TEST_F(GumboArenaTest, ReallocLastAllocationInPlace) {
+  char* a = static_cast<char*>(gumbo_arena_alloc(arena_, 4));
+  memcpy(a, "abc", 4);
+  char* b = static_cast<char*>(gumbo_arena_realloc(arena_, a, 4, 64));
+  EXPECT_EQ(a, b);
+  EXPECT_STREQ("abc", b);
+}
+
+TEST_F(GumboArenaTest, ReallocCopiesEarlierAllocation) {
+  char* a = static_cast<char*>(gumbo_arena_alloc(arena_, 4));
+  memcpy(a, "abc", 4);
+  gumbo_arena_alloc(arena_, 4);
+  char* b = static_cast<char*>(gumbo_arena_realloc(arena_, a, 4, 64));
+  EXPECT_NE(a, b);
+  EXPECT_STREQ("abc", b);
+}
+
+TEST_F(GumboArenaTest, LargeAllocations) {
+  const size_t size = 4 * 1024 * 1024;
+  char* small = static_cast<char*>(gumbo_arena_alloc(arena_, 8));
+  char* large = static_cast<char*>(gumbo_arena_alloc(arena_, size));
+  memset(large, 'x', size);
+  EXPECT_TRUE(gumbo_arena_owns(arena_, small));
+  EXPECT_TRUE(gumbo_arena_owns(arena_, large + size - 1));
+}
+
+TEST_F(GumboArenaTest, InstalledArenaBacksGumboAlloc) {
+  void* before = gumbo_alloc(8);
+  EXPECT_EQ(NULL, gumbo_set_arena(arena_));
+
+  char* str = gumbo_strdup("arena");
+  EXPECT_TRUE(gumbo_arena_owns(arena_, str));
+  EXPECT_FALSE(gumbo_arena_owns(arena_, before));
+
+  // Memory from before the arena was installed stays with malloc(3).
+  before = gumbo_realloc(before, 8, 4096);
+  EXPECT_FALSE(gumbo_arena_owns(arena_, before));
+  gumbo_free(before);
+  gumbo_free(str);
+
+  EXPECT_EQ(arena_, gumbo_set_arena(NULL));
+}
+
+}  // namespace
@@ -18,6 +18,8 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "test_utils.h"
@@ -46,4 +48,41 @@ TEST_F(GumboAttributeTest, GetAttribute) {
   EXPECT_EQ(NULL, gumbo_get_attribute(&vector_, "bar"));
 }
 
+TEST_F(GumboAttributeTest, ElementGetAttribute) {
+  GumboElement element;
+  element.attributes = vector_;
+  element.attribute_index = NULL;
+  std::vector<std::string> names;
+  for (int i = 0; i < 20; ++i) {
+    names.push_back("attr" + std::to_string(i));
+  }
+  names.push_back("viewBox");
+  names.push_back("ATTR3");
+  std::vector<GumboAttribute> attributes(names.size());
+  for (size_t i = 0; i < names.size(); ++i) {
+    attributes[i].name = names[i].c_str();
+    gumbo_vector_add(&attributes[i], &element.attributes);
+  }
+
+  gumbo_index_attributes(&element);
+  ASSERT_TRUE(element.attribute_index != NULL);
+  EXPECT_EQ(&attributes[7], gumbo_element_get_attribute(&element, "attr7"));
+  EXPECT_EQ(&attributes[20], gumbo_element_get_attribute(&element, "viewbox"));
+  EXPECT_EQ(&attributes[3], gumbo_element_get_attribute(&element, "Attr3"));
+  EXPECT_EQ(NULL, gumbo_element_get_attribute(&element, "attr20"));
+
+  // Attributes added after indexing are still found.
+  GumboAttribute extra;
+  extra.name = "attr20";
+  gumbo_vector_add(&extra, &element.attributes);
+  EXPECT_EQ(&extra, gumbo_element_get_attribute(&element, "attr20"));
+
+  // Too few attributes aren't indexed.
+  element.attributes.length = 3;
+  gumbo_index_attributes(&element);
+  EXPECT_EQ(NULL, element.attribute_index);
+  EXPECT_EQ(&attributes[1], gumbo_element_get_attribute(&element, "attr1"));
+  vector_ = element.attributes;
+}
+
 }  // namespace
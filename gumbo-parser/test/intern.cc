@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <string.h>
+#include "gtest/gtest.h"
+#include "intern.h"
+
+namespace {
+
+class GumboInternTest : public ::testing::Test {
+ protected:
+  GumboInternTest() : table_(gumbo_intern_table_new()) {}
+
+  ~GumboInternTest() { gumbo_intern_table_destroy(table_); }
+
+  GumboInternTable* table_;
+};
+
+TEST_F(GumboInternTest, SameNameSamePointer) {
+  const char* a = gumbo_intern(table_, "data-foo", 8);
+  const char* b = gumbo_intern(table_, "data-foo=bar", 8);
+  EXPECT_EQ(a, b);
+  EXPECT_STREQ("data-foo", a);
+  EXPECT_NE(a, gumbo_intern(table_, "data-fo", 7));
+}
+
+TEST_F(GumboInternTest, CommonNamesAreShared) {
+  GumboInternTable* other = gumbo_intern_table_new();
+  const char* a = gumbo_intern(table_, "class", 5);
+  EXPECT_STREQ("class", a);
+  EXPECT_EQ(a, gumbo_intern(other, "classes", 5));
+  EXPECT_EQ(a, gumbo_intern_lookup(other, "class", 5));
+  EXPECT_NE(gumbo_intern(table_, "abc", 3), gumbo_intern(other, "abc", 3));
+  gumbo_intern_table_destroy(other);
+}
+
+TEST_F(GumboInternTest, Lookup) {
+  EXPECT_EQ(NULL, gumbo_intern_lookup(table_, "data-foo", 8));
+  const char* a = gumbo_intern(table_, "data-foo", 8);
+  EXPECT_EQ(a, gumbo_intern_lookup(table_, "data-foo", 8));
+  EXPECT_EQ(NULL, gumbo_intern_lookup(table_, "data-f", 6));
+  EXPECT_EQ(NULL, gumbo_intern_lookup(table_, "idx", 3));
+  EXPECT_STREQ("id", gumbo_intern_lookup(table_, "idx", 2));
+}
+
+TEST_F(GumboInternTest, ManyNames) {
+  const char* names[1000];
+  char name[16];
+  for (int i = 0; i < 1000; ++i) {
+    snprintf(name, sizeof(name), "n%d", i);
+    names[i] = gumbo_intern(table_, name, strlen(name));
+  }
+  for (int i = 0; i < 1000; ++i) {
+    snprintf(name, sizeof(name), "n%d", i);
+    EXPECT_STREQ(name, names[i]);
+    EXPECT_EQ(names[i], gumbo_intern(table_, name, strlen(name)));
+  }
+}
+
+}  // namespace
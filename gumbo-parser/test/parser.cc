@@ -14,10 +14,14 @@
 //
 // Author: jdtang@google.com (Jonathan Tang)
 
+#include <sstream>
 #include <string>
+#include <vector>
+#include "error.h"
 #include "gumbo.h"
 #include "gtest/gtest.h"
 #include "test_utils.h"
+#include "util.h"
 
 namespace {
 
@@ -173,6 +177,44 @@ TEST_F(GumboParserTest, SelfClosingTagError) {
   EXPECT_EQ(3, output_->errors.length);
 }
 
+TEST_F(GumboParserTest, ParseErrorsShareTagStacks) {
+  Parse("<!DOCTYPE html><div><span></p></i><b>x</b></form>");
+  std::vector<const GumboError*> errors;
+  for (unsigned int i = 0; i < output_->errors.length; ++i) {
+    const GumboError* error =
+      static_cast<const GumboError*>(output_->errors.data[i]);
+    if (error->type == GUMBO_ERR_PARSER) {
+      errors.push_back(error);
+    }
+  }
+  // </p>, </i>, </form> and the end of file with elements still open.
+  ASSERT_EQ(4u, errors.size());
+
+  const GumboTagStack* tag_stack = errors[0]->v.parser.tag_stack;
+  for (size_t i = 1; i < errors.size(); ++i) {
+    EXPECT_EQ(tag_stack, errors[i]->v.parser.tag_stack) << i;
+  }
+  const GumboTag expected[] = {
+    GUMBO_TAG_SPAN, GUMBO_TAG_DIV, GUMBO_TAG_BODY, GUMBO_TAG_HTML
+  };
+  for (size_t i = 0; i < 4; ++i) {
+    ASSERT_TRUE(tag_stack != NULL);
+    EXPECT_EQ(expected[i], tag_stack->tag);
+    tag_stack = tag_stack->below;
+  }
+  EXPECT_TRUE(tag_stack == NULL);
+
+  GumboStringBuffer text;
+  gumbo_string_buffer_init(&text);
+  gumbo_error_to_string(errors[1], &text);
+  std::string message(text.data, text.length);
+  gumbo_string_buffer_destroy(&text);
+  EXPECT_NE(
+    std::string::npos,
+    message.find("Currently open tags: html, body, div, span.")
+  ) << message;
+}
+
 TEST_F(GumboParserTest, SelfClosingTagWithComplexProcessing) {
   Parse("<br/>");
   ASSERT_EQ(1, output_->errors.length); // No doctype.
@@ -328,6 +370,19 @@ TEST_F(GumboParserTest, Whitespace) {
   EXPECT_STREQ("Text\n", text->v.text.text);
 }
 
+TEST_F(GumboParserTest, DuplicateAttributeWithoutRoomForError) {
+  options_.max_errors = 0;
+  Parse("<input id=a id=b class=c>");
+
+  GumboNode* body;
+  GetAndAssertBody(root_, &body);
+  GumboNode* input = GetChild(body, 0);
+  ASSERT_EQ(2, GetAttributeCount(input));
+  EXPECT_STREQ("id", GetAttribute(input, 0)->name);
+  EXPECT_STREQ("class", GetAttribute(input, 1)->name);
+  EXPECT_EQ(0, output_->errors.length);
+}
+
 TEST_F(GumboParserTest, DuplicateAttributes) {
   std::string text("<input checked=\"false\" checked=true id=foo id='bar'>");
   Parse(text);
@@ -363,6 +418,56 @@ TEST_F(GumboParserTest, DuplicateAttributes) {
   // TODO(jdtang): Run some assertions on the parse error that's added.
 }
 
+TEST_F(GumboParserTest, DuplicateAttributesOfTagWithManyAttributes) {
+  // Enough attributes that duplicates are found by hashing, with each name
+  // repeated once the first 100 have been seen.
+  std::string text("<div");
+  for (int i = 0; i < 100; ++i) {
+    text += " data-" + std::to_string(i) + "=a";
+  }
+  for (int i = 0; i < 100; i += 7) {
+    text += " data-" + std::to_string(i) + "=b";
+  }
+  text += " ID=c id=d>";
+  options_.index_attributes = true;
+  Parse(text);
+
+  GumboNode* body;
+  GetAndAssertBody(root_, &body);
+  GumboNode* div = GetChild(body, 0);
+  ASSERT_EQ(101, GetAttributeCount(div));
+  for (int i = 0; i < 100; ++i) {
+    GumboAttribute* attr = GetAttribute(div, i);
+    EXPECT_EQ("data-" + std::to_string(i), attr->name);
+    EXPECT_STREQ("a", attr->value);
+  }
+  EXPECT_STREQ("c", GetAttribute(div, 100)->value);
+
+  std::vector<const GumboError*> duplicates;
+  for (unsigned int i = 0; i < output_->errors.length; ++i) {
+    const GumboError* error =
+      static_cast<const GumboError*>(output_->errors.data[i]);
+    if (error->type == GUMBO_ERR_DUPLICATE_ATTR) {
+      duplicates.push_back(error);
+    }
+  }
+  ASSERT_EQ(16, duplicates.size());
+  for (unsigned int i = 0; i < duplicates.size(); ++i) {
+    const GumboError* error = duplicates[i];
+    EXPECT_EQ(i < 15 ? 7 * i : 100, error->v.duplicate_attr.original_index);
+    EXPECT_EQ(i < 15 ? 100 : 101, error->v.duplicate_attr.new_index);
+  }
+
+  const GumboElement* element = &div->v.element;
+  ASSERT_TRUE(element->attribute_index != NULL);
+  EXPECT_EQ (
+    GetAttribute(div, 42),
+    gumbo_element_get_attribute(element, "DATA-42")
+  );
+  EXPECT_EQ(GetAttribute(div, 100), gumbo_element_get_attribute(element, "id"));
+  EXPECT_EQ(NULL, gumbo_element_get_attribute(element, "data-100"));
+}
+
 TEST_F(GumboParserTest, LinkTagsInHead) {
   Parse(
       "<html>\n"
@@ -1347,6 +1452,36 @@ TEST_F(GumboParserTest, NoahsArkClause) {
   ASSERT_EQ(1, GetChildCount(red2));
 }
 
+TEST_F(GumboParserTest, NoahsArkClauseIgnoresAttributeOrder) {
+  Parse (
+    "<p><b x=1 y=2><b y=2 x=1><b x=1 y=2><b x=1 y=3><b y=2 x=1><p>X"
+  );
+
+  GumboNode* body;
+  GetAndAssertBody(root_, &body);
+  ASSERT_EQ(2, GetChildCount(body));
+
+  // The first <b> is dropped from the list of active formatting elements, so
+  // only the other four are reconstructed.
+  GumboNode* node = GetChild(body, 1);
+  const char* kAttributes[] = {"y=2 x=1", "x=1 y=2", "x=1 y=3", "y=2 x=1"};
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(1, GetChildCount(node));
+    node = GetChild(node, 0);
+    ASSERT_EQ(GUMBO_NODE_ELEMENT, node->type);
+    EXPECT_EQ(GUMBO_TAG_B, node->v.element.tag);
+    ASSERT_EQ(2, GetAttributeCount(node));
+    std::string attributes;
+    for (int j = 0; j < 2; ++j) {
+      GumboAttribute* attr = GetAttribute(node, j);
+      attributes += std::string(j ? " " : "") + attr->name + "=" + attr->value;
+    }
+    EXPECT_EQ(kAttributes[i], attributes);
+  }
+  ASSERT_EQ(1, GetChildCount(node));
+  EXPECT_EQ(GUMBO_NODE_TEXT, GetChild(node, 0)->type);
+}
+
 TEST_F(GumboParserTest, AdoptionAgency1) {
   // https://html.spec.whatwg.org/multipage/parsing.html#misnested-tags:-b-i-/b-/i
   Parse("<p>1<b>2<i>3</b>4</i>5</p>");
@@ -2033,4 +2168,668 @@ TEST_F(GumboParserTest, ForeignElementMismatch) {
   EXPECT_EQ(std::string("extra"), extra->v.element.name);
 }
 
+TEST_F(GumboParserTest, ArenaAllocatedTree) {
+  options_.use_arena = true;
+  Parse(
+    "<!DOCTYPE html><title>T</title><p class=a id=b>One<b>two<i>three</b>"
+    "four</i><table><tr><td>x</table>junk<foo bar=baz></foo><!-- c -->"
+  );
+  ASSERT_TRUE(output_->arena != NULL);
+  EXPECT_LT(0u, output_->errors.length);
+
+  GumboNode* body;
+  GetAndAssertBody(root_, &body);
+  GumboNode* p = GetChild(body, 0);
+  ASSERT_EQ(GUMBO_TAG_P, GetTag(p));
+  ASSERT_EQ(2, GetAttributeCount(p));
+  EXPECT_STREQ("id", GetAttribute(p, 1)->name);
+  EXPECT_STREQ("b", GetAttribute(p, 1)->value);
+
+  GumboNode* text = GetChild(p, 0);
+  ASSERT_EQ(GUMBO_NODE_TEXT, text->type);
+  EXPECT_STREQ("One", text->v.text.text);
+
+  GumboNode* foo = GetChild(body, GetChildCount(body) - 2);
+  ASSERT_EQ(GUMBO_TAG_UNKNOWN, GetTag(foo));
+  EXPECT_STREQ("foo", foo->v.element.name);
+  GumboNode* comment = GetChild(body, GetChildCount(body) - 1);
+  ASSERT_EQ(GUMBO_NODE_COMMENT, comment->type);
+  EXPECT_STREQ(" c ", comment->v.text.text);
+
+  // gumbo_alloc() must be back to malloc(3) once the parse has returned.
+  void* ptr = gumbo_alloc(16);
+  EXPECT_FALSE(gumbo_arena_owns(output_->arena, ptr));
+  gumbo_free(ptr);
+}
+
+TEST_F(GumboParserTest, ArenaAllocatedFragment) {
+  options_.use_arena = true;
+  ParseFragment("<td>x<b>y", GUMBO_TAG_TR, GUMBO_NAMESPACE_HTML);
+  ASSERT_TRUE(output_->arena != NULL);
+
+  GumboNode* root = GetChild(root_, 0);
+  ASSERT_EQ(GUMBO_TAG_HTML, GetTag(root));
+  ASSERT_EQ(1, GetChildCount(root));
+  GumboNode* td = GetChild(root, 0);
+  ASSERT_EQ(GUMBO_TAG_TD, GetTag(td));
+  ASSERT_EQ(2, GetChildCount(td));
+}
+
+static void CollectPositions(
+    GumboNode* node, std::vector<GumboSourcePosition*>* positions) {
+  switch (node->type) {
+    case GUMBO_NODE_DOCUMENT:
+      break;
+    case GUMBO_NODE_ELEMENT:
+    case GUMBO_NODE_TEMPLATE: {
+      GumboElement* element = &node->v.element;
+      positions->push_back(&element->start_pos);
+      positions->push_back(&element->end_pos);
+      for (unsigned int i = 0; i < element->attributes.length; ++i) {
+        GumboAttribute* attr =
+            static_cast<GumboAttribute*>(element->attributes.data[i]);
+        positions->push_back(&attr->name_start);
+        positions->push_back(&attr->name_end);
+        positions->push_back(&attr->value_start);
+        positions->push_back(&attr->value_end);
+      }
+      break;
+    }
+    default:
+      positions->push_back(&node->v.text.start_pos);
+      return;
+  }
+  GumboVector* children = node->type == GUMBO_NODE_DOCUMENT
+      ? &node->v.document.children
+      : &node->v.element.children;
+  for (unsigned int i = 0; i < children->length; ++i) {
+    CollectPositions(static_cast<GumboNode*>(children->data[i]), positions);
+  }
+}
+
+TEST_F(GumboParserTest, LazyPositionsResolveToEagerPositions) {
+  const char* input =
+    "<!DOCTYPE html>\r\n<title>T\title</title>\r<p class=\"a\tb\" id=x>\xC3\xA9"
+    "\t\xE2\x82\xAC\tx\xFF\ty\xC0\x80z\r\n\r\n<b\n\tbold\t=\t'1'>&amp;\tq"
+    "<table>\t<tr><td>\xF0\x9F\x98\x80\tcell</table>\n<svg><path d=1/></svg>"
+    "\t<!--\tc\r--><pre>\n\tx</pre>&#x0;\t\xE2\x82";
+
+  Parse(input);
+  std::vector<GumboSourcePosition*> eager;
+  CollectPositions(root_, &eager);
+  std::vector<GumboSourcePosition> expected;
+  for (size_t i = 0; i < eager.size(); ++i) {
+    expected.push_back(*eager[i]);
+  }
+  std::vector<GumboSourcePosition> expected_errors;
+  for (unsigned int i = 0; i < output_->errors.length; ++i) {
+    GumboError* error = static_cast<GumboError*>(output_->errors.data[i]);
+    expected_errors.push_back(error->position);
+  }
+  ASSERT_LT(20u, expected.size());
+  ASSERT_LT(3u, expected_errors.size());
+
+  for (int use_arena = 0; use_arena < 2; ++use_arena) {
+    options_.lazy_positions = true;
+    options_.use_arena = use_arena;
+    Parse(input);
+    ASSERT_TRUE(output_->line_index != NULL);
+
+    // Errors are resolved before returning.
+    ASSERT_EQ(expected_errors.size(), output_->errors.length);
+    for (unsigned int i = 0; i < output_->errors.length; ++i) {
+      GumboError* error = static_cast<GumboError*>(output_->errors.data[i]);
+      EXPECT_EQ(expected_errors[i].line, error->position.line) << i;
+      EXPECT_EQ(expected_errors[i].column, error->position.column) << i;
+      EXPECT_EQ(expected_errors[i].offset, error->position.offset) << i;
+    }
+
+    std::vector<GumboSourcePosition*> lazy;
+    CollectPositions(root_, &lazy);
+    ASSERT_EQ(expected.size(), lazy.size());
+    for (size_t i = 0; i < lazy.size(); ++i) {
+      EXPECT_EQ(expected[i].offset, lazy[i]->offset) << i;
+      if (expected[i].line == 0) {
+        // Not in the source at all.
+        continue;
+      }
+      EXPECT_EQ(0u, lazy[i]->line) << i;
+      gumbo_position_resolve(output_, lazy[i]);
+      EXPECT_EQ(expected[i].line, lazy[i]->line) << i;
+      EXPECT_EQ(expected[i].column, lazy[i]->column) << i;
+    }
+  }
+}
+
+TEST_F(GumboParserTest, LazyPositionsOnLongLine) {
+  // A minified page: one line with 20000 stray end tags, each a parse error.
+  // Resolving every position from the start of the line would take seconds.
+  std::string input("<!DOCTYPE html>");
+  for (int i = 0; i < 20000; ++i) {
+    input += i % 100 ? "ab</x>cd" : "\t\xC3\xA9</x>\t";
+  }
+  options_.max_errors = -1;
+  Parse(input);
+  std::vector<GumboSourcePosition> expected_errors;
+  for (unsigned int i = 0; i < output_->errors.length; ++i) {
+    GumboError* error = static_cast<GumboError*>(output_->errors.data[i]);
+    expected_errors.push_back(error->position);
+  }
+  std::vector<GumboSourcePosition*> eager;
+  CollectPositions(root_, &eager);
+  std::vector<GumboSourcePosition> expected;
+  for (size_t i = 0; i < eager.size(); ++i) {
+    expected.push_back(*eager[i]);
+  }
+  ASSERT_LE(20000u, expected_errors.size());
+
+  // With an arena, the index and everything it grows belong to the arena.
+  for (int use_arena = 0; use_arena < 2; ++use_arena) {
+    options_.lazy_positions = true;
+    options_.use_arena = use_arena;
+    Parse(input);
+    ASSERT_EQ(expected_errors.size(), output_->errors.length);
+    for (unsigned int i = 0; i < output_->errors.length; ++i) {
+      GumboError* error = static_cast<GumboError*>(output_->errors.data[i]);
+      ASSERT_EQ(expected_errors[i].line, error->position.line) << i;
+      ASSERT_EQ(expected_errors[i].column, error->position.column) << i;
+    }
+
+    // Back to front, so that each one is before everything resolved so far.
+    std::vector<GumboSourcePosition*> lazy;
+    CollectPositions(root_, &lazy);
+    ASSERT_EQ(expected.size(), lazy.size());
+    for (size_t i = lazy.size(); i-- > 0;) {
+      if (expected[i].line == 0) {
+        continue;
+      }
+      gumbo_position_resolve(output_, lazy[i]);
+      ASSERT_EQ(expected[i].line, lazy[i]->line) << i;
+      ASSERT_EQ(expected[i].column, lazy[i]->column) << i;
+    }
+  }
+}
+
+TEST_F(GumboParserTest, ResolveIgnoresEagerPositions) {
+  Parse("<p>\n<b>x</b>");
+  EXPECT_TRUE(output_->line_index == NULL);
+  GumboSourcePosition position = {3, 4, 5};
+  gumbo_position_resolve(output_, &position);
+  EXPECT_EQ(3u, position.line);
+  EXPECT_EQ(4u, position.column);
+  EXPECT_EQ(5u, position.offset);
+}
+
+static void DescribeNode(const GumboNode* node, std::ostringstream* out) {
+  *out << node->type << ' ' << node->parse_flags << ' ';
+  switch (node->type) {
+    case GUMBO_NODE_DOCUMENT: {
+      const GumboDocument* doc = &node->v.document;
+      *out << doc->name << ' ' << doc->public_identifier << ' '
+           << doc->system_identifier << '\n';
+      for (unsigned int i = 0; i < doc->children.length; ++i) {
+        DescribeNode(static_cast<GumboNode*>(doc->children.data[i]), out);
+      }
+      return;
+    }
+    case GUMBO_NODE_ELEMENT:
+    case GUMBO_NODE_TEMPLATE: {
+      const GumboElement* element = &node->v.element;
+      *out << element->tag << ' ' << ToString(element->original_tag) << ' '
+           << ToString(element->original_end_tag) << ' '
+           << element->start_pos.offset << ' ' << element->end_pos.offset
+           << '\n';
+      for (unsigned int i = 0; i < element->attributes.length; ++i) {
+        const GumboAttribute* attr =
+            static_cast<GumboAttribute*>(element->attributes.data[i]);
+        *out << attr->name << '='
+             << std::string(attr->value, attr->value_length) << ' '
+             << ToString(attr->original_value) << ' '
+             << attr->name_start.line << ':' << attr->name_start.column
+             << '\n';
+      }
+      for (unsigned int i = 0; i < element->children.length; ++i) {
+        DescribeNode(static_cast<GumboNode*>(element->children.data[i]), out);
+      }
+      return;
+    }
+    default:
+      *out << std::string(node->v.text.text, node->v.text.text_length) << ' '
+           << ToString(node->v.text.original_text)
+           << ' ' << node->v.text.start_pos.line << ':'
+           << node->v.text.start_pos.column << '\n';
+      return;
+  }
+}
+
+static std::string DescribeOutput(const GumboOutput* output) {
+  std::ostringstream out;
+  out << output->status << '\n';
+  DescribeNode(output->document, &out);
+  for (unsigned int i = 0; i < output->errors.length; ++i) {
+    const GumboError* error = static_cast<GumboError*>(output->errors.data[i]);
+    out << "error " << error->type << ' ' << error->position.line << ':'
+        << error->position.column << ':' << error->position.offset << '\n';
+  }
+  return out.str();
+}
+
+TEST_F(GumboParserTest, IncrementalParseMatchesOneShot) {
+  std::string input =
+    "<!DOCTYPE html>\r\n<title>T&amp;t</title>\r<p class=\"a\tb\" id=x>"
+    "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 &notin; &notit; &#x20AC; &#128512;"
+    " &CounterClockwiseContourIntegral; &#0; &\r\n<!-- c\r\n --><![CDATA[x]]>"
+    "<svg><![CDATA[a\r\nb]]></svg><textarea>\r\n&lt;x</textarea>"
+    "<script>if (a < b) {}</script><table><tr><td>cell</table>\xFF\xC3";
+  input += std::string(5000, 'x');
+  input += "<b id='\xE2\x82\xAC'>\r\n</b><!DOCTYPE nope>\xE2\x82";
+
+  output_ = gumbo_parse_with_options(&options_, input.data(), input.length());
+  std::string expected = DescribeOutput(output_);
+
+  const size_t kChunkSizes[] = {1, 2, 3, 7, 16, 17, 4096};
+  for (size_t i = 0; i < sizeof(kChunkSizes) / sizeof(kChunkSizes[0]); ++i) {
+    for (int use_arena = 0; use_arena < 2; ++use_arena) {
+      options_.use_arena = use_arena;
+      GumboParser* parser = gumbo_parser_new(&options_);
+      for (size_t pos = 0; pos < input.length(); pos += kChunkSizes[i]) {
+        size_t length = input.length() - pos;
+        if (length > kChunkSizes[i]) {
+          length = kChunkSizes[i];
+        }
+        gumbo_parser_feed(parser, input.data() + pos, length);
+      }
+      GumboOutput* output = gumbo_parser_finish(parser);
+      gumbo_parser_destroy(parser);
+      EXPECT_EQ(expected, DescribeOutput(output)) << kChunkSizes[i];
+      gumbo_destroy_output(output);
+    }
+  }
+}
+
+TEST_F(GumboParserTest, IncrementalParseOfFragment) {
+  options_.fragment_context = GUMBO_TAG_TABLE;
+  const char* input = "<tr><td>a&amp;b</td></tr>text";
+  ParseFragment(input, GUMBO_TAG_TABLE, GUMBO_NAMESPACE_HTML);
+  std::string expected = DescribeOutput(output_);
+
+  GumboParser* parser = gumbo_parser_new(&options_);
+  for (const char* c = input; *c; ++c) {
+    gumbo_parser_feed(parser, c, 1);
+  }
+  GumboOutput* output = gumbo_parser_finish(parser);
+  gumbo_parser_destroy(parser);
+  EXPECT_EQ(expected, DescribeOutput(output));
+  gumbo_destroy_output(output);
+}
+
+TEST_F(GumboParserTest, IncrementalParseStopsOnFirstError) {
+  options_.stop_on_first_error = true;
+  GumboParser* parser = gumbo_parser_new(&options_);
+  gumbo_parser_feed(parser, "<p>x</b>", 8);
+  gumbo_parser_feed(parser, "<div>y</div>", 12);
+  GumboOutput* output = gumbo_parser_finish(parser);
+  gumbo_parser_destroy(parser);
+
+  Parse("<p>x</b><div>y</div>");
+  EXPECT_EQ(DescribeOutput(output_), DescribeOutput(output));
+  gumbo_destroy_output(output);
+}
+
+TEST_F(GumboParserTest, DestroyUnfinishedIncrementalParser) {
+  GumboParser* parser = gumbo_parser_new(&options_);
+  const char* input = "<div><p title='unfinished";
+  gumbo_parser_feed(parser, input, strlen(input));
+  gumbo_parser_destroy(parser);
+}
+
+TEST_F(GumboParserTest, ReusedParserMatchesFreshParses) {
+  const char* inputs[] = {
+    "<!DOCTYPE html><title>a&amp;b</title><p>x<b>y<i>z</p>w",
+    "<table><tr><td>1<td>2</table><script>if (a < b) {}</script>",
+    "<div><p title='unfinished",
+    "<svg><![CDATA[a\r\nb]]></svg><textarea>\r\n&lt;x</textarea>",
+    "",
+  };
+  for (int use_arena = 0; use_arena < 2; ++use_arena) {
+    options_.use_arena = use_arena;
+    options_.lazy_positions = use_arena;
+    GumboParser* parser = gumbo_parser_new(&options_);
+    // Leave the first incremental parse unfinished, so that it's discarded.
+    gumbo_parser_feed(parser, "<ul><li>", 8);
+    for (int i = 0; i < 2 * (int) (sizeof(inputs) / sizeof(inputs[0])); ++i) {
+      const char* input = inputs[i / 2];
+      // Incremental parses always track positions as they go.
+      options_.lazy_positions = use_arena && i % 2 == 0;
+      Parse(input);
+      GumboOutput* output;
+      if (i % 2) {
+        gumbo_parser_reset(parser);
+        gumbo_parser_feed(parser, input, strlen(input));
+        output = gumbo_parser_finish(parser);
+      } else {
+        output = gumbo_parser_parse(parser, input, strlen(input));
+        ASSERT_EQ(output_->errors.length, output->errors.length);
+        for (unsigned int j = 0; j < output->errors.length; ++j) {
+          GumboError* expected = (GumboError*) output_->errors.data[j];
+          GumboError* actual = (GumboError*) output->errors.data[j];
+          EXPECT_EQ(expected->position.line, actual->position.line);
+          EXPECT_EQ(expected->position.column, actual->position.column);
+        }
+      }
+      EXPECT_EQ(DescribeOutput(output_), DescribeOutput(output)) << i;
+      gumbo_destroy_output(output);
+    }
+    gumbo_parser_destroy(parser);
+  }
+}
+
+TEST_F(GumboParserTest, BatchParseMatchesSeparateParses) {
+  std::vector<std::string> inputs;
+  for (int i = 0; i < 40; ++i) {
+    std::ostringstream input;
+    input << "<p id=" << i << ">" << std::string(i * i, 'x') << "<table>";
+    for (int j = 0; j < i % 7; ++j) {
+      input << "<tr><td>" << j;
+    }
+    inputs.push_back(input.str());
+  }
+  std::vector<const char*> buffers;
+  std::vector<size_t> lengths;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    buffers.push_back(inputs[i].data());
+    lengths.push_back(inputs[i].length());
+  }
+
+  for (unsigned int threads = 0; threads < 5; ++threads) {
+    std::vector<GumboOutput*> outputs(inputs.size());
+    gumbo_parse_batch (
+      &options_,
+      buffers.data(),
+      lengths.data(),
+      inputs.size(),
+      threads,
+      outputs.data()
+    );
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      Parse(inputs[i].c_str());
+      EXPECT_EQ(DescribeOutput(output_), DescribeOutput(outputs[i])) << i;
+      gumbo_destroy_output(outputs[i]);
+    }
+  }
+}
+
+TEST_F(GumboParserTest, SpeculativeTokenizationMatchesOneThread) {
+  // Every line start below looks like a place to split the input, including
+  // those inside comments, scripts and CDATA sections, where the speculative
+  // tokens are wrong.
+  const char kBlock[] =
+    "<div class=a id=b title='x&amp;y' class=dup>\r\n<p>T&notit; &#x20AC;"
+    " \xC3\xA9\xFF text\n<!-- a\n<p>commented -->\n<script>if (a<b) {\n"
+    "<p>not a tag</p>}</script>\n<title>t\n<b>x</title>\n<svg><![CDATA[\n"
+    "<p>cdata]]>\n<x-y z=1></x-y></svg>\n<textarea>\n<i>t</textarea>\n"
+    "<table><tr><td>\t&lt;cell</table>\n</div>\n<x-custom>y</x-custom>\n";
+  std::string input = "<!DOCTYPE html>\n<html><head></head><body>\n";
+  while (input.length() < 1100 * 1024) {
+    input += kBlock;
+  }
+  input += "<plaintext>\n<p>end";
+
+  for (int use_arena = 0; use_arena < 2; ++use_arena) {
+    for (int lazy_positions = 0; lazy_positions < 2; ++lazy_positions) {
+      options_.use_arena = use_arena;
+      options_.lazy_positions = lazy_positions;
+      options_.tokenizer_threads = 0;
+      Parse(input);
+      std::string expected = DescribeOutput(output_);
+      options_.tokenizer_threads = 4;
+      Parse(input);
+      EXPECT_EQ(expected, DescribeOutput(output_))
+          << use_arena << lazy_positions;
+    }
+  }
+}
+
+TEST_F(GumboParserTest, ZeroCopyTextPointsIntoSource) {
+  options_.zero_copy_text = true;
+  const char* input =
+      "<p title=plain class='a&amp;b' hidden id=\"\">text</p>x&lt;y";
+  Parse(input);
+
+  GumboNode* body = GetChild(GetChild(root_, 0), 1);
+  ASSERT_EQ(2, GetChildCount(body));
+  GumboNode* p = GetChild(body, 0);
+  ASSERT_EQ(4, GetAttributeCount(p));
+
+  GumboAttribute* title = GetAttribute(p, 0);
+  EXPECT_EQ(input + 9, title->value);
+  EXPECT_EQ(5u, title->value_length);
+  GumboAttribute* clas = GetAttribute(p, 1);
+  EXPECT_STREQ("a&b", clas->value);
+  EXPECT_EQ(3u, clas->value_length);
+  GumboAttribute* hidden = GetAttribute(p, 2);
+  EXPECT_EQ(0u, hidden->value_length);
+  EXPECT_EQ(0u, GetAttribute(p, 3)->value_length);
+
+  GumboNode* text = GetChild(p, 0);
+  EXPECT_EQ(strstr(input, "text"), text->v.text.text);
+  EXPECT_EQ(4u, text->v.text.text_length);
+
+  text = GetChild(body, 1);
+  EXPECT_STREQ("x<y", text->v.text.text);
+  EXPECT_EQ(3u, text->v.text.text_length);
+}
+
+TEST_F(GumboParserTest, ZeroCopyTextMatchesCopiedText) {
+  const char* input =
+      "<b id=x class='a\r\nb'>1<p title=\"t\">2</b>3\r\n4<b x y>"
+      "<table> <tr><td>&amp;</table><svg xlink:href=z><![CDATA[c]]></svg>";
+  Parse(input);
+  std::string expected = DescribeOutput(output_);
+
+  options_.zero_copy_text = true;
+  Parse(input);
+  EXPECT_EQ(expected, DescribeOutput(output_));
+
+  GumboParser* parser = gumbo_parser_new(&options_);
+  for (const char* c = input; *c; ++c) {
+    gumbo_parser_feed(parser, c, 1);
+  }
+  GumboOutput* output = gumbo_parser_finish(parser);
+  gumbo_parser_destroy(parser);
+  EXPECT_EQ(expected, DescribeOutput(output));
+  gumbo_destroy_output(output);
+}
+
+TEST_F(GumboParserTest, AdoptionAgencyMovesInlineAndSpilledChildren) {
+  const char* inputs[] = {
+    "<a><div>x</a>",
+    "<a><div>x<b>y</b>z<i>w</i>v</a>",
+  };
+  const unsigned int num_children[] = {1, 5};
+  for (int i = 0; i < 2; ++i) {
+    Parse(inputs[i]);
+    GumboNode* body = GetChild(GetChild(root_, 0), 1);
+    ASSERT_EQ(2, GetChildCount(body));
+    GumboNode* div = GetChild(body, 1);
+    ASSERT_EQ(GUMBO_TAG_DIV, div->v.element.tag);
+    ASSERT_EQ(1, GetChildCount(div));
+    GumboNode* a = GetChild(div, 0);
+    EXPECT_EQ(GUMBO_TAG_A, a->v.element.tag);
+    ASSERT_EQ(num_children[i], a->v.element.children.length);
+    for (unsigned int j = 0; j < num_children[i]; ++j) {
+      GumboNode* child = GetChild(a, j);
+      EXPECT_EQ(a, child->parent);
+      EXPECT_EQ(j, child->index_within_parent);
+    }
+  }
+}
+
+TEST_F(GumboParserTest, NamesAreInterned) {
+  Parse(
+      "<p class=a ID=b><custom class=c data-x=d><Custom data-X=e></custom>"
+      "<svg><foo definitionurl=f /><clippath/><clipPath/></svg>"
+      "<math definitionurl=g></math>");
+  GumboNode* body = GetChild(GetChild(root_, 0), 1);
+  GumboNode* p = GetChild(body, 0);
+  GumboNode* custom1 = GetChild(p, 0);
+  GumboNode* custom2 = GetChild(custom1, 0);
+  EXPECT_STREQ("custom", custom1->v.element.name);
+  EXPECT_EQ(custom1->v.element.name, custom2->v.element.name);
+  EXPECT_EQ(
+      custom1->v.element.name, gumbo_interned_name(output_, "custom"));
+
+  const char* clas = gumbo_interned_name(output_, "class");
+  EXPECT_EQ(clas, GetAttribute(p, 0)->name);
+  EXPECT_EQ(clas, GetAttribute(custom1, 0)->name);
+  EXPECT_EQ(GetAttribute(custom1, 1)->name, GetAttribute(custom2, 0)->name);
+  EXPECT_EQ(
+      GetAttribute(p, 1),
+      gumbo_get_interned_attribute(
+          &p->v.element.attributes, gumbo_interned_name(output_, "id")));
+  EXPECT_EQ(NULL, gumbo_interned_name(output_, "data-y"));
+  EXPECT_EQ(NULL, gumbo_get_interned_attribute(&p->v.element.attributes,
+                                               NULL));
+
+  ASSERT_EQ(3, GetChildCount(custom1));
+  GumboNode* svg = GetChild(custom1, 1);
+  ASSERT_EQ(3, GetChildCount(svg));
+  EXPECT_STREQ(
+      "definitionurl", GetAttribute(GetChild(svg, 0), 0)->name);
+  EXPECT_STREQ("clipPath", GetChild(svg, 1)->v.element.name);
+  EXPECT_EQ(GetChild(svg, 1)->v.element.name, GetChild(svg, 2)->v.element.name);
+  EXPECT_EQ(
+      gumbo_interned_name(output_, "definitionURL"),
+      GetAttribute(GetChild(custom1, 2), 0)->name);
+}
+
+TEST_F(GumboParserTest, CollectsParseStats) {
+  const char* input =
+      "<p>a<b>b<table><td>x</td>y</table><p>c</b>d<!--z--><br/>";
+  Parse(input);
+  std::string expected = DescribeOutput(output_);
+
+  GumboParseStats stats;
+  options_.stats = &stats;
+  Parse(input);
+  EXPECT_EQ(expected, DescribeOutput(output_));
+
+  EXPECT_EQ(0u, stats.tokens.doctype);
+  EXPECT_EQ(6u, stats.tokens.start_tag);
+  EXPECT_EQ(3u, stats.tokens.end_tag);
+  EXPECT_EQ(1u, stats.tokens.comment);
+  EXPECT_EQ(1u, stats.tokens.eof);
+  EXPECT_EQ(1u, stats.nodes[GUMBO_NODE_DOCUMENT]);
+  EXPECT_EQ(1u, stats.nodes[GUMBO_NODE_COMMENT]);
+  EXPECT_EQ(0u, stats.nodes[GUMBO_NODE_TEMPLATE]);
+  EXPECT_LE(12u, stats.nodes[GUMBO_NODE_ELEMENT]);
+  EXPECT_LT(0u, stats.allocations);
+  EXPECT_LT(0u, stats.bytes_allocated);
+  EXPECT_EQ(1u, stats.adoption_agency_runs);
+  EXPECT_LT(0u, stats.foster_parented_insertions);
+  EXPECT_LT(0u, stats.formatting_reconstructions);
+
+  double mode_seconds = 0;
+  for (int i = 0; i < GUMBO_NUM_INSERTION_MODES; ++i) {
+    EXPECT_LE(0, stats.insertion_mode_seconds[i]);
+    mode_seconds += stats.insertion_mode_seconds[i];
+  }
+  EXPECT_NEAR(stats.tree_construction_seconds, mode_seconds, 1e-6);
+  EXPECT_LE(0, stats.tokenizer_seconds);
+
+  // The stats are reset for each parse.
+  Parse("");
+  EXPECT_EQ(0u, stats.tokens.start_tag);
+  EXPECT_EQ(1u, stats.tokens.eof);
+  EXPECT_EQ(0u, stats.adoption_agency_runs);
+
+  EXPECT_STREQ("initial", gumbo_insertion_mode_name(0));
+  EXPECT_STREQ("in body", gumbo_insertion_mode_name(6));
+  EXPECT_STREQ(
+      "after after frameset",
+      gumbo_insertion_mode_name(GUMBO_NUM_INSERTION_MODES - 1));
+  EXPECT_EQ(NULL, gumbo_insertion_mode_name(GUMBO_NUM_INSERTION_MODES));
+}
+
+static void RecordStartElement(void* userdata, const GumboNode* element) {
+  *static_cast<std::string*>(userdata) +=
+      std::string("<") + element->v.element.name + ">";
+}
+
+static void RecordEndElement(void* userdata, const GumboNode* element) {
+  *static_cast<std::string*>(userdata) +=
+      std::string("</") + element->v.element.name + ">";
+}
+
+static void RecordCharacters(void* userdata, const GumboNode* text) {
+  *static_cast<std::string*>(userdata) +=
+      std::string("[") + text->v.text.text + "]";
+}
+
+static void RecordComment(void* userdata, const GumboNode* comment) {
+  *static_cast<std::string*>(userdata) +=
+      std::string("{") + comment->v.text.text + "}";
+}
+
+class GumboCallbacksTest : public GumboParserTest {
+ protected:
+  GumboCallbacksTest() {
+    callbacks_.userdata = &events_;
+    callbacks_.start_element = RecordStartElement;
+    callbacks_.end_element = RecordEndElement;
+    callbacks_.characters = RecordCharacters;
+    callbacks_.comment = RecordComment;
+    options_.callbacks = &callbacks_;
+  }
+
+  GumboCallbacks callbacks_;
+  std::string events_;
+};
+
+TEST_F(GumboCallbacksTest, ReportsNodesInDocumentOrder) {
+  Parse("<!--c--><p class=a>x<b>y</p>z");
+  EXPECT_EQ(
+      "{c}<html><head></head><body><p>[x]<b>[y]</b></p><b>[z]</b></body>"
+      "</html>",
+      events_);
+  // Only the root element is left in the tree.
+  ASSERT_EQ(1u, root_->v.document.children.length);
+  EXPECT_EQ(output_->root, root_->v.document.children.data[0]);
+  EXPECT_EQ(0u, GetChildCount(output_->root));
+}
+
+TEST_F(GumboCallbacksTest, ReportsAdoptedElements) {
+  Parse("<b>1<p>2</b>3");
+  EXPECT_EQ(
+      "<html><head></head><body><b>[1]<p></b><b>[2]</b>[3]</p></body></html>",
+      events_);
+}
+
+TEST_F(GumboCallbacksTest, ReportsFosterParentedText) {
+  Parse("<table>a<tr><td>b</table>");
+  EXPECT_EQ(
+      "<html><head></head><body><table>[a]<tbody><tr><td>[b]</td></tr>"
+      "</tbody></table></body></html>",
+      events_);
+}
+
+TEST_F(GumboCallbacksTest, ReportsFragments) {
+  ParseFragment("<td>x</td><tr>", GUMBO_TAG_TR, GUMBO_NAMESPACE_HTML);
+  EXPECT_EQ("<html><td>[x]</td></html>", events_);
+}
+
+TEST_F(GumboCallbacksTest, IncrementalParse) {
+  const char* input = "<ul><li>one<li>two</ul><!-- done -->";
+  GumboParser* parser = gumbo_parser_new(&options_);
+  for (const char* c = input; *c; ++c) {
+    gumbo_parser_feed(parser, c, 1);
+  }
+  output_ = gumbo_parser_finish(parser);
+  gumbo_parser_destroy(parser);
+  EXPECT_EQ(
+      "<html><head></head><body><ul><li>[one]</li><li>[two]</li></ul>"
+      "{ done }</body></html>",
+      events_);
+}
+
 }  // namespace
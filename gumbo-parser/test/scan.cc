@@ -0,0 +1,140 @@
+#include <string>
+#include "gtest/gtest.h"
+#include "scan.h"
+
+namespace {
+
+static size_t Scan(
+    const std::string& text, GumboScanMode mode = GUMBO_SCAN_DATA) {
+  return gumbo_scan_text(text.data(), text.data() + text.size(), mode);
+}
+
+TEST(GumboScanTest, Empty) {
+  EXPECT_EQ(0u, Scan(""));
+}
+
+TEST(GumboScanTest, PlainText) {
+  EXPECT_EQ(5u, Scan("hello"));
+  EXPECT_EQ(11u, Scan("a\tb\nc\fd e>f"));
+  const std::string markup("a\0b<c&d\r", 8);
+  EXPECT_EQ(1u, Scan(markup, GUMBO_SCAN_DATA));
+  EXPECT_EQ(7u, Scan(markup, GUMBO_SCAN_ASCII));
+}
+
+// Place each special byte at every offset of buffers longer than the vector
+// width, so that the block loops and the scalar tail are all exercised.
+static void ExpectStopsAt(
+    const char* specials, size_t count, GumboScanMode mode) {
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t length = 1; length <= 80; ++length) {
+      for (size_t pos = 0; pos < length; ++pos) {
+        std::string text(length, 'x');
+        text[pos] = specials[i];
+        EXPECT_EQ(pos, Scan(text, mode)) << "byte " << (int) specials[i];
+      }
+    }
+  }
+}
+
+static void ExpectSkips(const char* plain, size_t count, GumboScanMode mode) {
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t length = 1; length <= 80; ++length) {
+      EXPECT_EQ(length, Scan(std::string(length, plain[i]), mode))
+          << "byte " << (int) plain[i];
+    }
+  }
+}
+
+TEST(GumboScanTest, DataStopsAtSpecialBytes) {
+  const char specials[] = {
+    '<', '&', '\0', '\r', '\x01', '\x0B', '\x1F', '\x7F', '\x80', '\xC3',
+    '\xFF',
+  };
+  const char plain[] = {' ', '\t', '\n', '\f', '>', '~', 'x'};
+  ExpectStopsAt(specials, sizeof(specials), GUMBO_SCAN_DATA);
+  ExpectSkips(plain, sizeof(plain), GUMBO_SCAN_DATA);
+}
+
+TEST(GumboScanTest, AsciiStopsAtSpecialBytes) {
+  const char specials[] = {
+    '\r', '\x01', '\x0B', '\x1F', '\x7F', '\x80', '\xC3', '\xFF',
+  };
+  const char plain[] = {'<', '&', '\0', ' ', '\t', '\n', '\f', '~'};
+  ExpectStopsAt(specials, sizeof(specials), GUMBO_SCAN_ASCII);
+  ExpectSkips(plain, sizeof(plain), GUMBO_SCAN_ASCII);
+}
+
+TEST(GumboScanTest, RawtextStopsAtSpecialBytes) {
+  const char specials[] = {'<', '\0', '\r', '\x01', '\x7F', '\x80', '\xFF'};
+  const char plain[] = {'&', '-', ' ', '\t', '\n', '\f', '>', 'x'};
+  ExpectStopsAt(specials, sizeof(specials), GUMBO_SCAN_RAWTEXT);
+  ExpectSkips(plain, sizeof(plain), GUMBO_SCAN_RAWTEXT);
+}
+
+TEST(GumboScanTest, ScriptEscapedStopsAtSpecialBytes) {
+  const char specials[] = {
+    '<', '-', '\0', '\r', '\x01', '\x7F', '\x80', '\xFF',
+  };
+  const char plain[] = {'&', ' ', '\t', '\n', '\f', '>', 'x'};
+  ExpectStopsAt(specials, sizeof(specials), GUMBO_SCAN_SCRIPT_ESCAPED);
+  ExpectSkips(plain, sizeof(plain), GUMBO_SCAN_SCRIPT_ESCAPED);
+}
+
+TEST(GumboScanTest, PlaintextStopsAtSpecialBytes) {
+  const char specials[] = {'\0', '\r', '\x01', '\x7F', '\x80', '\xFF'};
+  const char plain[] = {'<', '&', '-', ' ', '\t', '\n', '\f', 'x'};
+  ExpectStopsAt(specials, sizeof(specials), GUMBO_SCAN_PLAINTEXT);
+  ExpectSkips(plain, sizeof(plain), GUMBO_SCAN_PLAINTEXT);
+}
+
+TEST(GumboScanTest, TagNameStopsAtSpecialBytes) {
+  const char specials[] = {
+    '/', '>', ' ', '\t', '\n', '\f', '\0', '\r', '\x01', '\x7F', '\x80', '\xFF',
+  };
+  const char plain[] = {'<', '&', '=', '"', '\'', '-', 'A', 'z', '~'};
+  ExpectStopsAt(specials, sizeof(specials), GUMBO_SCAN_TAG_NAME);
+  ExpectSkips(plain, sizeof(plain), GUMBO_SCAN_TAG_NAME);
+}
+
+TEST(GumboScanTest, AttrNameStopsAtSpecialBytes) {
+  const char specials[] = {
+    '/', '>', '=', '"', '\'', '<', ' ', '\t', '\0', '\r', '\x7F', '\x80',
+  };
+  const char plain[] = {'&', '-', ':', '`', 'A', 'z', '~'};
+  ExpectStopsAt(specials, sizeof(specials), GUMBO_SCAN_ATTR_NAME);
+  ExpectSkips(plain, sizeof(plain), GUMBO_SCAN_ATTR_NAME);
+}
+
+TEST(GumboScanTest, QuotedAttrValueStopsAtSpecialBytes) {
+  const char double_specials[] = {
+    '"', '&', '\0', '\r', '\x01', '\x7F', '\x80', '\xFF',
+  };
+  const char double_plain[] = {'\'', '<', '>', '=', ' ', '\t', '\n', 'x'};
+  ExpectStopsAt(
+      double_specials, sizeof(double_specials),
+      GUMBO_SCAN_ATTR_VALUE_DOUBLE_QUOTED);
+  ExpectSkips(
+      double_plain, sizeof(double_plain), GUMBO_SCAN_ATTR_VALUE_DOUBLE_QUOTED);
+
+  const char single_specials[] = {
+    '\'', '&', '\0', '\r', '\x01', '\x7F', '\x80', '\xFF',
+  };
+  const char single_plain[] = {'"', '<', '>', '=', ' ', '\t', '\n', 'x'};
+  ExpectStopsAt(
+      single_specials, sizeof(single_specials),
+      GUMBO_SCAN_ATTR_VALUE_SINGLE_QUOTED);
+  ExpectSkips(
+      single_plain, sizeof(single_plain), GUMBO_SCAN_ATTR_VALUE_SINGLE_QUOTED);
+}
+
+TEST(GumboScanTest, UnquotedAttrValueStopsAtSpecialBytes) {
+  const char specials[] = {
+    '&', '>', '<', '=', '"', '\'', '`', ' ', '\t', '\n', '\f', '\0', '\r',
+    '\x7F', '\x80',
+  };
+  const char plain[] = {'/', '-', '#', 'A', 'z', '~'};
+  ExpectStopsAt(specials, sizeof(specials), GUMBO_SCAN_ATTR_VALUE_UNQUOTED);
+  ExpectSkips(plain, sizeof(plain), GUMBO_SCAN_ATTR_VALUE_UNQUOTED);
+}
+
+}  // namespace
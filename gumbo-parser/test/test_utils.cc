@@ -17,6 +17,7 @@
 #include "test_utils.h"
 
 #include "error.h"
+#include "intern.h"
 #include "util.h"
 
 int GetChildCount(GumboNode* node) {
@@ -145,6 +146,7 @@ GumboTest::GumboTest()
   options_.max_errors = 100;
   parser_._options = &options_;
   parser_._output = static_cast<GumboOutput*>(gumbo_alloc(sizeof(GumboOutput)));
+  parser_._output->names = gumbo_intern_table_new();
   gumbo_init_errors(&parser_);
 }
 
@@ -162,5 +164,6 @@ GumboTest::~GumboTest() {
     }
   }
   gumbo_destroy_errors(&parser_);
+  gumbo_intern_table_destroy(parser_._output->names);
   gumbo_free(parser_._output);
 }
@@ -582,6 +582,37 @@ TEST_F(GumboTokenizerTest, OpenTagWithAttributes) {
   EXPECT_EQ("link", ToString(id->original_value));
 }
 
+TEST_F(GumboTokenizerTest, LongMixedCaseTagAndAttributes) {
+  SetInput(
+      "<Custom-Element-With-A-Long-Name Data-Some-Long-Attribute-NAME="
+      "\"First line\r\nsecond caf\xC3\xA9 &amp; More\" "
+      "OTHER=Unquoted-Value-Longer-Than-A-Block>");
+  EXPECT_TRUE(gumbo_lex(&parser_, &token_));
+  ASSERT_EQ(GUMBO_TOKEN_START_TAG, token_.type);
+
+  GumboTokenStartTag* start_tag = &token_.v.start_tag;
+  EXPECT_EQ(GUMBO_TAG_UNKNOWN, start_tag->tag);
+  EXPECT_STREQ("custom-element-with-a-long-name", start_tag->name);
+  ASSERT_EQ(2, start_tag->attributes.length);
+
+  GumboAttribute* data =
+      static_cast<GumboAttribute*>(start_tag->attributes.data[0]);
+  EXPECT_STREQ("data-some-long-attribute-name", data->name);
+  EXPECT_EQ(
+      "Data-Some-Long-Attribute-NAME", ToString(data->original_name));
+  EXPECT_STREQ("First line\nsecond caf\xC3\xA9 & More", data->value);
+  EXPECT_EQ(
+      "\"First line\r\nsecond caf\xC3\xA9 &amp; More\"",
+      ToString(data->original_value));
+
+  GumboAttribute* other =
+      static_cast<GumboAttribute*>(start_tag->attributes.data[1]);
+  EXPECT_STREQ("other", other->name);
+  EXPECT_STREQ("Unquoted-Value-Longer-Than-A-Block", other->value);
+  EXPECT_EQ(
+      "Unquoted-Value-Longer-Than-A-Block", ToString(other->original_value));
+}
+
 TEST_F(GumboTokenizerTest, BogusComment1) {
   SetInput("<?xml is bogus-comment>Text");
   EXPECT_TRUE(gumbo_lex(&parser_, &token_));
@@ -724,4 +755,100 @@ TEST_F(GumboTokenizerTest, NullInTagNameState) {
   EXPECT_EQ(std::string("x\xEF\xBF\xBDx"), token_.v.start_tag.name);
   errors_are_expected_ = true;
 }
+
+TEST_F(GumboTokenizerTest, LexCharacterRun) {
+  SetInput("Hello, world!<b>");
+  gumbo_tokenizer_set_emit_character_runs(&parser_, true);
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  ASSERT_EQ(GUMBO_TOKEN_CHARACTER, token_.type);
+  EXPECT_TRUE(token_.is_character_run);
+  EXPECT_EQ('H', token_.v.character);
+  EXPECT_EQ("Hello, world!", ToString(token_.original_text));
+  EXPECT_EQ(1, token_.position.line);
+  EXPECT_EQ(1, token_.position.column);
+  EXPECT_EQ(0, token_.position.offset);
+
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  ASSERT_EQ(GUMBO_TOKEN_START_TAG, token_.type);
+  EXPECT_EQ(13, token_.position.offset);
+}
+
+TEST_F(GumboTokenizerTest, LexWhitespaceRun) {
+  SetInput(" \n\t x");
+  gumbo_tokenizer_set_emit_character_runs(&parser_, true);
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  ASSERT_EQ(GUMBO_TOKEN_CHARACTER, token_.type);
+  EXPECT_TRUE(token_.is_character_run);
+  EXPECT_EQ(' ', token_.v.character);
+  EXPECT_EQ(" \n\t x", ToString(token_.original_text));
+
+  SetInput(" \n\t <p>");
+  gumbo_tokenizer_set_emit_character_runs(&parser_, true);
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  ASSERT_EQ(GUMBO_TOKEN_WHITESPACE, token_.type);
+  EXPECT_TRUE(token_.is_character_run);
+  EXPECT_EQ(" \n\t ", ToString(token_.original_text));
+}
+
+TEST_F(GumboTokenizerTest, CharacterRunsOnlyCoverVerbatimText) {
+  SetInput("ab&amp;c\xC3\xA9\r\nd\re");
+  gumbo_tokenizer_set_emit_character_runs(&parser_, true);
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  EXPECT_TRUE(token_.is_character_run);
+  EXPECT_EQ("ab", ToString(token_.original_text));
+
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  EXPECT_FALSE(token_.is_character_run);
+  EXPECT_EQ('&', token_.v.character);
+  EXPECT_EQ("&amp;", ToString(token_.original_text));
+
+  // The CR of a CRLF pair is dropped, so the run has to stop in front of it.
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  EXPECT_TRUE(token_.is_character_run);
+  EXPECT_EQ("c\xC3\xA9", ToString(token_.original_text));
+
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  EXPECT_TRUE(token_.is_character_run);
+  EXPECT_EQ("\nd", ToString(token_.original_text));
+  EXPECT_EQ(1, token_.position.line);
+  EXPECT_EQ(10, token_.position.column);
+
+  // A lone CR is converted to LF, so it gets a token of its own.
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  EXPECT_FALSE(token_.is_character_run);
+  EXPECT_EQ(GUMBO_TOKEN_WHITESPACE, token_.type);
+  EXPECT_EQ('\n', token_.v.character);
+
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  EXPECT_TRUE(token_.is_character_run);
+  EXPECT_EQ("e", ToString(token_.original_text));
+  EXPECT_EQ(3, token_.position.line);
+
+  ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+  EXPECT_EQ(GUMBO_TOKEN_EOF, token_.type);
+}
+
+TEST_F(GumboTokenizerTest, CharacterRunsReduceTokenCount) {
+  const char* text =
+    "<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do\n"
+    "eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim\n"
+    "ad minim veniam, quis nostrud <em>exercitation</em> ullamco laboris\n"
+    "nisi ut aliquip ex ea commodo consequat &amp; duis aute irure.</p>\n";
+  int tokens[2];
+  for (int runs = 0; runs < 2; ++runs) {
+    SetInput(text);
+    gumbo_tokenizer_set_emit_character_runs(&parser_, runs);
+    tokens[runs] = 0;
+    do {
+      ASSERT_TRUE(gumbo_lex(&parser_, &token_));
+      gumbo_token_destroy(&token_);
+      ++tokens[runs];
+    } while (token_.type != GUMBO_TOKEN_EOF);
+  }
+  // One token per character (the 16 bytes of tags and the 5 byte character
+  // reference each produce a single token), plus EOF.
+  EXPECT_EQ(static_cast<int>(strlen(text)) - 21 + 5 + 1, tokens[0]);
+  // Four tags, the character reference, five runs of text and EOF.
+  EXPECT_EQ(11, tokens[1]);
+}
 }  // namespace
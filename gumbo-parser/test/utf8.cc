@@ -595,4 +595,41 @@ TEST_F(Utf8Test, MarkReset) {
   EXPECT_EQ(5, error.position.offset);
 }
 
+TEST_F(Utf8Test, SkipAsciiMatchesNext) {
+  const char* text = "ab\tc\n\td\n\nef\t\tgh  i\tj";
+  for (size_t length = 1; length < strlen(text); ++length) {
+    ResetText(text);
+    Advance(length);
+    GumboSourcePosition expected;
+    utf8iterator_get_position(&input_, &expected);
+
+    ResetText(text);
+    utf8iterator_skip_ascii(&input_, length);
+    GumboSourcePosition actual;
+    utf8iterator_get_position(&input_, &actual);
+    EXPECT_EQ(expected.line, actual.line) << length;
+    EXPECT_EQ(expected.column, actual.column) << length;
+    EXPECT_EQ(expected.offset, actual.offset) << length;
+    EXPECT_EQ(text + length, utf8iterator_get_char_pointer(&input_));
+    EXPECT_EQ(text[length], utf8iterator_current(&input_));
+  }
+}
+
+TEST_F(Utf8Test, ResetBeforeValidatedAscii) {
+  ResetText("a\rbc\x01" "d");
+  utf8iterator_mark(&input_);
+  Advance(5);
+  EXPECT_EQ('d', utf8iterator_current(&input_));
+  EXPECT_EQ(1, GetNumErrors());
+
+  // The CR and the invalid character still have to be decoded after
+  // returning to the mark.
+  utf8iterator_reset(&input_);
+  Advance(1);
+  EXPECT_EQ('\n', utf8iterator_current(&input_));
+  Advance(3);
+  EXPECT_EQ(0x01, utf8iterator_current(&input_));
+  EXPECT_EQ(2, GetNumErrors());
+}
+
 }  // namespace